@@ -0,0 +1,35 @@
+#!/usr/bin/env bash
+# Fails when a SIMD tier object (lien_<lib>_<tier> OBJECT libraries) defines a weak symbol.
+# Tier objects are compiled with their own ISA flags, a weak inline/template instantiation in
+# one of them may be kept by the linker over the baseline copy and run on CPUs without that ISA.
+# Best checked on a Debug build, optimized builds inline most of these away.
+#
+# Usage: check_tier_symbols.sh <build dir>
+
+set -euo pipefail
+
+BUILD_DIR="${1:?usage: check_tier_symbols.sh <build dir>}"
+
+status=0
+count=0
+while IFS= read -r obj; do
+    count=$((count + 1))
+    # W/V: weak, u: unique global (static locals of inline functions), i: indirect function.
+    # DW.ref.* is the exception personality reference every C++ object with unwinding carries
+    leaks=$(nm -C --defined-only "$obj" | awk '$2 ~ /^[WVui]$/' | grep -v ' DW\.ref\.' || true)
+    if [ -n "$leaks" ]; then
+        echo "Weak symbols in tier object $obj:"
+        echo "$leaks"
+        status=1
+    fi
+done < <(find "$BUILD_DIR/lib" -path '*/CMakeFiles/lien_*_*.dir/*' -name '*.o' | sort)
+
+if [ "$count" -eq 0 ]; then
+    echo "No tier objects found under $BUILD_DIR/lib"
+    exit 1
+fi
+
+if [ "$status" -eq 0 ]; then
+    echo "Checked $count tier objects, no weak symbols"
+fi
+exit $status
\ No newline at end of file
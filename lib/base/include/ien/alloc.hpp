@@ -3,8 +3,6 @@
 #include <cinttypes>
 #include <cstdlib>
 
-#include <unordered_map>
-
 namespace ien::_internal
 {
 	[[nodiscard]] void* aligned_alloc(size_t bytes, size_t alignment);
@@ -1,11 +1,14 @@
 #pragma once
 
 #include <ien/alloc.hpp>
+#include <ien/allocators/alloc_policy.hpp>
 #include <ien/platform.hpp>
 
+#include <new>
+
 namespace ien::allocators
 {
-    template<typename T, int Alignment>
+    template<typename T, int Alignment, alloc_policy Policy = alloc_policy::HEAP>
     struct aligned_allocator
     {
         typedef T         value_type;
@@ -19,18 +22,18 @@ namespace ien::allocators
         constexpr aligned_allocator() noexcept {}
 
         template <class U>
-        constexpr aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept { }
+        constexpr aligned_allocator(const aligned_allocator<U, Alignment, Policy>&) noexcept { }
 
         // Needed, since std::allocator_traits does not work with non type template parameters
         template <typename U>
         struct rebind
         {
-            typedef aligned_allocator<U, Alignment> other;
+            typedef aligned_allocator<U, Alignment, Policy> other;
         };
 
         [[nodiscard]] T* allocate(size_t n, const void* hint = 0)
         {
-            void* ptr = ien::aligned_alloc(sizeof(T) * n, Alignment);
+            void* ptr = policy_alloc(sizeof(T) * n, Alignment, Policy);
             if(ptr != nullptr) 
             {
                 return reinterpret_cast<T*>(ptr);
@@ -40,19 +43,23 @@ namespace ien::allocators
 
         void deallocate(T* p, size_t n)
         {
-            ien::aligned_free(p);
+            policy_free(p, sizeof(T) * n, Policy);
         }
     };
 
-    template<typename T, typename U, std::size_t Alignment>
+    template<typename T, typename U, int Alignment, alloc_policy Policy>
     constexpr bool operator==(
-        const aligned_allocator<T, Alignment>&, 
-        const aligned_allocator<U, Alignment>&) noexcept 
+        const aligned_allocator<T, Alignment, Policy>&, 
+        const aligned_allocator<U, Alignment, Policy>&) noexcept 
     { return true; }
 
-    template<typename T, typename U, std::size_t Alignment>
+    template<typename T, typename U, int Alignment, alloc_policy Policy>
     constexpr bool operator!=(
-        const aligned_allocator<T, Alignment>&, 
-        const aligned_allocator<U, Alignment>&) noexcept 
+        const aligned_allocator<T, Alignment, Policy>&, 
+        const aligned_allocator<U, Alignment, Policy>&) noexcept 
     { return false; }
+
+    // Large buffers on anonymous, huge page backed mappings
+    template<typename T, int Alignment = LIEN_DEFAULT_ALIGNMENT>
+    using mmap_allocator = aligned_allocator<T, Alignment, alloc_policy::MMAP>;
 }
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ien::allocators
+{
+    enum class alloc_policy
+    {
+        HEAP,       // ien::aligned_alloc
+        POOL,       // ien::allocators::pool_alloc
+        MMAP,       // Anonymous mmap with transparent huge pages, at or above LIEN_MMAP_THRESHOLD
+        MMAP_FILE   // File-backed mmap, at or above LIEN_MMAP_THRESHOLD
+    };
+
+    // Memory from policy_alloc must be released through policy_free, with the same size and policy
+    [[nodiscard]] void* policy_alloc(size_t bytes, size_t alignment, alloc_policy policy);
+    void policy_free(void* ptr, size_t bytes, alloc_policy policy);
+}
\ No newline at end of file
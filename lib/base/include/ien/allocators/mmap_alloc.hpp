@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// Smaller requests are served by ien::aligned_alloc, so the mapping overhead is only paid by large buffers
+#define LIEN_MMAP_THRESHOLD (size_t(2) << 20)
+
+namespace ien::allocators
+{
+    // Maps 'bytes' of memory aligned to at least 'alignment'.
+    // Anonymous mappings are 2MiB aligned and advised with MADV_HUGEPAGE where available. File-backed
+    // mappings are page aligned and use an unlinked temporary file in the directory set with
+    // set_mmap_file_directory. Returns nullptr on failure, or if the alignment cannot be met.
+    // Falls back to ien::aligned_alloc below LIEN_MMAP_THRESHOLD, and on platforms without mmap.
+    [[nodiscard]] void* mmap_alloc(size_t bytes, size_t alignment, bool file_backed = false);
+
+    // 'bytes' must be the size passed to mmap_alloc
+    void mmap_free(void* ptr, size_t bytes);
+
+    // Directory for the backing files of file-backed mappings, defaults to the system temporary directory
+    void set_mmap_file_directory(const std::string& path);
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <ien/allocators/aligned_allocator.hpp>
+#include <ien/platform.hpp>
+
+#include <cstddef>
+
+namespace ien::allocators
+{
+    // Size-class block pool. Freed blocks are kept in a per-thread cache (and a shared depot
+    // once that is full) and handed out again to later requests of the same size class,
+    // so a steady allocation pattern stops reaching malloc once it has warmed up.
+    // Requests above 256MiB, or aligned to more than a cache line, bypass the pool.
+    // Blocks must be released through pool_free, from any thread.
+    [[nodiscard]] void* pool_alloc(size_t bytes, size_t alignment);
+    void pool_free(void* ptr);
+
+    // Returns every block cached by the calling thread and by the shared depot to the system
+    void pool_trim();
+
+    template<typename T, int Alignment = LIEN_DEFAULT_ALIGNMENT>
+    using pool_allocator = aligned_allocator<T, Alignment, alloc_policy::POOL>;
+}
\ No newline at end of file
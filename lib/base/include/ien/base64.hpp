@@ -1,3 +1,5 @@
+#pragma once
+
 #include <cinttypes>
 #include <cstddef>
 #include <string>
@@ -5,6 +7,73 @@
 
 namespace ien::base64
 {
-    std::string encode(const uint8_t* src, size_t len);
-    std::vector<uint8_t> decode(const uint8_t* data, size_t len);
+    enum class alphabet
+    {
+        standard,   // RFC 4648 section 4, '+' and '/'
+        url_safe    // RFC 4648 section 5, '-' and '_'
+    };
+
+    // Encoded length of 'len' bytes, padding included
+    constexpr size_t encoded_size(size_t len)
+    {
+        return ((len + 2) / 3) * 4;
+    }
+
+    // Upper bound of the decoded length of 'len' characters
+    constexpr size_t decoded_size_max(size_t len)
+    {
+        return ((len + 3) / 4) * 3;
+    }
+
+    // Writes encoded_size(len) characters to 'out', returns that count
+    size_t encode(const uint8_t* src, size_t len, char* out, alphabet abc = alphabet::standard);
+    std::string encode(const uint8_t* src, size_t len, alphabet abc = alphabet::standard);
+
+    // Decoding is strict: only characters of the alphabet are accepted, '=' padding is optional but must
+    // complete the last quad when present, and the unused bits of the last character must be zero.
+    // Invalid input throws std::invalid_argument.
+    // 'out' must hold decoded_size_max(len) bytes, returns the number of bytes written
+    size_t decode(const char* src, size_t len, uint8_t* out, alphabet abc = alphabet::standard);
+    std::vector<uint8_t> decode(const uint8_t* data, size_t len, alphabet abc = alphabet::standard);
+
+    // Incremental encoder, the concatenated output equals encode() over the concatenated input
+    class encoder
+    {
+    private:
+        alphabet _alphabet;
+        uint8_t _pending[2] = { };
+        size_t _pending_len = 0;
+
+    public:
+        encoder(alphabet abc = alphabet::standard);
+
+        // Encodes every complete 3 byte group, up to 2 bytes are kept for the next call.
+        // 'out' must hold encoded_size(len) characters, returns the number written
+        size_t update(const uint8_t* src, size_t len, char* out);
+
+        // Encodes the kept bytes with padding, 'out' must hold 4 characters. Returns the number written,
+        // the encoder can be reused afterwards
+        size_t finish(char* out);
+    };
+
+    // Incremental decoder, validates as decode() does over the concatenated input
+    class decoder
+    {
+    private:
+        alphabet _alphabet;
+        char _pending[4] = { };
+        size_t _pending_len = 0;
+        bool _padded = false;
+
+    public:
+        decoder(alphabet abc = alphabet::standard);
+
+        // Decodes every complete quad, up to 3 characters are kept for the next call.
+        // 'out' must hold decoded_size_max(len) bytes, returns the number written
+        size_t update(const char* src, size_t len, uint8_t* out);
+
+        // Decodes the kept unpadded tail, 'out' must hold 2 bytes. Returns the number written,
+        // the decoder can be reused afterwards
+        size_t finish(uint8_t* out);
+    };
 }
\ No newline at end of file
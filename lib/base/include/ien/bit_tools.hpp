@@ -1,8 +1,15 @@
 #pragma once
 
+#include <ien/platform.hpp>
+
 #include <cinttypes>
 #include <type_traits>
 
+#if defined(LIEN_COMPILER_MSVC)
+    #include <intrin.h>
+    #include <stdlib.h>
+#endif
+
 namespace ien
 {
     template<typename T>
@@ -110,4 +117,46 @@ namespace ien
         LIEN_RESTRICT_SIZE<TInt32, 4>();
         return static_cast<TInt32>((v & 0xFFFFFFFF00000000) >> 32);
     }
+
+    inline uint64_t byteswap64(uint64_t v)
+    {
+    #if defined(LIEN_COMPILER_MSVC)
+        return _byteswap_uint64(v);
+    #else
+        return __builtin_bswap64(v);
+    #endif
+    }
+
+    inline int popcount64(uint64_t v)
+    {
+    #if defined(LIEN_COMPILER_MSVC)
+        // __popcnt64 needs POPCNT support, which is not part of the baseline ISA
+        v = v - ((v >> 1) & 0x5555555555555555ull);
+        v = (v & 0x3333333333333333ull) + ((v >> 2) & 0x3333333333333333ull);
+        v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+        return static_cast<int>((v * 0x0101010101010101ull) >> 56);
+    #else
+        return __builtin_popcountll(v);
+    #endif
+    }
+
+    // 'v' must not be zero
+    inline int count_leading_zeros64(uint64_t v)
+    {
+    #if defined(LIEN_COMPILER_MSVC) && defined(LIEN_ARCH_X86_64)
+        unsigned long idx;
+        _BitScanReverse64(&idx, v);
+        return 63 - static_cast<int>(idx);
+    #elif defined(LIEN_COMPILER_MSVC)
+        unsigned long idx;
+        if (_BitScanReverse(&idx, static_cast<unsigned long>(v >> 32)))
+        {
+            return 31 - static_cast<int>(idx);
+        }
+        _BitScanReverse(&idx, static_cast<unsigned long>(v));
+        return 63 - static_cast<int>(idx);
+    #else
+        return __builtin_clzll(v);
+    #endif
+    }
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 namespace ien
 {
+    // Bits are numbered MSB first within every byte, bit 0 is the MSB of the first byte
     class bit_view
     {
     private:
@@ -12,16 +13,36 @@ namespace ien
         size_t _len;
 
     public:
+        static constexpr size_t npos = static_cast<size_t>(-1);
 
         constexpr bit_view(uint8_t* data_ptr, size_t len)
             : _data_ptr(data_ptr)
             , _len(len)
         { }
-        
+
         bool operator[](size_t index) const;
 
         ien::fixed_vector<bool> get_bits(size_t index, size_t count) const;
 
+        // Reads 'count' (up to 64) bits as an integer, bit 'index' being the most significant
+        uint64_t extract(size_t index, size_t count) const;
+
+        // Overwrites 'count' (up to 64) bits with the low bits of 'value', its most significant one going to 'index'
+        void insert(size_t index, size_t count, uint64_t value);
+
+        // Copies 'count' bits to 'out', packed MSB first from out[0]. 'out' must hold (count + 7) / 8 bytes,
+        // the unused low bits of the last byte are zeroed
+        void extract_bytes(size_t index, size_t count, uint8_t* out) const;
+
+        // Overwrites 'count' bits with the first 'count' bits of 'src' (packed MSB first), surrounding bits are kept
+        void insert_bytes(size_t index, size_t count, const uint8_t* src);
+
+        size_t popcount() const;
+        size_t popcount(size_t index, size_t count) const;
+
+        // Index of the first set bit at or after 'index', npos if there is none
+        size_t find_first_set(size_t index = 0) const;
+
         size_t size() const;
     };
 }
\ No newline at end of file
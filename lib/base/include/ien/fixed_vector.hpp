@@ -1,6 +1,7 @@
 #pragma once
 
 #include <ien/alloc.hpp>
+#include <ien/allocators/alloc_policy.hpp>
 #include <ien/assert.hpp>
 #include <ien/platform.hpp>
 
@@ -101,10 +102,15 @@ namespace ien
     template<typename T>
     class fixed_vector
     {
+    public:
+        typedef void(*deleter_t)(void*);
+
     protected:
         T* _data = nullptr;
         std::size_t _len;
         std::size_t _alignment;
+        allocators::alloc_policy _policy = allocators::alloc_policy::HEAP;
+        deleter_t _deleter = nullptr;
 
     public:
         using iterator = fixed_vector_iterator<T, false>;
@@ -116,65 +122,65 @@ namespace ien
         { }
 
         fixed_vector(std::size_t len)
-            : _len(len)
-            , _alignment(alignof(T))
-        {
-            if(len == 0)
-                return;
-
-            _data = reinterpret_cast<T*>(
-                ien::aligned_alloc(len * sizeof(T), _alignment)
-            );
-
-            if(_data == nullptr)
-                throw std::bad_alloc();
-
-            LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(_data, _alignment));
-        }
+            : fixed_vector(len, alignof(T))
+        { }
 
         fixed_vector(std::size_t len, std::size_t alignment)
+            : fixed_vector(len, alignment, allocators::alloc_policy::HEAP)
+        { }
+
+        fixed_vector(std::size_t len, std::size_t alignment, allocators::alloc_policy policy)
             : _len(len)
             , _alignment(alignment)
+            , _policy(policy)
         {
             if(len == 0)
                 return;
 
-            _data = reinterpret_cast<T*>(
-                ien::aligned_alloc(len * sizeof(T), _alignment)
-            );
-
-            if(_data == nullptr)
-                throw std::bad_alloc();
-
-            LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(_data, _alignment));
+            _data = allocate_storage(len, _alignment, _policy);
         }
 
         fixed_vector(const fixed_vector& cp_src)
-            : _data(reinterpret_cast<T*>(ien::aligned_alloc(cp_src._len, cp_src._alignment)))
+            : _data(allocate_storage(cp_src._len, cp_src._alignment, cp_src._policy))
             , _len(cp_src._len)
             , _alignment(cp_src._alignment)
+            , _policy(cp_src._policy)
         {
-            std::memcpy(_data, cp_src._data, _len);
+            std::memcpy(_data, cp_src._data, _len * sizeof(T));
         }
 
         fixed_vector(fixed_vector&& mv_src) noexcept
             : _data(mv_src._data)
             , _len(mv_src._len)
             , _alignment(mv_src._alignment)
+            , _policy(mv_src._policy)
+            , _deleter(mv_src._deleter)
         {
             mv_src._data = nullptr;
         }
 
-        virtual ~fixed_vector()
+        // Takes ownership of 'data', which is released with 'deleter'.
+        // 'data' must be aligned to 'alignment'. Copies of the result use the default heap storage.
+        static fixed_vector adopt(T* data, std::size_t len, std::size_t alignment, deleter_t deleter)
         {
-            if (_data == nullptr)
-                return;
+            LIEN_ASSERT(ien::is_ptr_aligned(data, alignment));
+
+            fixed_vector result;
+            result._data = data;
+            result._len = len;
+            result._alignment = alignment;
+            result._deleter = deleter;
+            return result;
+        }
 
-            ien::aligned_free(_data);
+        virtual ~fixed_vector()
+        {
+            release_storage();
         }
 
         std::size_t size() const noexcept { return _len; }
         std::size_t alignment() const noexcept { return _alignment; }
+        allocators::alloc_policy policy() const noexcept { return _policy; }
 
         T* data() noexcept { return _data; }
         const T* cdata() const noexcept { return _data; }
@@ -201,20 +207,29 @@ namespace ien
 
         void operator=(const fixed_vector<T>& cp_src)
         {
-            _data = reinterpret_cast<T*>(LIEN_ALIGNED_REALLOC(_data, cp_src._len, cp_src._alignment));
-            std::memcpy(_data, cp_src._data, cp_src.size());
-            
+            if(this == &cp_src)
+                return;
+
+            release_storage();
+            _data = allocate_storage(cp_src._len, cp_src._alignment, cp_src._policy);
+            std::memcpy(_data, cp_src._data, cp_src._len * sizeof(T));
+
             _alignment = cp_src._alignment;
             _len = cp_src._len;
-
-            LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(_data, _alignment));
+            _policy = cp_src._policy;
         }
 
         void operator=(fixed_vector<T>&& mv_src) noexcept
         {
+            if(this == &mv_src)
+                return;
+
+            release_storage();
             this->_data = mv_src._data;
             this->_alignment = mv_src._alignment;
             this->_len = mv_src._len;
+            this->_policy = mv_src._policy;
+            this->_deleter = mv_src._deleter;
             
             mv_src._data = nullptr;
             mv_src._len = 0;
@@ -249,5 +264,31 @@ namespace ien
         {
             return fixed_vector_iterator<T, true>(_data + _len - 1);
         }
+
+    private:
+        static T* allocate_storage(std::size_t len, std::size_t alignment, allocators::alloc_policy policy)
+        {
+            void* ptr = allocators::policy_alloc(len * sizeof(T), alignment, policy);
+
+            if(ptr == nullptr)
+                throw std::bad_alloc();
+
+            LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(ptr, alignment));
+            return reinterpret_cast<T*>(ptr);
+        }
+
+        void release_storage()
+        {
+            if (_data == nullptr)
+                return;
+
+            if(_deleter != nullptr)
+                _deleter(_data);
+            else
+                allocators::policy_free(_data, _len * sizeof(T), _policy);
+
+            _data = nullptr;
+            _deleter = nullptr;
+        }
     };
 }
\ No newline at end of file
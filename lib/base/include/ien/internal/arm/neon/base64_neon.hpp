@@ -0,0 +1,22 @@
+#pragma once
+
+#include <ien/base64.hpp>
+#include <ien/platform.hpp>
+
+#include <cinttypes>
+#include <cstddef>
+
+#if defined(LIEN_ARM_NEON)
+
+namespace ien::_internal
+{
+    // Encode whole 48 byte blocks of src[0, len) without padding.
+    // Returns the number of bytes consumed, 'out' receives 4/3 of it
+    size_t base64_encode_neon(const uint8_t* src, size_t len, char* out, base64::alphabet abc);
+
+    // Decode whole 64 character blocks of src[0, len), stopping before the first block holding a character
+    // outside the alphabet, padding included. Returns the number of characters consumed, 'out' receives 3/4 of it
+    size_t base64_decode_neon(const char* src, size_t len, uint8_t* out, base64::alphabet abc);
+}
+
+#endif
\ No newline at end of file
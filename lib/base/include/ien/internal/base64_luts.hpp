@@ -0,0 +1,47 @@
+#pragma once
+
+#include <ien/base64.hpp>
+
+#include <cinttypes>
+
+namespace ien::_internal
+{
+    // Nibble lookup tables shared by the SIMD base64 kernels
+    struct base64_luts
+    {
+        // Encode: ASCII offset of every index class, the class being
+        // saturate(index - 51) for 26..63 and 13 for 0..25
+        int8_t encode_shift[16];
+
+        // Decode: a character is invalid when (decode_lo[c & 0x0F] & decode_hi[c >> 4]) != 0
+        uint8_t decode_lo[16];
+        uint8_t decode_hi[16];
+
+        // Decode: value offset indexed by (c >> 4), plus 8 for 'decode_special'
+        int8_t decode_roll[16];
+        uint8_t decode_special;
+    };
+
+    // Internal linkage: every including TU is compiled with its own ISA flags, shared
+    // inline definitions would let the linker keep a copy built for a newer instruction set
+    static const base64_luts base64_luts_standard = {
+        { 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 65, 0, 0 },
+        { 0x0B, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x15, 0x17, 0x17, 0x17, 0x15 },
+        { 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x08, 0x10, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01 },
+        { 0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 16, 0, 0, 0, 0, 0 },
+        '/'
+    };
+
+    static const base64_luts base64_luts_url_safe = {
+        { 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -17, 32, 65, 0, 0 },
+        { 0x0B, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x37, 0x37, 0x35, 0x37, 0x27 },
+        { 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x08, 0x20, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01 },
+        { 0, 0, 17, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, -32, 0, 0 },
+        '_'
+    };
+
+    static inline const base64_luts& get_base64_luts(base64::alphabet abc)
+    {
+        return (abc == base64::alphabet::url_safe) ? base64_luts_url_safe : base64_luts_standard;
+    }
+}
\ No newline at end of file
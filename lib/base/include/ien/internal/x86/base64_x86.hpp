@@ -0,0 +1,25 @@
+#pragma once
+
+#include <ien/base64.hpp>
+#include <ien/platform.hpp>
+
+#include <cinttypes>
+#include <cstddef>
+
+#if defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)
+
+namespace ien::_internal
+{
+    // Encode whole blocks of src[0, len) (12 bytes for SSSE3, 24 for AVX2) without padding.
+    // Returns the number of bytes consumed, a multiple of 3, 'out' receives 4/3 of it
+    size_t base64_encode_ssse3(const uint8_t* src, size_t len, char* out, base64::alphabet abc);
+    size_t base64_encode_avx2(const uint8_t* src, size_t len, char* out, base64::alphabet abc);
+
+    // Decode whole blocks of src[0, len) (16 characters for SSSE3, 32 for AVX2), stopping before the
+    // first block holding a character outside the alphabet, padding included.
+    // Returns the number of characters consumed, a multiple of 4, 'out' receives 3/4 of it
+    size_t base64_decode_ssse3(const char* src, size_t len, uint8_t* out, base64::alphabet abc);
+    size_t base64_decode_avx2(const char* src, size_t len, uint8_t* out, base64::alphabet abc);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <ien/platform.hpp>
+
+#include <cinttypes>
+#include <cstddef>
+
+#if defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)
+
+namespace ien::_internal
+{
+    // Set bits in data[0, len)
+    size_t popcount_bytes_avx2(const uint8_t* data, size_t len);
+
+    // Index of the first non-zero byte in data[0, len), 'len' if there is none
+    size_t find_nonzero_byte_avx2(const uint8_t* data, size_t len);
+
+    // out[i] = (src[i] << shift) | (src[i + 1] >> (8 - shift)) for i in [0, len), 'shift' in [1, 7].
+    // src[len] must be readable
+    void shift_bytes_left_avx2(const uint8_t* src, size_t len, int shift, uint8_t* out);
+}
+
+#endif
\ No newline at end of file
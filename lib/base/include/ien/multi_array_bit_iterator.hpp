@@ -1,46 +1,199 @@
 #pragma once
 
+#include <ien/bit_tools.hpp>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace ien
 {
+    // Iterates the bits of several arrays as a single bitstream, every item LSB first.
+    // Bulk reads and writes pack the stream LSB first into bytes
     template<typename T>
     class multi_array_bit_iterator
     {
         static_assert(std::is_integral_v<T>, "Only integral template types are supported!");
 
     private:
-        std::vector<std::pair<const T*, size_t>> _views;
+        using unsigned_t = std::make_unsigned_t<T>;
+        static constexpr size_t ITEM_BITS = sizeof(T) * 8;
+
+        // Whole items can be copied as bytes when their memory order is the stream order
+    #if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        static constexpr bool ITEMS_ARE_BYTE_ORDERED = (sizeof(T) == 1);
+    #else
+        static constexpr bool ITEMS_ARE_BYTE_ORDERED = true;
+    #endif
+
+        struct view
+        {
+            const T* ptr;
+            T* mutable_ptr; // null for read-only views
+            size_t len;
+        };
+
+        std::vector<view> _views;
+        std::vector<size_t> _view_offsets; // first item of every view
         size_t _current_view = 0;
         size_t _current_item = 0;
         size_t _current_bit = 0;
         size_t _total_items = 0;
 
     public:
+        // Empty views are skipped. Views appended through a const pointer can not be written
         void append_view(const T* ptr, size_t len)
         {
-            _views.push_back({ptr, len});
-            _total_items += len;
+            append(ptr, nullptr, len);
         }
 
-        size_t total_items()
+        void append_view(T* ptr, size_t len)
+        {
+            append(ptr, ptr, len);
+        }
+
+        size_t total_items() const
         {
             return _total_items;
         }
 
-        size_t total_bits()
+        size_t total_bits() const
+        {
+            return _total_items * ITEM_BITS;
+        }
+
+        size_t position() const
+        {
+            if(_current_view >= _views.size())
+            {
+                return total_bits();
+            }
+            return ((_view_offsets[_current_view] + _current_item) * ITEM_BITS) + _current_bit;
+        }
+
+        size_t remaining_bits() const
+        {
+            return total_bits() - position();
+        }
+
+        // O(log views), 'bit_pos' is clamped to total_bits()
+        void seek(size_t bit_pos)
+        {
+            if(bit_pos >= total_bits())
+            {
+                _current_view = _views.size();
+                _current_item = 0;
+                _current_bit = 0;
+                return;
+            }
+
+            const size_t item_pos = bit_pos / ITEM_BITS;
+            auto it = std::upper_bound(_view_offsets.begin(), _view_offsets.end(), item_pos);
+            _current_view = static_cast<size_t>(std::distance(_view_offsets.begin(), it)) - 1;
+            _current_item = item_pos - _view_offsets[_current_view];
+            _current_bit = bit_pos % ITEM_BITS;
+        }
+
+        // Reads 'count' (up to 64) bits, the first one ending up in the LSB of the result.
+        // Throws std::out_of_range if fewer bits remain
+        uint64_t read_bits(size_t count)
         {
-            return _total_items * sizeof(T) * 8;
+            check_bit_count(count);
+
+            uint64_t result = 0;
+            size_t done = 0;
+            while(done < count)
+            {
+                const size_t n = std::min(count - done, ITEM_BITS - _current_bit);
+                const uint64_t item = static_cast<unsigned_t>(_views[_current_view].ptr[_current_item]);
+                result |= ((item >> _current_bit) & low_mask(n)) << done;
+                done += n;
+                advance_bits(n);
+            }
+            return result;
+        }
+
+        // Writes the 'count' (up to 64) low bits of 'value', LSB first.
+        // Throws std::out_of_range if fewer bits remain, std::logic_error on read-only views
+        void write_bits(uint64_t value, size_t count)
+        {
+            check_bit_count(count);
+
+            size_t done = 0;
+            while(done < count)
+            {
+                const size_t n = std::min(count - done, ITEM_BITS - _current_bit);
+                T& item = writable_view().mutable_ptr[_current_item];
+                const uint64_t mask = low_mask(n) << _current_bit;
+                const uint64_t bits = ((value >> done) << _current_bit) & mask;
+                item = static_cast<T>(static_cast<unsigned_t>((static_cast<unsigned_t>(item) & ~mask) | bits));
+                done += n;
+                advance_bits(n);
+            }
+        }
+
+        // Reads up to 'count' bits into 'out', which must hold (count + 7) / 8 bytes. Item aligned runs are
+        // copied one span per view, the unused high bits of the last byte are zeroed. Returns the number of bits read
+        size_t read(uint8_t* out, size_t count)
+        {
+            count = std::min(count, remaining_bits());
+
+            size_t done = 0;
+            while(done < count)
+            {
+                if(ITEMS_ARE_BYTE_ORDERED && _current_bit == 0 && (done % 8) == 0 && (count - done) >= ITEM_BITS)
+                {
+                    const view& v = _views[_current_view];
+                    const size_t items = std::min((count - done) / ITEM_BITS, v.len - _current_item);
+                    std::memcpy(out + (done / 8), v.ptr + _current_item, items * sizeof(T));
+                    done += items * ITEM_BITS;
+                    advance_items(items);
+                    continue;
+                }
+
+                const size_t n = std::min<size_t>(56, count - done);
+                store_bits(out, done, read_bits(n), n);
+                done += n;
+            }
+            return count;
+        }
+
+        // Writes up to 'count' bits from 'src' (packed LSB first). Item aligned runs are copied one span per view.
+        // Returns the number of bits written
+        size_t write(const uint8_t* src, size_t count)
+        {
+            count = std::min(count, remaining_bits());
+
+            size_t done = 0;
+            while(done < count)
+            {
+                if(ITEMS_ARE_BYTE_ORDERED && _current_bit == 0 && (done % 8) == 0 && (count - done) >= ITEM_BITS)
+                {
+                    const view& v = writable_view();
+                    const size_t items = std::min((count - done) / ITEM_BITS, v.len - _current_item);
+                    std::memcpy(v.mutable_ptr + _current_item, src + (done / 8), items * sizeof(T));
+                    done += items * ITEM_BITS;
+                    advance_items(items);
+                    continue;
+                }
+
+                const size_t n = std::min<size_t>(56, count - done);
+                write_bits(load_bits(src, done, n), n);
+                done += n;
+            }
+            return count;
         }
 
         bool operator++()
         {
             if(_current_bit == ((sizeof(T) * 8) - 1))
             {
-                const auto& [view_ptr, view_len] = _views[_current_view];
-                if(_current_item == (view_len - 1))
+                const view& current = _views[_current_view];
+                if(_current_item == (current.len - 1))
                 {
                     if(_current_view == _views.size() - 1)
                     {
@@ -66,15 +219,112 @@ namespace ien
             return true;
         }
 
+        bool operator--()
+        {
+            const size_t pos = position();
+            if(pos == 0) { return false; }
+
+            seek(pos - 1);
+            return true;
+        }
+
         bool operator++(int)
         {
             return operator++();
         }
 
+        bool operator--(int)
+        {
+            return operator--();
+        }
+
         bool operator*()
         {
-            const T& item = _views[_current_view].first[_current_item];
+            const T& item = _views[_current_view].ptr[_current_item];
             return ien::get_bit(item, _current_bit);
         }
+
+    private:
+        void append(const T* ptr, T* mutable_ptr, size_t len)
+        {
+            if(len == 0) { return; }
+
+            _views.push_back({ ptr, mutable_ptr, len });
+            _view_offsets.push_back(_total_items);
+            _total_items += len;
+        }
+
+        static constexpr uint64_t low_mask(size_t bits)
+        {
+            return (bits >= 64) ? ~uint64_t(0) : ((uint64_t(1) << bits) - 1);
+        }
+
+        void check_bit_count(size_t count) const
+        {
+            if(count > 64 || count > remaining_bits())
+            {
+                throw std::out_of_range("Bit count exceeds the remaining bits or 64");
+            }
+        }
+
+        const view& writable_view() const
+        {
+            const view& v = _views[_current_view];
+            if(v.mutable_ptr == nullptr)
+            {
+                throw std::logic_error("Unable to write to a read-only view");
+            }
+            return v;
+        }
+
+        void advance_bits(size_t count)
+        {
+            _current_bit += count;
+            if(_current_bit == ITEM_BITS)
+            {
+                _current_bit = 0;
+                advance_items(1);
+            }
+        }
+
+        void advance_items(size_t count)
+        {
+            _current_item += count;
+            if(_current_item == _views[_current_view].len)
+            {
+                _current_item = 0;
+                ++_current_view;
+            }
+        }
+
+        // ORs 'count' (up to 56) bits into 'out' at bit 'offset', bytes past the offset byte are overwritten
+        static void store_bits(uint8_t* out, size_t offset, uint64_t bits, size_t count)
+        {
+            uint8_t* dst = out + (offset / 8);
+            const size_t shift = offset % 8;
+            bits <<= shift;
+
+            const size_t bytes = (shift + count + 7) / 8;
+            dst[0] = static_cast<uint8_t>((shift == 0) ? bits : (dst[0] | bits));
+            for(size_t i = 1; i < bytes; ++i)
+            {
+                dst[i] = static_cast<uint8_t>(bits >> (i * 8));
+            }
+        }
+
+        // 'count' (up to 56) bits of 'src' from bit 'offset'
+        static uint64_t load_bits(const uint8_t* src, size_t offset, size_t count)
+        {
+            const uint8_t* ptr = src + (offset / 8);
+            const size_t shift = offset % 8;
+
+            uint64_t bits = 0;
+            const size_t bytes = (shift + count + 7) / 8;
+            for(size_t i = 0; i < bytes; ++i)
+            {
+                bits |= static_cast<uint64_t>(ptr[i]) << (i * 8);
+            }
+            return (bits >> shift) & low_mask(count);
+        }
     };
 }
\ No newline at end of file
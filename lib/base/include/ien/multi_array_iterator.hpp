@@ -1,23 +1,31 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
 namespace ien
 {
+    // Iterates several arrays as a single sequence
     template<typename T>
     class multi_array_iterator
     {
     private:
         std::vector<std::pair<T*, size_t>> _views;
+        std::vector<size_t> _view_offsets; // first position of every view
         size_t _current_view = 0;
         size_t _current_view_offset = 0;
         size_t _total_len = 0;
 
     public:
+        // Empty views are skipped
         void append_view(T* ptr, size_t len)
         {
+            if(len == 0) { return; }
+
             _views.push_back({ptr, len});
+            _view_offsets.push_back(_total_len);
             _total_len += len;
         }
 
@@ -26,16 +34,70 @@ namespace ien
             return _total_len;
         }
 
-        bool operator++()
+        size_t position() const
         {
-            if(_current_view >= _views.size()) { return false; }
+            return (_current_view < _views.size())
+                ? _view_offsets[_current_view] + _current_view_offset
+                : _total_len;
+        }
 
-            auto& [ptr, len] = _views[_current_view];
-            if(++_current_view_offset == len)
+        size_t remaining() const
+        {
+            return _total_len - position();
+        }
+
+        // O(log views), 'pos' is clamped to total_length()
+        void seek(size_t pos)
+        {
+            if(pos >= _total_len)
             {
-                ++_current_view;
+                _current_view = _views.size();
                 _current_view_offset = 0;
+                return;
+            }
+
+            auto it = std::upper_bound(_view_offsets.begin(), _view_offsets.end(), pos);
+            _current_view = static_cast<size_t>(std::distance(_view_offsets.begin(), it)) - 1;
+            _current_view_offset = pos - _view_offsets[_current_view];
+        }
+
+        // Copies up to 'count' elements from the current position to 'out', one span per view.
+        // Returns the number of elements read
+        size_t read(T* out, size_t count)
+        {
+            size_t done = 0;
+            while(done < count && _current_view < _views.size())
+            {
+                auto& [ptr, len] = _views[_current_view];
+                const size_t n = std::min(count - done, len - _current_view_offset);
+                std::copy_n(ptr + _current_view_offset, n, out + done);
+                done += n;
+                advance_in_view(n);
+            }
+            return done;
+        }
+
+        // Copies up to 'count' elements from 'src' to the current position, one span per view.
+        // Returns the number of elements written
+        size_t write(const T* src, size_t count)
+        {
+            size_t done = 0;
+            while(done < count && _current_view < _views.size())
+            {
+                auto& [ptr, len] = _views[_current_view];
+                const size_t n = std::min(count - done, len - _current_view_offset);
+                std::copy_n(src + done, n, ptr + _current_view_offset);
+                done += n;
+                advance_in_view(n);
             }
+            return done;
+        }
+
+        bool operator++()
+        {
+            if(_current_view >= _views.size()) { return false; }
+
+            advance_in_view(1);
             return true;
         }
 
@@ -43,11 +105,13 @@ namespace ien
         {
             if(_current_view == 0 && _current_view_offset == 0) { return false; }
 
-            auto& [ptr, len] = _views[_current_view];
             if(_current_view_offset == 0)
             {
-                size_t prev_len = _views[--_current_view].second();
-                _current_view_offset = prev_len - 1;
+                _current_view_offset = _views[--_current_view].second - 1;
+            }
+            else
+            {
+                --_current_view_offset;
             }
             return true;
         }
@@ -61,5 +125,16 @@ namespace ien
             auto& [ptr, len] = _views[_current_view];
             return ptr[_current_view_offset];
         }
+
+    private:
+        void advance_in_view(size_t count)
+        {
+            _current_view_offset += count;
+            if(_current_view_offset == _views[_current_view].second)
+            {
+                ++_current_view;
+                _current_view_offset = 0;
+            }
+        }
     };
 }
\ No newline at end of file
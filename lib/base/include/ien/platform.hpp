@@ -98,6 +98,9 @@ namespace ien
 
 #define LIEN_ALIGNED_SZ(sz, alig) (sz - (sz % alig) + alig)
 
+// Destructive interference size, used to keep independently written data on separate lines
+#define LIEN_CACHE_LINE_SIZE 64
+
 #if defined(LIEN_ARCH_X86_64) || defined(LIEN_ARCH_X86)
     #define LIEN_DEFAULT_ALIGNMENT 32
 #elif defined(LIEN_ARCH_ARM) || defined(LIEN_ARCH_ARM64)
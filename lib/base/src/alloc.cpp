@@ -1,22 +1,32 @@
 #include <ien/alloc.hpp>
 
+#include <cstring>
+
 namespace ien::_internal
 {
-	std::unordered_map<void*, void*> _ptr_table;
+	// The pointer returned by malloc is stored right before the aligned block,
+	// so freeing needs no lookup and no shared state.
 
 	void* aligned_alloc(size_t bytes, size_t alignment)
 	{
-		void* ptr = malloc(bytes + (alignment - 1));
-		uintptr_t ptrval = reinterpret_cast<uintptr_t>(ptr);
+		if (alignment == 0) { alignment = 1; }
+
+		void* ptr = malloc(bytes + (alignment - 1) + sizeof(void*));
+		if (ptr == nullptr) { return nullptr; }
+
+		uintptr_t ptrval = reinterpret_cast<uintptr_t>(ptr) + sizeof(void*);
 		const auto misalignment = (alignment - (ptrval % alignment)) % alignment;
 		void* result = reinterpret_cast<void*>(ptrval + misalignment);
-		_ptr_table.emplace(result, ptr);
+		std::memcpy(reinterpret_cast<uint8_t*>(result) - sizeof(void*), &ptr, sizeof(void*));
 		return result;
 	}
 
 	void aligned_free(void* ptr)
 	{
-		free(_ptr_table[ptr]);
-		_ptr_table.erase(ptr);
+		if (ptr == nullptr) { return; }
+
+		void* original;
+		std::memcpy(&original, reinterpret_cast<uint8_t*>(ptr) - sizeof(void*), sizeof(void*));
+		free(original);
 	}
 }
\ No newline at end of file
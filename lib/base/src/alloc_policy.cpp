@@ -0,0 +1,42 @@
+#include <ien/allocators/alloc_policy.hpp>
+
+#include <ien/alloc.hpp>
+#include <ien/allocators/mmap_alloc.hpp>
+#include <ien/allocators/pool_allocator.hpp>
+
+namespace ien::allocators
+{
+    void* policy_alloc(size_t bytes, size_t alignment, alloc_policy policy)
+    {
+        switch(policy)
+        {
+            case alloc_policy::POOL:
+                return pool_alloc(bytes, alignment);
+            case alloc_policy::MMAP:
+                return mmap_alloc(bytes, alignment, false);
+            case alloc_policy::MMAP_FILE:
+                return mmap_alloc(bytes, alignment, true);
+            case alloc_policy::HEAP:
+            default:
+                return ien::aligned_alloc(bytes, alignment);
+        }
+    }
+
+    void policy_free(void* ptr, size_t bytes, alloc_policy policy)
+    {
+        switch(policy)
+        {
+            case alloc_policy::POOL:
+                pool_free(ptr);
+                break;
+            case alloc_policy::MMAP:
+            case alloc_policy::MMAP_FILE:
+                mmap_free(ptr, bytes);
+                break;
+            case alloc_policy::HEAP:
+            default:
+                ien::aligned_free(ptr);
+                break;
+        }
+    }
+}
\ No newline at end of file
@@ -1,86 +1,350 @@
 #include <ien/base64.hpp>
 
-static const unsigned char b64charset[65] =
-    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+#include <ien/platform.hpp>
 
-std::string ien::base64::encode(const uint8_t *src, size_t len)
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+#if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
+    #include <ien/internal/x86/base64_x86.hpp>
+    #define LIEN_BASE64_X86
+#elif (defined(LIEN_ARCH_ARM) || defined(LIEN_ARCH_ARM64)) && defined(LIEN_ARM_NEON)
+    #include <ien/internal/arm/neon/base64_neon.hpp>
+    #define LIEN_BASE64_NEON
+#endif
+
+namespace ien::base64
 {
-    uint8_t* out;
-    uint8_t* pos;
-    const uint8_t* end;
-    const uint8_t* in;
+    static constexpr char b64charset[65] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    static constexpr char b64charset_url[65] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+    // Character values, -1 for characters outside the alphabet
+    static constexpr std::array<int8_t, 256> make_decode_table(const char* charset)
+    {
+        std::array<int8_t, 256> result = { };
+        for (size_t i = 0; i < result.size(); ++i)
+        {
+            result[i] = -1;
+        }
+        for (size_t i = 0; i < 64; ++i)
+        {
+            result[static_cast<uint8_t>(charset[i])] = static_cast<int8_t>(i);
+        }
+        return result;
+    }
+
+    static constexpr std::array<int8_t, 256> b64decode = make_decode_table(b64charset);
+    static constexpr std::array<int8_t, 256> b64decode_url = make_decode_table(b64charset_url);
 
-    size_t olen;
+    static const char* get_charset(alphabet abc)
+    {
+        return (abc == alphabet::url_safe) ? b64charset_url : b64charset;
+    }
 
-    olen = 4 * ((len + 2) / 3); /* 3-byte blocks to 4-byte */
+    static const int8_t* get_decode_table(alphabet abc)
+    {
+        return (abc == alphabet::url_safe) ? b64decode_url.data() : b64decode.data();
+    }
 
-    if (olen < len) { return { }; }
+    [[noreturn]] static void throw_invalid(const char* reason)
+    {
+        throw std::invalid_argument(std::string("Invalid base64 input: ") + reason);
+    }
 
-    std::string result;
-    result.resize(olen);
-    out = (unsigned char*)&result[0];
+    // Returns the number of bytes the SIMD kernels consumed, a multiple of 3
+    static size_t encode_simd(const uint8_t* src, size_t len, char* out, alphabet abc)
+    {
+        #if defined(LIEN_BASE64_X86)
+            static const bool use_avx2 = platform::x86::get_feature(platform::x86::feature::AVX2);
+            static const bool use_ssse3 = platform::x86::get_feature(platform::x86::feature::SSSE3);
+            if (use_avx2)
+            {
+                return _internal::base64_encode_avx2(src, len, out, abc);
+            }
+            if (use_ssse3)
+            {
+                return _internal::base64_encode_ssse3(src, len, out, abc);
+            }
+        #elif defined(LIEN_BASE64_NEON)
+            return _internal::base64_encode_neon(src, len, out, abc);
+        #endif
+        return 0;
+    }
 
-    end = src + len;
-    in = src;
-    pos = out;
-    while(end - in >= 3)
+    // Returns the number of characters the SIMD kernels consumed, a multiple of 4
+    static size_t decode_simd(const char* src, size_t len, uint8_t* out, alphabet abc)
     {
-        *pos++ = b64charset[in[0] >> 2];
-        *pos++ = b64charset[((in[0] & 0x03) << 4) | (in[1] >> 4)];
-        *pos++ = b64charset[((in[1] & 0x0f) << 2) | (in[2] >> 6)];
-        *pos++ = b64charset[in[2] & 0x3f];
-        in += 3;
+        #if defined(LIEN_BASE64_X86)
+            static const bool use_avx2 = platform::x86::get_feature(platform::x86::feature::AVX2);
+            static const bool use_ssse3 = platform::x86::get_feature(platform::x86::feature::SSSE3);
+            if (use_avx2)
+            {
+                return _internal::base64_decode_avx2(src, len, out, abc);
+            }
+            if (use_ssse3)
+            {
+                return _internal::base64_decode_ssse3(src, len, out, abc);
+            }
+        #elif defined(LIEN_BASE64_NEON)
+            return _internal::base64_decode_neon(src, len, out, abc);
+        #endif
+        return 0;
     }
 
-    if (end - in) {
-        *pos++ = b64charset[in[0] >> 2];
-        if (end - in == 1) {
-            *pos++ = b64charset[(in[0] & 0x03) << 4];
-            *pos++ = '=';
+    // 'len' is a multiple of 3
+    static void encode_groups(const uint8_t* src, size_t len, char* out, alphabet abc)
+    {
+        const char* charset = get_charset(abc);
+
+        size_t i = encode_simd(src, len, out, abc);
+        out += (i / 3) * 4;
+        for (; i < len; i += 3)
+        {
+            const uint32_t n = (uint32_t(src[i]) << 16) | (uint32_t(src[i + 1]) << 8) | src[i + 2];
+            *out++ = charset[n >> 18];
+            *out++ = charset[(n >> 12) & 0x3F];
+            *out++ = charset[(n >> 6) & 0x3F];
+            *out++ = charset[n & 0x3F];
         }
-        else {
-            *pos++ = b64charset[((in[0] & 0x03) << 4) |
-                (in[1] >> 4)];
-            *pos++ = b64charset[(in[1] & 0x0f) << 2];
+    }
+
+    // 1 or 2 bytes to a padded quad
+    static void encode_tail(const uint8_t* src, size_t len, char* out, alphabet abc)
+    {
+        const char* charset = get_charset(abc);
+
+        const uint32_t n = (uint32_t(src[0]) << 16) | ((len > 1) ? (uint32_t(src[1]) << 8) : 0);
+        out[0] = charset[n >> 18];
+        out[1] = charset[(n >> 12) & 0x3F];
+        out[2] = (len > 1) ? charset[(n >> 6) & 0x3F] : '=';
+        out[3] = '=';
+    }
+
+    // 'len' is a multiple of 4, only the last quad may be padded and only if 'allow_padding'.
+    // Returns the number of bytes written
+    static size_t decode_quads(const char* src, size_t len, uint8_t* out, alphabet abc, bool allow_padding)
+    {
+        const int8_t* table = get_decode_table(abc);
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(src);
+
+        size_t i = decode_simd(src, len, out, abc);
+        uint8_t* dst = out + ((i / 4) * 3);
+        for (; i < len; i += 4)
+        {
+            const int32_t d0 = table[p[i]];
+            const int32_t d1 = table[p[i + 1]];
+            const int32_t d2 = table[p[i + 2]];
+            const int32_t d3 = table[p[i + 3]];
+
+            if ((d0 | d1 | d2 | d3) >= 0)
+            {
+                const uint32_t n = (uint32_t(d0) << 18) | (uint32_t(d1) << 12) | (uint32_t(d2) << 6) | uint32_t(d3);
+                *dst++ = static_cast<uint8_t>(n >> 16);
+                *dst++ = static_cast<uint8_t>(n >> 8);
+                *dst++ = static_cast<uint8_t>(n);
+                continue;
+            }
+
+            // "xx==" or "xxx=" as the very last quad
+            const bool last = (i + 4 == len);
+            if (!last || !allow_padding || p[i + 3] != '=' || (d0 | d1) < 0)
+            {
+                throw_invalid("character outside the alphabet or misplaced padding");
+            }
+
+            if (p[i + 2] == '=')
+            {
+                if ((d1 & 0x0F) != 0) { throw_invalid("non-zero trailing bits"); }
+                *dst++ = static_cast<uint8_t>((d0 << 2) | (d1 >> 4));
+            }
+            else
+            {
+                if (d2 < 0) { throw_invalid("character outside the alphabet"); }
+                if ((d2 & 0x03) != 0) { throw_invalid("non-zero trailing bits"); }
+                *dst++ = static_cast<uint8_t>((d0 << 2) | (d1 >> 4));
+                *dst++ = static_cast<uint8_t>((d1 << 4) | (d2 >> 2));
+            }
         }
-        *pos++ = '=';
+        return static_cast<size_t>(dst - out);
     }
-    return result;
-}
 
-const int32_t b64i[256] = { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 62, 63, 62, 62, 63, 52, 53, 54, 55,
-56, 57, 58, 59, 60, 61,  0,  0,  0,  0,  0,  0,  0,  0,  1,  2,  3,  4,  5,  6,
-7,  8,  9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,  0,
-0,  0,  0, 63,  0, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
-41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51 };
+    // Unpadded final 0 to 3 characters, returns the number of bytes written
+    static size_t decode_tail(const char* src, size_t len, uint8_t* out, alphabet abc)
+    {
+        if (len == 0)
+        {
+            return 0;
+        }
+        if (len == 1)
+        {
+            throw_invalid("truncated quad");
+        }
+
+        const int8_t* table = get_decode_table(abc);
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(src);
+        const int32_t d0 = table[p[0]];
+        const int32_t d1 = table[p[1]];
+        const int32_t d2 = (len > 2) ? table[p[2]] : 0;
+        if ((d0 | d1 | d2) < 0)
+        {
+            throw_invalid("character outside the alphabet or incomplete padding");
+        }
 
-std::vector<uint8_t> ien::base64::decode(const uint8_t* data, size_t len)
-{
-    unsigned char* p = (unsigned char*)data;
-    int pad = len > 0 && (len % 4 || p[len - 1] == '=');
-    const size_t L = ((len + 3) / 4 - pad) * 4;
-    std::vector<uint8_t> result;
-    result.resize(L / 4 * 3 + pad, '\0');
+        out[0] = static_cast<uint8_t>((d0 << 2) | (d1 >> 4));
+        if (len == 2)
+        {
+            if ((d1 & 0x0F) != 0) { throw_invalid("non-zero trailing bits"); }
+            return 1;
+        }
+
+        if ((d2 & 0x03) != 0) { throw_invalid("non-zero trailing bits"); }
+        out[1] = static_cast<uint8_t>((d1 << 4) | (d2 >> 2));
+        return 2;
+    }
+
+    size_t encode(const uint8_t* src, size_t len, char* out, alphabet abc)
+    {
+        const size_t tail = len % 3;
+        encode_groups(src, len - tail, out, abc);
+        if (tail != 0)
+        {
+            encode_tail(src + len - tail, tail, out + (((len - tail) / 3) * 4), abc);
+        }
+        return encoded_size(len);
+    }
+
+    std::string encode(const uint8_t* src, size_t len, alphabet abc)
+    {
+        std::string result;
+        result.resize(encoded_size(len));
+        encode(src, len, &result[0], abc);
+        return result;
+    }
 
-    for (size_t i = 0, j = 0; i < L; i += 4)
+    size_t decode(const char* src, size_t len, uint8_t* out, alphabet abc)
     {
-        int n = b64i[p[i]] << 18 | b64i[p[i + 1]] << 12 | b64i[p[i + 2]] << 6 | b64i[p[i + 3]];
-        result[j++] = n >> 16;
-        result[j++] = n >> 8 & 0xFF;
-        result[j++] = n & 0xFF;
+        const size_t tail = len % 4;
+        const size_t written = decode_quads(src, len - tail, out, abc, tail == 0);
+        return written + decode_tail(src + len - tail, tail, out + written, abc);
     }
-    if (pad)
+
+    std::vector<uint8_t> decode(const uint8_t* data, size_t len, alphabet abc)
     {
-        int n = b64i[p[L]] << 18 | b64i[p[L + 1]] << 12;
-        result[result.size() - 1] = n >> 16;
+        std::vector<uint8_t> result(decoded_size_max(len));
+        result.resize(decode(reinterpret_cast<const char*>(data), len, result.data(), abc));
+        return result;
+    }
 
-        if (len > L + 2 && p[L + 2] != '=')
+    encoder::encoder(alphabet abc)
+        : _alphabet(abc)
+    { }
+
+    size_t encoder::update(const uint8_t* src, size_t len, char* out)
+    {
+        size_t written = 0;
+        if (_pending_len > 0)
         {
-            n |= b64i[p[L + 2]] << 6;
-            result.push_back(n >> 8 & 0xFF);
+            if (_pending_len + len < 3)
+            {
+                std::copy_n(src, len, _pending + _pending_len);
+                _pending_len += len;
+                return 0;
+            }
+
+            uint8_t group[3];
+            std::copy_n(_pending, _pending_len, group);
+            const size_t taken = 3 - _pending_len;
+            std::copy_n(src, taken, group + _pending_len);
+            encode_groups(group, 3, out, _alphabet);
+            src += taken;
+            len -= taken;
+            written = 4;
+            _pending_len = 0;
         }
+
+        const size_t tail = len % 3;
+        encode_groups(src, len - tail, out + written, _alphabet);
+        std::copy_n(src + len - tail, tail, _pending);
+        _pending_len = tail;
+        return written + (((len - tail) / 3) * 4);
+    }
+
+    size_t encoder::finish(char* out)
+    {
+        if (_pending_len == 0)
+        {
+            return 0;
+        }
+
+        encode_tail(_pending, _pending_len, out, _alphabet);
+        _pending_len = 0;
+        return 4;
+    }
+
+    decoder::decoder(alphabet abc)
+        : _alphabet(abc)
+    { }
+
+    size_t decoder::update(const char* src, size_t len, uint8_t* out)
+    {
+        if (len == 0)
+        {
+            return 0;
+        }
+        if (_padded)
+        {
+            throw_invalid("data after padding");
+        }
+
+        size_t written = 0;
+        if (_pending_len > 0)
+        {
+            const size_t taken = std::min(4 - _pending_len, len);
+            std::copy_n(src, taken, _pending + _pending_len);
+            _pending_len += taken;
+            src += taken;
+            len -= taken;
+            if (_pending_len < 4)
+            {
+                return 0;
+            }
+
+            written = decode_quads(_pending, 4, out, _alphabet, true);
+            _pending_len = 0;
+            _padded = (written < 3);
+            if (_padded && len > 0)
+            {
+                throw_invalid("data after padding");
+            }
+        }
+
+        const size_t tail = len % 4;
+        const size_t quads_len = len - tail;
+        const size_t quads_written = decode_quads(src, quads_len, out + written, _alphabet, true);
+        if (quads_written < (quads_len / 4) * 3)
+        {
+            _padded = true;
+            if (tail > 0)
+            {
+                throw_invalid("data after padding");
+            }
+        }
+
+        std::copy_n(src + quads_len, tail, _pending);
+        _pending_len = tail;
+        return written + quads_written;
+    }
+
+    size_t decoder::finish(uint8_t* out)
+    {
+        const size_t pending_len = _pending_len;
+        _pending_len = 0;
+        _padded = false;
+        return decode_tail(_pending, pending_len, out, _alphabet);
     }
-    return result;
 }
\ No newline at end of file
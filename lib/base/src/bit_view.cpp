@@ -1,9 +1,155 @@
 #include <ien/bit_view.hpp>
 
 #include <ien/assert.hpp>
+#include <ien/bit_tools.hpp>
+#include <ien/platform.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
+    #include <ien/internal/x86/bit_view_x86.hpp>
+    #define LIEN_BIT_VIEW_AVX2
+#endif
 
 namespace ien
 {
+    // Below this many bytes the SIMD kernels are not worth the call
+    const size_t SIMD_MIN_BYTES = 64;
+
+    // Big-endian load of up to 8 bytes, missing bytes read as zero
+    static uint64_t load_be64(const uint8_t* ptr, size_t avail)
+    {
+        if (avail >= sizeof(uint64_t))
+        {
+            uint64_t word;
+            std::memcpy(&word, ptr, sizeof(word));
+            return byteswap64(word);
+        }
+
+        uint64_t word = 0;
+        for (size_t i = 0; i < avail; ++i)
+        {
+            word |= static_cast<uint64_t>(ptr[i]) << (56 - (i * 8));
+        }
+        return word;
+    }
+
+    static void store_be64(uint8_t* ptr, uint64_t word)
+    {
+        word = byteswap64(word);
+        std::memcpy(ptr, &word, sizeof(word));
+    }
+
+    // Bits [index, index + count) of 'data' (len bytes), count <= 64, right aligned
+    static uint64_t load_bits(const uint8_t* data, size_t len, size_t index, size_t count)
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        const size_t byte_idx = index / 8;
+        const size_t shift = index % 8;
+        uint64_t word = load_be64(data + byte_idx, len - byte_idx) << shift;
+        if (shift + count > 64)
+        {
+            word |= static_cast<uint64_t>(data[byte_idx + 8]) >> (8 - shift);
+        }
+        return word >> (64 - count);
+    }
+
+    static size_t popcount_bytes_std(const uint8_t* data, size_t len)
+    {
+        size_t result = 0;
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= len; i += sizeof(uint64_t))
+        {
+            uint64_t word;
+            std::memcpy(&word, data + i, sizeof(word));
+            result += static_cast<size_t>(popcount64(word));
+        }
+        for (; i < len; ++i)
+        {
+            result += static_cast<size_t>(popcount64(data[i]));
+        }
+        return result;
+    }
+
+    static size_t find_nonzero_byte_std(const uint8_t* data, size_t len)
+    {
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= len; i += sizeof(uint64_t))
+        {
+            uint64_t word;
+            std::memcpy(&word, data + i, sizeof(word));
+            if (word != 0)
+            {
+                break;
+            }
+        }
+        for (; i < len; ++i)
+        {
+            if (data[i] != 0)
+            {
+                return i;
+            }
+        }
+        return len;
+    }
+
+    // out[i] = (src[i] << shift) | (src[i + 1] >> (8 - shift)), eight bytes at a time
+    static void shift_bytes_left_std(const uint8_t* src, size_t len, int shift, uint8_t* out)
+    {
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) < len + 1; i += sizeof(uint64_t))
+        {
+            const uint64_t word = (load_be64(src + i, sizeof(uint64_t)) << shift) | (src[i + 8] >> (8 - shift));
+            store_be64(out + i, word);
+        }
+        for (; i < len; ++i)
+        {
+            out[i] = static_cast<uint8_t>((src[i] << shift) | (src[i + 1] >> (8 - shift)));
+        }
+    }
+
+    static size_t popcount_bytes(const uint8_t* data, size_t len)
+    {
+        #if defined(LIEN_BIT_VIEW_AVX2)
+            static const bool use_avx2 = platform::x86::get_feature(platform::x86::feature::AVX2);
+            if (use_avx2 && len >= SIMD_MIN_BYTES)
+            {
+                return _internal::popcount_bytes_avx2(data, len);
+            }
+        #endif
+        return popcount_bytes_std(data, len);
+    }
+
+    static size_t find_nonzero_byte(const uint8_t* data, size_t len)
+    {
+        #if defined(LIEN_BIT_VIEW_AVX2)
+            static const bool use_avx2 = platform::x86::get_feature(platform::x86::feature::AVX2);
+            if (use_avx2 && len >= SIMD_MIN_BYTES)
+            {
+                return _internal::find_nonzero_byte_avx2(data, len);
+            }
+        #endif
+        return find_nonzero_byte_std(data, len);
+    }
+
+    static void shift_bytes_left(const uint8_t* src, size_t len, int shift, uint8_t* out)
+    {
+        #if defined(LIEN_BIT_VIEW_AVX2)
+            static const bool use_avx2 = platform::x86::get_feature(platform::x86::feature::AVX2);
+            if (use_avx2 && len >= SIMD_MIN_BYTES)
+            {
+                _internal::shift_bytes_left_avx2(src, len, shift, out);
+                return;
+            }
+        #endif
+        shift_bytes_left_std(src, len, shift, out);
+    }
+
     bool bit_view::operator[](size_t index) const
     {
         LIEN_DEBUG_ASSERT_MSG((index < (_len * 8)), "Out of range!");
@@ -23,11 +169,181 @@ namespace ien
 
     ien::fixed_vector<bool> bit_view::get_bits(size_t index, size_t count) const
     {
+        LIEN_DEBUG_ASSERT_MSG((index + count <= size()), "Out of range!");
+
         ien::fixed_vector<bool> result(count);
-        for(size_t i = 0; i < count; ++i)
+        for(size_t i = 0; i < count; i += 64)
         {
-            result[i] = this->operator[](index++);
+            const size_t n = std::min<size_t>(64, count - i);
+            const uint64_t bits = load_bits(_data_ptr, _len, index + i, n);
+            for(size_t j = 0; j < n; ++j)
+            {
+                result[i + j] = ((bits >> (n - 1 - j)) & 1) != 0;
+            }
         }
         return result;
     }
+
+    uint64_t bit_view::extract(size_t index, size_t count) const
+    {
+        LIEN_DEBUG_ASSERT_MSG((count <= 64), "At most 64 bits can be extracted at once!");
+        LIEN_DEBUG_ASSERT_MSG((index + count <= size()), "Out of range!");
+
+        return load_bits(_data_ptr, _len, index, count);
+    }
+
+    void bit_view::insert(size_t index, size_t count, uint64_t value)
+    {
+        LIEN_DEBUG_ASSERT_MSG((count <= 64), "At most 64 bits can be inserted at once!");
+        LIEN_DEBUG_ASSERT_MSG((index + count <= size()), "Out of range!");
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        size_t byte_idx = index / 8;
+        const size_t shift = index % 8;
+
+        // Single read-modify-write of the whole word when the range fits
+        if (shift + count <= 64 && (_len - byte_idx) >= sizeof(uint64_t))
+        {
+            const size_t low = 64 - shift - count;
+            const uint64_t mask = (~uint64_t(0) >> (64 - count)) << low;
+            const uint64_t word = load_be64(_data_ptr + byte_idx, sizeof(uint64_t));
+            store_be64(_data_ptr + byte_idx, (word & ~mask) | ((value << low) & mask));
+            return;
+        }
+
+        // Byte by byte near the end of the view, or when the range spans 9 bytes
+        size_t remaining = count;
+        size_t bit_off = shift;
+        while (remaining > 0)
+        {
+            const size_t n = std::min<size_t>(8 - bit_off, remaining);
+            const size_t low = 8 - bit_off - n;
+            const uint8_t mask = static_cast<uint8_t>(((1u << n) - 1) << low);
+            const uint8_t chunk = static_cast<uint8_t>((value >> (remaining - n)) << low);
+            _data_ptr[byte_idx] = static_cast<uint8_t>((_data_ptr[byte_idx] & ~mask) | (chunk & mask));
+            remaining -= n;
+            bit_off = 0;
+            ++byte_idx;
+        }
+    }
+
+    void bit_view::extract_bytes(size_t index, size_t count, uint8_t* out) const
+    {
+        LIEN_DEBUG_ASSERT_MSG((index + count <= size()), "Out of range!");
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        const size_t byte_idx = index / 8;
+        const int shift = static_cast<int>(index % 8);
+        const size_t out_len = (count + 7) / 8;
+
+        if (shift == 0)
+        {
+            std::memcpy(out, _data_ptr + byte_idx, out_len);
+        }
+        else
+        {
+            // Every output byte but a possible last one has a following source byte
+            const size_t avail = _len - byte_idx;
+            const size_t shifted = std::min(out_len, avail - 1);
+            shift_bytes_left(_data_ptr + byte_idx, shifted, shift, out);
+            if (shifted < out_len)
+            {
+                out[shifted] = static_cast<uint8_t>(_data_ptr[byte_idx + shifted] << shift);
+            }
+        }
+
+        if (count % 8 != 0)
+        {
+            out[out_len - 1] &= static_cast<uint8_t>(0xFF << (8 - (count % 8)));
+        }
+    }
+
+    void bit_view::insert_bytes(size_t index, size_t count, const uint8_t* src)
+    {
+        LIEN_DEBUG_ASSERT_MSG((index + count <= size()), "Out of range!");
+
+        const size_t src_len = (count + 7) / 8;
+        if (index % 8 == 0)
+        {
+            const size_t full = count / 8;
+            std::memcpy(_data_ptr + (index / 8), src, full);
+            if (count % 8 != 0)
+            {
+                insert(index + (full * 8), count % 8, static_cast<uint64_t>(src[full]) >> (8 - (count % 8)));
+            }
+            return;
+        }
+
+        // Unaligned destination, 56 bits per word sized read-modify-write
+        size_t done = 0;
+        for (; done + 56 <= count; done += 56)
+        {
+            insert(index + done, 56, load_bits(src, src_len, done, 56));
+        }
+        if (done < count)
+        {
+            insert(index + done, count - done, load_bits(src, src_len, done, count - done));
+        }
+    }
+
+    size_t bit_view::popcount() const
+    {
+        return popcount_bytes(_data_ptr, _len);
+    }
+
+    size_t bit_view::popcount(size_t index, size_t count) const
+    {
+        LIEN_DEBUG_ASSERT_MSG((index + count <= size()), "Out of range!");
+
+        size_t result = 0;
+
+        // Leading bits up to the first byte boundary
+        const size_t head = std::min(count, (8 - (index % 8)) % 8);
+        if (head > 0)
+        {
+            result += static_cast<size_t>(popcount64(load_bits(_data_ptr, _len, index, head)));
+            index += head;
+            count -= head;
+        }
+
+        const size_t full = count / 8;
+        result += popcount_bytes(_data_ptr + (index / 8), full);
+
+        if (count % 8 != 0)
+        {
+            result += static_cast<size_t>(popcount64(load_bits(_data_ptr, _len, index + (full * 8), count % 8)));
+        }
+        return result;
+    }
+
+    size_t bit_view::find_first_set(size_t index) const
+    {
+        if (index >= size())
+        {
+            return npos;
+        }
+
+        size_t byte_idx = index / 8;
+        const uint8_t first = static_cast<uint8_t>(_data_ptr[byte_idx] & (0xFF >> (index % 8)));
+        if (first == 0)
+        {
+            ++byte_idx;
+            byte_idx += find_nonzero_byte(_data_ptr + byte_idx, _len - byte_idx);
+            if (byte_idx == _len)
+            {
+                return npos;
+            }
+        }
+
+        const uint8_t byte = (first != 0) ? first : _data_ptr[byte_idx];
+        return (byte_idx * 8) + static_cast<size_t>(count_leading_zeros64(byte) - 56);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include <ien/internal/arm/neon/base64_neon.hpp>
+
+#if defined(LIEN_ARM_NEON)
+#include <ien/internal/base64_luts.hpp>
+
+#include <arm_neon.h>
+
+namespace ien::_internal
+{
+    // 16 entry table lookup, indices past 15 give 0. vtbl2 keeps this ARMv7 compatible
+    static inline uint8x16_t lookup16(uint8x8x2_t table, uint8x16_t idx)
+    {
+        return vcombine_u8(vtbl2_u8(table, vget_low_u8(idx)), vtbl2_u8(table, vget_high_u8(idx)));
+    }
+
+    static inline uint8x8x2_t load_lut(const void* lut)
+    {
+        const uint8_t* ptr = static_cast<const uint8_t*>(lut);
+        return { { vld1_u8(ptr), vld1_u8(ptr + 8) } };
+    }
+
+    static inline uint8x16_t encode_translate(uint8x16_t indices, uint8x8x2_t shift_lut)
+    {
+        uint8x16_t vclass = vqsubq_u8(indices, vdupq_n_u8(51));
+        vclass = vorrq_u8(vclass, vandq_u8(vcltq_u8(indices, vdupq_n_u8(26)), vdupq_n_u8(13)));
+        return vaddq_u8(indices, lookup16(shift_lut, vclass));
+    }
+
+    size_t base64_encode_neon(const uint8_t* src, size_t len, char* out, base64::alphabet abc)
+    {
+        const base64_luts& luts = get_base64_luts(abc);
+        const uint8x8x2_t shift_lut = load_lut(luts.encode_shift);
+        const uint8x16_t vmask6 = vdupq_n_u8(0x3F);
+
+        size_t i = 0;
+        for (; i + 48 <= len; i += 48)
+        {
+            const uint8x16x3_t v = vld3q_u8(src + i);
+
+            uint8x16x4_t indices;
+            indices.val[0] = vshrq_n_u8(v.val[0], 2);
+            indices.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(v.val[0], 4), vshrq_n_u8(v.val[1], 4)), vmask6);
+            indices.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(v.val[1], 2), vshrq_n_u8(v.val[2], 6)), vmask6);
+            indices.val[3] = vandq_u8(v.val[2], vmask6);
+
+            uint8x16x4_t chars;
+            for (int c = 0; c < 4; ++c)
+            {
+                chars.val[c] = encode_translate(indices.val[c], shift_lut);
+            }
+            vst4q_u8(reinterpret_cast<uint8_t*>(out + ((i / 3) * 4)), chars);
+        }
+        return i;
+    }
+
+    size_t base64_decode_neon(const char* src, size_t len, uint8_t* out, base64::alphabet abc)
+    {
+        const base64_luts& luts = get_base64_luts(abc);
+        const uint8x8x2_t lut_lo = load_lut(luts.decode_lo);
+        const uint8x8x2_t lut_hi = load_lut(luts.decode_hi);
+        const uint8x8x2_t lut_roll = load_lut(luts.decode_roll);
+        const uint8x16_t vspecial = vdupq_n_u8(luts.decode_special);
+        const uint8x16_t vnibble_mask = vdupq_n_u8(0x0F);
+
+        size_t i = 0;
+        for (; i + 64 <= len; i += 64)
+        {
+            const uint8x16x4_t v = vld4q_u8(reinterpret_cast<const uint8_t*>(src + i));
+
+            uint8x16x4_t values;
+            uint8x16_t vinvalid = vdupq_n_u8(0);
+            for (int c = 0; c < 4; ++c)
+            {
+                const uint8x16_t vhi = vshrq_n_u8(v.val[c], 4);
+                const uint8x16_t vlo = vandq_u8(v.val[c], vnibble_mask);
+                vinvalid = vorrq_u8(vinvalid, vandq_u8(lookup16(lut_lo, vlo), lookup16(lut_hi, vhi)));
+
+                const uint8x16_t vroll_idx = vaddq_u8(vhi, vandq_u8(vceqq_u8(v.val[c], vspecial), vdupq_n_u8(8)));
+                values.val[c] = vaddq_u8(v.val[c], lookup16(lut_roll, vroll_idx));
+            }
+
+            const uint64x2_t vinvalid64 = vreinterpretq_u64_u8(vinvalid);
+            if ((vgetq_lane_u64(vinvalid64, 0) | vgetq_lane_u64(vinvalid64, 1)) != 0)
+            {
+                break;
+            }
+
+            uint8x16x3_t bytes;
+            bytes.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2), vshrq_n_u8(values.val[1], 4));
+            bytes.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4), vshrq_n_u8(values.val[2], 2));
+            bytes.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+            vst3q_u8(out + ((i / 4) * 3), bytes);
+        }
+        return i;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include <ien/internal/x86/base64_x86.hpp>
+
+#if defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)
+#include <ien/internal/base64_luts.hpp>
+
+#include <immintrin.h>
+
+#define LOADU_SI128_CONST(addr) \
+    _mm_loadu_si128(reinterpret_cast<const __m128i*>(addr))
+
+#define LOADU_SI256_CONST(addr) \
+    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(addr))
+
+#define STOREU_SI256(addr, v) \
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(addr), v)
+
+#define BROADCAST_LUT(lut) \
+    _mm256_broadcastsi128_si256(LOADU_SI128_CONST(lut))
+
+namespace ien::_internal
+{
+    size_t base64_encode_avx2(const uint8_t* src, size_t len, char* out, base64::alphabet abc)
+    {
+        const base64_luts& luts = get_base64_luts(abc);
+        const __m256i vshift_lut = BROADCAST_LUT(luts.encode_shift);
+        const __m256i vsplit_shuffle = _mm256_setr_epi8(
+            1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+            1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10
+        );
+
+        // Every lane gets 12 bytes of its own (Mula), loads stay within src[0, len)
+        size_t i = 0;
+        for (; i + 28 <= len; i += 24)
+        {
+            __m256i v = _mm256_castsi128_si256(LOADU_SI128_CONST(src + i));
+            v = _mm256_inserti128_si256(v, LOADU_SI128_CONST(src + i + 12), 1);
+            v = _mm256_shuffle_epi8(v, vsplit_shuffle);
+
+            const __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(v, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+            const __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(v, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+            const __m256i indices = _mm256_or_si256(t0, t1);
+
+            __m256i vclass = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+            const __m256i vupper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+            vclass = _mm256_or_si256(vclass, _mm256_and_si256(vupper, _mm256_set1_epi8(13)));
+
+            STOREU_SI256(out + ((i / 3) * 4), _mm256_add_epi8(indices, _mm256_shuffle_epi8(vshift_lut, vclass)));
+        }
+        return i;
+    }
+
+    size_t base64_decode_avx2(const char* src, size_t len, uint8_t* out, base64::alphabet abc)
+    {
+        const base64_luts& luts = get_base64_luts(abc);
+        const __m256i vlut_lo = BROADCAST_LUT(luts.decode_lo);
+        const __m256i vlut_hi = BROADCAST_LUT(luts.decode_hi);
+        const __m256i vlut_roll = BROADCAST_LUT(luts.decode_roll);
+        const __m256i vspecial = _mm256_set1_epi8(static_cast<char>(luts.decode_special));
+        const __m256i vnibble_mask = _mm256_set1_epi8(0x0F);
+        const __m256i vpack_shuffle = _mm256_setr_epi8(
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+        );
+        const __m256i vpack_permute = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+        size_t i = 0;
+        for (; i + 32 <= len; i += 32)
+        {
+            const __m256i v = LOADU_SI256_CONST(src + i);
+            const __m256i vhi = _mm256_and_si256(_mm256_srli_epi16(v, 4), vnibble_mask);
+            const __m256i vlo = _mm256_and_si256(v, vnibble_mask);
+
+            if (!_mm256_testz_si256(_mm256_shuffle_epi8(vlut_lo, vlo), _mm256_shuffle_epi8(vlut_hi, vhi)))
+            {
+                break;
+            }
+
+            const __m256i vroll_idx = _mm256_add_epi8(vhi, _mm256_and_si256(_mm256_cmpeq_epi8(v, vspecial), _mm256_set1_epi8(8)));
+            const __m256i values = _mm256_add_epi8(v, _mm256_shuffle_epi8(vlut_roll, vroll_idx));
+
+            // 4x6 bits to 3 bytes per 32 bit lane, big endian, then 12 bytes per lane packed to the low 24
+            __m256i merged = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+            merged = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+            const __m256i packed = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(merged, vpack_shuffle), vpack_permute);
+
+            uint8_t* dst = out + ((i / 4) * 3);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm256_castsi256_si128(packed));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 16), _mm256_extracti128_si256(packed, 1));
+        }
+        return i;
+    }
+}
+
+#endif
\ No newline at end of file
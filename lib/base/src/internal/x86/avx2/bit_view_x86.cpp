@@ -0,0 +1,103 @@
+#include <ien/internal/x86/bit_view_x86.hpp>
+
+#if defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)
+#include <cstring>
+#include <immintrin.h>
+
+#define AVX_STRIDE 32
+
+#define LOADU_SI256_CONST(addr) \
+    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(addr))
+
+#define STOREU_SI256(addr, v) \
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(addr), v)
+
+namespace ien::_internal
+{
+    // Per byte bit counts, summed into the four 64-bit lanes
+    static inline __m256i popcount_sad(__m256i v, __m256i vlut, __m256i vlo_mask)
+    {
+        __m256i vlo = _mm256_and_si256(v, vlo_mask);
+        __m256i vhi = _mm256_and_si256(_mm256_srli_epi16(v, 4), vlo_mask);
+        __m256i vcount = _mm256_add_epi8(_mm256_shuffle_epi8(vlut, vlo), _mm256_shuffle_epi8(vlut, vhi));
+        return _mm256_sad_epu8(vcount, _mm256_setzero_si256());
+    }
+
+    // Nibble lookup popcount, byte counts are summed with SAD every 32 bytes.
+    // The tail goes through the same path from a zero padded block
+    size_t popcount_bytes_avx2(const uint8_t* data, size_t len)
+    {
+        const __m256i vlut = _mm256_setr_epi8(
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+        );
+        const __m256i vlo_mask = _mm256_set1_epi8(0x0F);
+
+        __m256i vtotal = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + AVX_STRIDE <= len; i += AVX_STRIDE)
+        {
+            vtotal = _mm256_add_epi64(vtotal, popcount_sad(LOADU_SI256_CONST(data + i), vlut, vlo_mask));
+        }
+
+        if (i < len)
+        {
+            alignas(AVX_STRIDE) uint8_t tail[AVX_STRIDE] = { };
+            std::memcpy(tail, data + i, len - i);
+            vtotal = _mm256_add_epi64(vtotal, popcount_sad(_mm256_load_si256(reinterpret_cast<const __m256i*>(tail)), vlut, vlo_mask));
+        }
+
+        alignas(AVX_STRIDE) uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), vtotal);
+        return static_cast<size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+    }
+
+    size_t find_nonzero_byte_avx2(const uint8_t* data, size_t len)
+    {
+        const __m256i vzero = _mm256_setzero_si256();
+
+        size_t i = 0;
+        for (; i + AVX_STRIDE <= len; i += AVX_STRIDE)
+        {
+            __m256i v = LOADU_SI256_CONST(data + i);
+            const uint32_t zero_mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, vzero)));
+            if (zero_mask != 0xFFFFFFFF)
+            {
+                for (; data[i] == 0; ++i) { }
+                return i;
+            }
+        }
+        for (; i < len; ++i)
+        {
+            if (data[i] != 0)
+            {
+                return i;
+            }
+        }
+        return len;
+    }
+
+    void shift_bytes_left_avx2(const uint8_t* src, size_t len, int shift, uint8_t* out)
+    {
+        // No 8-bit shifts, 16-bit lanes are shifted and the bits crossing into the neighbour byte masked off
+        const __m128i vshl = _mm_cvtsi32_si128(shift);
+        const __m128i vshr = _mm_cvtsi32_si128(8 - shift);
+        const __m256i vhi_mask = _mm256_set1_epi8(static_cast<char>(0xFF << shift));
+        const __m256i vlo_mask = _mm256_set1_epi8(static_cast<char>(0xFF >> (8 - shift)));
+
+        size_t i = 0;
+        for (; i + AVX_STRIDE <= len; i += AVX_STRIDE)
+        {
+            __m256i vcur = LOADU_SI256_CONST(src + i);
+            __m256i vnext = LOADU_SI256_CONST(src + i + 1);
+            __m256i vhi = _mm256_and_si256(_mm256_sll_epi16(vcur, vshl), vhi_mask);
+            __m256i vlo = _mm256_and_si256(_mm256_srl_epi16(vnext, vshr), vlo_mask);
+            STOREU_SI256(out + i, _mm256_or_si256(vhi, vlo));
+        }
+        for (; i < len; ++i)
+        {
+            out[i] = static_cast<uint8_t>((src[i] << shift) | (src[i + 1] >> (8 - shift)));
+        }
+    }
+}
+#endif
\ No newline at end of file
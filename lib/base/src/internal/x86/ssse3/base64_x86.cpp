@@ -0,0 +1,89 @@
+#include <ien/internal/x86/base64_x86.hpp>
+
+#if defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)
+#include <ien/internal/base64_luts.hpp>
+
+#include <cstring>
+#include <immintrin.h>
+
+#define LOADU_SI128_CONST(addr) \
+    _mm_loadu_si128(reinterpret_cast<const __m128i*>(addr))
+
+#define STOREU_SI128(addr, v) \
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(addr), v)
+
+namespace ien::_internal
+{
+    // 12 input bytes (at 0..11) to 16 six bit indices, one per byte (Mula)
+    static inline __m128i encode_split_ssse3(__m128i v)
+    {
+        v = _mm_shuffle_epi8(v, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+        const __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(v, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+        const __m128i t1 = _mm_mullo_epi16(_mm_and_si128(v, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+        return _mm_or_si128(t0, t1);
+    }
+
+    static inline __m128i encode_translate_ssse3(__m128i indices, __m128i vshift_lut)
+    {
+        __m128i vclass = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        const __m128i vupper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        vclass = _mm_or_si128(vclass, _mm_and_si128(vupper, _mm_set1_epi8(13)));
+        return _mm_add_epi8(indices, _mm_shuffle_epi8(vshift_lut, vclass));
+    }
+
+    size_t base64_encode_ssse3(const uint8_t* src, size_t len, char* out, base64::alphabet abc)
+    {
+        const base64_luts& luts = get_base64_luts(abc);
+        const __m128i vshift_lut = LOADU_SI128_CONST(luts.encode_shift);
+
+        // 16 byte loads, 12 bytes consumed
+        size_t i = 0;
+        for (; i + 16 <= len; i += 12)
+        {
+            const __m128i indices = encode_split_ssse3(LOADU_SI128_CONST(src + i));
+            STOREU_SI128(out + ((i / 3) * 4), encode_translate_ssse3(indices, vshift_lut));
+        }
+        return i;
+    }
+
+    size_t base64_decode_ssse3(const char* src, size_t len, uint8_t* out, base64::alphabet abc)
+    {
+        const base64_luts& luts = get_base64_luts(abc);
+        const __m128i vlut_lo = LOADU_SI128_CONST(luts.decode_lo);
+        const __m128i vlut_hi = LOADU_SI128_CONST(luts.decode_hi);
+        const __m128i vlut_roll = LOADU_SI128_CONST(luts.decode_roll);
+        const __m128i vspecial = _mm_set1_epi8(static_cast<char>(luts.decode_special));
+        const __m128i vnibble_mask = _mm_set1_epi8(0x0F);
+        const __m128i vpack_shuffle = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+        size_t i = 0;
+        for (; i + 16 <= len; i += 16)
+        {
+            const __m128i v = LOADU_SI128_CONST(src + i);
+            const __m128i vhi = _mm_and_si128(_mm_srli_epi16(v, 4), vnibble_mask);
+            const __m128i vlo = _mm_and_si128(v, vnibble_mask);
+
+            const __m128i vinvalid = _mm_and_si128(_mm_shuffle_epi8(vlut_lo, vlo), _mm_shuffle_epi8(vlut_hi, vhi));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(vinvalid, _mm_setzero_si128())) != 0xFFFF)
+            {
+                break;
+            }
+
+            const __m128i vroll_idx = _mm_add_epi8(vhi, _mm_and_si128(_mm_cmpeq_epi8(v, vspecial), _mm_set1_epi8(8)));
+            const __m128i values = _mm_add_epi8(v, _mm_shuffle_epi8(vlut_roll, vroll_idx));
+
+            // 4x6 bits to 3 bytes per 32 bit lane, big endian, then packed to the low 12 bytes
+            __m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+            merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+            const __m128i packed = _mm_shuffle_epi8(merged, vpack_shuffle);
+
+            uint8_t* dst = out + ((i / 4) * 3);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), packed);
+            const uint32_t tail = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(packed, 8)));
+            std::memcpy(dst + 8, &tail, sizeof(tail));
+        }
+        return i;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include <ien/allocators/mmap_alloc.hpp>
+
+#include <ien/alloc.hpp>
+#include <ien/filesystem.hpp>
+#include <ien/platform.hpp>
+
+#include <cinttypes>
+#include <mutex>
+#include <vector>
+
+#if defined(LIEN_OS_UNIX) || defined(LIEN_OS_MAC)
+    #define LIEN_HAS_MMAP
+    #include <sys/mman.h>
+    #include <unistd.h>
+    #include <cstdlib>
+#endif
+
+namespace ien::allocators
+{
+#ifdef LIEN_HAS_MMAP
+    // Transparent huge pages are only used for 2MiB aligned ranges
+    constexpr size_t HUGE_PAGE_SIZE = size_t(2) << 20;
+
+    // Only accessed through set_mmap_file_directory and get_mmap_file_directory
+    static std::mutex mmap_dir_mux;
+    static std::string mmap_dir;
+
+    static std::string get_mmap_file_directory()
+    {
+        std::lock_guard lock(mmap_dir_mux);
+        return mmap_dir;
+    }
+
+    static size_t mapping_size(size_t bytes)
+    {
+        return ((bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE) * HUGE_PAGE_SIZE;
+    }
+
+    static void* map_anonymous(size_t len)
+    {
+        // Over-map by one huge page and trim both ends to get an aligned range
+        const size_t map_len = len + HUGE_PAGE_SIZE;
+        void* ptr = mmap(nullptr, map_len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED) { return nullptr; }
+
+        const uintptr_t begin = reinterpret_cast<uintptr_t>(ptr);
+        const uintptr_t aligned = ((begin + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE) * HUGE_PAGE_SIZE;
+        const size_t head = aligned - begin;
+        const size_t tail = map_len - head - len;
+
+        if (head != 0) { munmap(ptr, head); }
+        if (tail != 0) { munmap(reinterpret_cast<void*>(aligned + len), tail); }
+
+        void* result = reinterpret_cast<void*>(aligned);
+        #ifdef MADV_HUGEPAGE
+            madvise(result, len, MADV_HUGEPAGE);
+        #endif
+        return result;
+    }
+
+    static void* map_file(size_t len)
+    {
+        std::string path = get_mmap_file_directory();
+        if (path.empty()) { path = LIEN_FS::temp_directory_path().string(); }
+        path += "/lien_mmap_XXXXXX";
+
+        std::vector<char> path_buff(path.begin(), path.end());
+        path_buff.push_back('\0');
+
+        int fd = mkstemp(path_buff.data());
+        if (fd == -1) { return nullptr; }
+
+        // The mapping keeps the file alive, it is removed once unmapped
+        unlink(path_buff.data());
+
+        void* ptr = MAP_FAILED;
+        if (ftruncate(fd, static_cast<off_t>(len)) == 0)
+        {
+            ptr = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        close(fd);
+
+        return (ptr == MAP_FAILED) ? nullptr : ptr;
+    }
+#endif
+
+    void* mmap_alloc(size_t bytes, size_t alignment, bool file_backed)
+    {
+#ifdef LIEN_HAS_MMAP
+        if (bytes >= LIEN_MMAP_THRESHOLD)
+        {
+            const size_t max_alignment = file_backed
+                ? static_cast<size_t>(sysconf(_SC_PAGESIZE))
+                : HUGE_PAGE_SIZE;
+
+            if (alignment > max_alignment) { return nullptr; }
+
+            const size_t len = mapping_size(bytes);
+            return file_backed ? map_file(len) : map_anonymous(len);
+        }
+#endif
+        return ien::aligned_alloc(bytes, alignment);
+    }
+
+    void mmap_free(void* ptr, size_t bytes)
+    {
+        if (ptr == nullptr) { return; }
+
+#ifdef LIEN_HAS_MMAP
+        if (bytes >= LIEN_MMAP_THRESHOLD)
+        {
+            munmap(ptr, mapping_size(bytes));
+            return;
+        }
+#endif
+        ien::aligned_free(ptr);
+    }
+
+    void set_mmap_file_directory(const std::string& path)
+    {
+#ifdef LIEN_HAS_MMAP
+        std::lock_guard lock(mmap_dir_mux);
+        mmap_dir = path;
+#endif
+    }
+}
\ No newline at end of file
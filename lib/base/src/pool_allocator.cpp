@@ -0,0 +1,244 @@
+#include <ien/allocators/pool_allocator.hpp>
+
+#include <ien/alloc.hpp>
+
+#include <array>
+#include <cinttypes>
+#include <mutex>
+
+namespace ien::allocators
+{
+    namespace _internal
+    {
+        // Size classes: 64 bytes, then four classes per power of two up to MAX_POOLED_SIZE
+        constexpr size_t MIN_POOLED_SIZE = 64;
+        constexpr size_t MAX_POOLED_SIZE = size_t(1) << 28;
+        constexpr size_t CLASS_COUNT = 89;
+
+        // Pooled blocks are cache line aligned, the header lives in the line right before the block
+        constexpr size_t POOL_ALIGNMENT = LIEN_CACHE_LINE_SIZE;
+
+        // Upper bound of bytes kept per size class in each thread's cache
+        constexpr size_t THREAD_CACHE_BYTES = size_t(4) << 20;
+
+        constexpr uint32_t UNPOOLED_CLASS = UINT32_MAX;
+
+        struct block_header
+        {
+            uint32_t size_class;
+            size_t offset;
+        };
+
+        static_assert(sizeof(block_header) <= POOL_ALIGNMENT);
+
+        struct free_block
+        {
+            free_block* next;
+        };
+
+        static size_t class_index(size_t bytes)
+        {
+            if (bytes <= MIN_POOLED_SIZE) { return 0; }
+
+            const size_t v = bytes - 1;
+            size_t lg = 0;
+            while ((v >> (lg + 1)) != 0) { ++lg; }
+
+            const size_t sub = (v >> (lg - 2)) & 3;
+            return ((lg - 6) * 4) + sub + 1;
+        }
+
+        static size_t class_size(size_t index)
+        {
+            if (index == 0) { return MIN_POOLED_SIZE; }
+
+            const size_t lg = ((index - 1) / 4) + 6;
+            const size_t sub = (index - 1) % 4;
+            return (4 + sub + 1) << (lg - 2);
+        }
+
+        static block_header* header_of(void* ptr)
+        {
+            return reinterpret_cast<block_header*>(reinterpret_cast<uint8_t*>(ptr) - sizeof(block_header));
+        }
+
+        static void* system_alloc(size_t bytes, size_t alignment, uint32_t size_class)
+        {
+            const size_t offset = ((sizeof(block_header) + alignment - 1) / alignment) * alignment;
+            uint8_t* raw = ien::aligned_alloc(bytes + offset, alignment);
+            if (raw == nullptr) { return nullptr; }
+
+            void* result = raw + offset;
+            *header_of(result) = { size_class, offset };
+            return result;
+        }
+
+        static void system_free(void* ptr)
+        {
+            ien::aligned_free(reinterpret_cast<uint8_t*>(ptr) - header_of(ptr)->offset);
+        }
+
+        struct depot_bin
+        {
+            std::mutex mux;
+            free_block* head = nullptr;
+        };
+
+        class pool_depot
+        {
+        private:
+            std::array<depot_bin, CLASS_COUNT> _bins;
+
+        public:
+            ~pool_depot() { trim(); }
+
+            void push(size_t index, free_block* block)
+            {
+                std::lock_guard lock(_bins[index].mux);
+                block->next = _bins[index].head;
+                _bins[index].head = block;
+            }
+
+            free_block* pop(size_t index)
+            {
+                std::lock_guard lock(_bins[index].mux);
+                free_block* block = _bins[index].head;
+                if (block != nullptr) { _bins[index].head = block->next; }
+                return block;
+            }
+
+            void trim()
+            {
+                for (auto& bin : _bins)
+                {
+                    free_block* block;
+                    {
+                        std::lock_guard lock(bin.mux);
+                        block = bin.head;
+                        bin.head = nullptr;
+                    }
+
+                    while (block != nullptr)
+                    {
+                        free_block* next = block->next;
+                        system_free(block);
+                        block = next;
+                    }
+                }
+            }
+        };
+
+        static pool_depot& global_depot()
+        {
+            static pool_depot depot;
+            return depot;
+        }
+
+        // Set once the calling thread's cache is gone (thread exit), from then on blocks go straight to the depot
+        static thread_local bool tl_cache_destroyed = false;
+
+        class thread_cache
+        {
+        private:
+            pool_depot& _depot;
+            std::array<free_block*, CLASS_COUNT> _heads = {};
+            std::array<size_t, CLASS_COUNT> _counts = {};
+
+        public:
+            thread_cache()
+                : _depot(global_depot())
+            { }
+
+            ~thread_cache()
+            {
+                flush();
+                tl_cache_destroyed = true;
+            }
+
+            void* pop(size_t index)
+            {
+                free_block* block = _heads[index];
+                if (block != nullptr)
+                {
+                    _heads[index] = block->next;
+                    --_counts[index];
+                    return block;
+                }
+                return _depot.pop(index);
+            }
+
+            void push(size_t index, free_block* block)
+            {
+                if ((_counts[index] + 1) * class_size(index) > THREAD_CACHE_BYTES && _counts[index] > 0)
+                {
+                    _depot.push(index, block);
+                    return;
+                }
+
+                block->next = _heads[index];
+                _heads[index] = block;
+                ++_counts[index];
+            }
+
+            void flush()
+            {
+                for (size_t i = 0; i < CLASS_COUNT; ++i)
+                {
+                    while (_heads[i] != nullptr)
+                    {
+                        free_block* next = _heads[i]->next;
+                        _depot.push(i, _heads[i]);
+                        _heads[i] = next;
+                    }
+                    _counts[i] = 0;
+                }
+            }
+        };
+
+        static thread_cache& local_cache()
+        {
+            thread_local thread_cache cache;
+            return cache;
+        }
+    }
+
+    using namespace _internal;
+
+    void* pool_alloc(size_t bytes, size_t alignment)
+    {
+        if (alignment == 0) { alignment = 1; }
+
+        if (bytes > MAX_POOLED_SIZE || alignment > POOL_ALIGNMENT || (POOL_ALIGNMENT % alignment) != 0)
+        {
+            return system_alloc(bytes, alignment, UNPOOLED_CLASS);
+        }
+
+        const size_t index = class_index(bytes);
+        void* block = tl_cache_destroyed
+            ? global_depot().pop(index)
+            : local_cache().pop(index);
+
+        if (block != nullptr) { return block; }
+        return system_alloc(class_size(index), POOL_ALIGNMENT, static_cast<uint32_t>(index));
+    }
+
+    void pool_free(void* ptr)
+    {
+        if (ptr == nullptr) { return; }
+
+        const uint32_t index = header_of(ptr)->size_class;
+        if (index == UNPOOLED_CLASS || tl_cache_destroyed)
+        {
+            system_free(ptr);
+            return;
+        }
+
+        local_cache().push(index, reinterpret_cast<free_block*>(ptr));
+    }
+
+    void pool_trim()
+    {
+        if (!tl_cache_destroyed) { local_cache().flush(); }
+        global_depot().trim();
+    }
+}
\ No newline at end of file
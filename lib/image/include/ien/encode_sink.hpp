@@ -0,0 +1,127 @@
+#pragma once
+
+#include <ien/base64.hpp>
+#include <ien/fixed_vector.hpp>
+
+#include <cinttypes>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+
+namespace ien
+{
+    // Destination of encoded image bytes. Encoders call write() with consecutive chunks of any size,
+    // then flush() once when done. Failures are reported by throwing
+    class encode_sink
+    {
+    public:
+        virtual ~encode_sink() = default;
+
+        virtual void write(const uint8_t* data, size_t len) = 0;
+        virtual void flush() { }
+    };
+
+    // Appends into an owned buffer with geometric growth. clear() keeps the capacity,
+    // so repeated encodes into the same sink stop allocating once it is large enough
+    class growable_buffer_sink : public encode_sink
+    {
+    private:
+        uint8_t* _data = nullptr;
+        size_t _size = 0;
+        size_t _capacity = 0;
+
+    public:
+        growable_buffer_sink() = default;
+        explicit growable_buffer_sink(size_t initial_capacity);
+        ~growable_buffer_sink();
+
+        growable_buffer_sink(const growable_buffer_sink&) = delete;
+        growable_buffer_sink(growable_buffer_sink&& mv_src) noexcept;
+
+        growable_buffer_sink& operator=(const growable_buffer_sink&) = delete;
+        growable_buffer_sink& operator=(growable_buffer_sink&& mv_src) noexcept;
+
+        void write(const uint8_t* data, size_t len) override;
+
+        void reserve(size_t capacity);
+        void clear() noexcept;
+
+        inline const uint8_t* data() const noexcept { return _data; }
+        inline size_t size() const noexcept { return _size; }
+        inline size_t capacity() const noexcept { return _capacity; }
+
+        // Hands the written bytes over without copying them, the sink is left empty with no capacity
+        [[nodiscard]] fixed_vector<uint8_t> release();
+    };
+
+    // Writes into a caller-owned buffer, which is never reallocated.
+    // Throws std::length_error when the encoded data doesn't fit
+    class fixed_buffer_sink : public encode_sink
+    {
+    private:
+        uint8_t* _data;
+        size_t _size = 0;
+        size_t _capacity;
+
+    public:
+        fixed_buffer_sink(uint8_t* data, size_t capacity) noexcept;
+        explicit fixed_buffer_sink(fixed_vector<uint8_t>& buffer) noexcept;
+
+        void write(const uint8_t* data, size_t len) override;
+
+        inline void clear() noexcept { _size = 0; }
+
+        inline const uint8_t* data() const noexcept { return _data; }
+        inline size_t size() const noexcept { return _size; }
+        inline size_t capacity() const noexcept { return _capacity; }
+    };
+
+    // Unbuffered writes to a file descriptor (socket, pipe, already opened file), which is not closed
+    class fd_sink : public encode_sink
+    {
+    private:
+        int _fd;
+
+    public:
+        explicit fd_sink(int fd) noexcept;
+
+        void write(const uint8_t* data, size_t len) override;
+
+        inline int fd() const noexcept { return _fd; }
+    };
+
+    // Buffered writes to a file created (or truncated) at 'path', closed on destruction
+    class file_sink : public encode_sink
+    {
+    private:
+        std::FILE* _file;
+        std::string _path;
+
+    public:
+        explicit file_sink(const std::string& path);
+        ~file_sink();
+
+        file_sink(const file_sink&) = delete;
+        file_sink& operator=(const file_sink&) = delete;
+
+        void write(const uint8_t* data, size_t len) override;
+        void flush() override;
+    };
+
+    // Base64 encodes everything written and forwards the text to 'sink' in chunks of up to 4 KB, so
+    // no more than that is buffered. flush() writes the padding and flushes 'sink', the adapter can be
+    // reused for another stream afterwards
+    class base64_encode_sink : public encode_sink
+    {
+    private:
+        encode_sink& _sink;
+        base64::encoder _encoder;
+        char _buffer[4096];
+
+    public:
+        explicit base64_encode_sink(encode_sink& sink, base64::alphabet abc = base64::alphabet::standard) noexcept;
+
+        void write(const uint8_t* data, size_t len) override;
+        void flush() override;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <ien/thread_pool.hpp>
+
+#include <cstddef>
+
+namespace ien
+{
+    // How image_ops run a kernel over an image.
+    // A parallel policy splits the planes into tiles and runs the selected SIMD kernel per tile on 'pool'
+    struct execution_policy
+    {
+        // Pixels per tile, rounded up to a multiple of 64 so every tile starts on a plane alignment boundary.
+        // The default keeps the input and output of a tile within a typical per-core L2
+        static constexpr size_t DEFAULT_TILE_SIZE = 32 * 1024;
+
+        // Images smaller than this stay serial, the dispatch overhead would outweigh the gains
+        static constexpr size_t DEFAULT_SERIAL_THRESHOLD = 256 * 1024;
+
+        thread_pool* pool = nullptr; // nullptr -> serial
+        unsigned int max_threads = 0; // 0 -> pool thread count
+        size_t tile_size = DEFAULT_TILE_SIZE;
+        size_t serial_threshold = DEFAULT_SERIAL_THRESHOLD;
+
+        static execution_policy serial() noexcept
+        {
+            return execution_policy();
+        }
+
+        static execution_policy parallel(thread_pool& pool = default_thread_pool(), unsigned int max_threads = 0)
+        {
+            execution_policy result;
+            result.pool = &pool;
+            result.max_threads = max_threads;
+            return result;
+        }
+    };
+}
\ No newline at end of file
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <ien/encode_sink.hpp>
 #include <ien/fixed_vector.hpp>
 #include <ien/rect.hpp>
+#include <ien/resize_filter.hpp>
 
 #include <cinttypes>
 #include <cstddef>
@@ -50,16 +52,26 @@ namespace ien
         virtual void set_pixel(size_t idx, uint32_t px) = 0;
         virtual void set_pixel(size_t x, size_t y, uint32_t px) = 0;
 
-        virtual bool save_to_file_png(const std::string& path, int compression_level = 4) const = 0;
-        virtual bool save_to_file_jpeg(const std::string& path, int quality = 100) const = 0;
-        virtual bool save_to_file_tga(const std::string& path) const = 0;
+        // Encoders write through 'sink' (see encode_sink.hpp) and throw on failure.
+        // A growable_buffer_sink reused across calls keeps its capacity, so repeated encodes don't allocate
+        virtual void encode_png(encode_sink& sink, int compression_level = 4) const = 0;
+        virtual void encode_jpeg(encode_sink& sink, int quality = 100) const = 0;
+        virtual void encode_tga(encode_sink& sink) const = 0;
 
-        virtual ien::fixed_vector<uint8_t> save_to_memory_png(int compression_level = 4) const = 0;
-        virtual ien::fixed_vector<uint8_t> save_to_memory_jpeg(int quality = 100) const = 0;
-        virtual ien::fixed_vector<uint8_t> save_to_memory_tga() const = 0;
+        // Base64 text of the PNG, encoded as the PNG bytes are produced. With the row-streaming PNG writer
+        // (LIEN_IMAGE_ZLIB) neither the packed pixels nor the PNG are ever held whole
+        void encode_png_base64(encode_sink& sink, int compression_level = 4, base64::alphabet abc = base64::alphabet::standard) const;
 
-        virtual void resize_absolute(size_t w, size_t h) = 0;
-        virtual void resize_relative(float w, float h) = 0;
+        bool save_to_file_png(const std::string& path, int compression_level = 4) const;
+        bool save_to_file_jpeg(const std::string& path, int quality = 100) const;
+        bool save_to_file_tga(const std::string& path) const;
+
+        ien::fixed_vector<uint8_t> save_to_memory_png(int compression_level = 4) const;
+        ien::fixed_vector<uint8_t> save_to_memory_jpeg(int quality = 100) const;
+        ien::fixed_vector<uint8_t> save_to_memory_tga() const;
+
+        virtual void resize_absolute(size_t w, size_t h, resize_filter filter = resize_filter::BICUBIC) = 0;
+        virtual void resize_relative(float w, float h, resize_filter filter = resize_filter::BICUBIC) = 0;
 
         inline image_type imgtype() const { return _imgtype; }
     };
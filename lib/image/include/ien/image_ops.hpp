@@ -1,34 +1,105 @@
 #pragma once
 
+#include <ien/execution_policy.hpp>
 #include <ien/fixed_vector.hpp>
+#include <ien/image_stats.hpp>
 #include <ien/planar_image.hpp>
+#include <ien/resize_filter.hpp>
 #include <ien/rgba_channel.hpp>
+#include <ien/rgb_metric.hpp>
 
 #include <cinttypes>
 
 namespace ien::image_ops
 {
-    void truncate_channel_data(image_planar_data* img, int bits_r, int bits_g, int bits_b, int bits_a);
+    // Every per-pixel op comes in three flavours:
+    //  - returning a freshly allocated fixed_vector
+    //  - writing into a caller provided buffer (fixed_vector& or pointer + length), which must hold at least
+    //    pixel_count() elements, otherwise std::invalid_argument is thrown
+    //  - in-place (byte results only), overwriting the 'dst' channel of the image itself
+    // Buffers aligned to LIEN_DEFAULT_ALIGNMENT avoid split stores in the SIMD kernels.
+    // With execution_policy::parallel() large images are processed in tiles on a thread pool.
 
-    fixed_vector<uint8_t> rgba_average(const planar_image& img);
+    void truncate_channel_data(image_planar_data* img, int bits_r, int bits_g, int bits_b, int bits_a, const execution_policy& policy = execution_policy::serial());
 
-    fixed_vector<uint8_t> rgba_max(const planar_image& img);
+    fixed_vector<uint8_t> rgba_average(const planar_image& img, const execution_policy& policy = execution_policy::serial());
+    void rgba_average(const planar_image& img, fixed_vector<uint8_t>& out, const execution_policy& policy = execution_policy::serial());
+    void rgba_average(const planar_image& img, uint8_t* out, size_t out_len, const execution_policy& policy = execution_policy::serial());
+    void rgba_average(planar_image& img, rgba_channel dst, const execution_policy& policy = execution_policy::serial());
 
-    fixed_vector<uint8_t> rgba_min(const planar_image& img);
+    fixed_vector<uint8_t> rgba_max(const planar_image& img, const execution_policy& policy = execution_policy::serial());
+    void rgba_max(const planar_image& img, fixed_vector<uint8_t>& out, const execution_policy& policy = execution_policy::serial());
+    void rgba_max(const planar_image& img, uint8_t* out, size_t out_len, const execution_policy& policy = execution_policy::serial());
+    void rgba_max(planar_image& img, rgba_channel dst, const execution_policy& policy = execution_policy::serial());
 
-    fixed_vector<float> rgb_average(const planar_image& img);
+    fixed_vector<uint8_t> rgba_min(const planar_image& img, const execution_policy& policy = execution_policy::serial());
+    void rgba_min(const planar_image& img, fixed_vector<uint8_t>& out, const execution_policy& policy = execution_policy::serial());
+    void rgba_min(const planar_image& img, uint8_t* out, size_t out_len, const execution_policy& policy = execution_policy::serial());
+    void rgba_min(planar_image& img, rgba_channel dst, const execution_policy& policy = execution_policy::serial());
 
-    fixed_vector<uint8_t> rgb_max(const planar_image& img);
+    fixed_vector<float> rgb_average(const planar_image& img, const execution_policy& policy = execution_policy::serial());
+    void rgb_average(const planar_image& img, fixed_vector<float>& out, const execution_policy& policy = execution_policy::serial());
+    void rgb_average(const planar_image& img, float* out, size_t out_len, const execution_policy& policy = execution_policy::serial());
 
-    fixed_vector<uint8_t> rgb_min(const planar_image& img);
+    fixed_vector<uint8_t> rgb_max(const planar_image& img, const execution_policy& policy = execution_policy::serial());
+    void rgb_max(const planar_image& img, fixed_vector<uint8_t>& out, const execution_policy& policy = execution_policy::serial());
+    void rgb_max(const planar_image& img, uint8_t* out, size_t out_len, const execution_policy& policy = execution_policy::serial());
+    void rgb_max(planar_image& img, rgba_channel dst, const execution_policy& policy = execution_policy::serial());
 
-    fixed_vector<uint8_t> rgba_sum_saturated(const planar_image& img);
+    fixed_vector<uint8_t> rgb_min(const planar_image& img, const execution_policy& policy = execution_policy::serial());
+    void rgb_min(const planar_image& img, fixed_vector<uint8_t>& out, const execution_policy& policy = execution_policy::serial());
+    void rgb_min(const planar_image& img, uint8_t* out, size_t out_len, const execution_policy& policy = execution_policy::serial());
+    void rgb_min(planar_image& img, rgba_channel dst, const execution_policy& policy = execution_policy::serial());
 
-    fixed_vector<float> rgb_saturation(const planar_image& img);
+    fixed_vector<uint8_t> rgba_sum_saturated(const planar_image& img, const execution_policy& policy = execution_policy::serial());
+    void rgba_sum_saturated(const planar_image& img, fixed_vector<uint8_t>& out, const execution_policy& policy = execution_policy::serial());
+    void rgba_sum_saturated(const planar_image& img, uint8_t* out, size_t out_len, const execution_policy& policy = execution_policy::serial());
+    void rgba_sum_saturated(planar_image& img, rgba_channel dst, const execution_policy& policy = execution_policy::serial());
 
-    fixed_vector<float> rgb_luminance(const planar_image& img);
+    fixed_vector<float> rgb_saturation(const planar_image& img, const execution_policy& policy = execution_policy::serial());
+    void rgb_saturation(const planar_image& img, fixed_vector<float>& out, const execution_policy& policy = execution_policy::serial());
+    void rgb_saturation(const planar_image& img, float* out, size_t out_len, const execution_policy& policy = execution_policy::serial());
+
+    fixed_vector<float> rgb_luminance(const planar_image& img, const execution_policy& policy = execution_policy::serial());
+    void rgb_luminance(const planar_image& img, fixed_vector<float>& out, const execution_policy& policy = execution_policy::serial());
+    void rgb_luminance(const planar_image& img, float* out, size_t out_len, const execution_policy& policy = execution_policy::serial());
+
+    // Computes every requested metric in a single pass over the RGB channels.
+    // Each requested output buffer must hold img.pixel_count() elements, unrequested ones are left untouched
+    void rgb_metrics(const planar_image& img, rgb_metric metrics, const rgb_metrics_output& out, const execution_policy& policy = execution_policy::serial());
 
     image_planar_data unpack_image_data(const uint8_t* data, size_t len);
+    void unpack_image_data(const uint8_t* data, size_t len, image_planar_data& out);
+
+    fixed_vector<uint8_t> pack_image_data(const image_planar_data& data, const execution_policy& policy = execution_policy::serial());
+    void pack_image_data(const image_planar_data& data, fixed_vector<uint8_t>& out, const execution_policy& policy = execution_policy::serial());
+    void pack_image_data(const image_planar_data& data, uint8_t* out, size_t out_len, const execution_policy& policy = execution_policy::serial());
+
+    // 'out' must hold data.size() * 4 bytes
+    void pack_image_data(const image_planar_data& data, uint8_t* out, const execution_policy& policy = execution_policy::serial());
+
+    fixed_vector<uint8_t> channel_compare(const planar_image& img, rgba_channel channel, uint8_t threshold, const execution_policy& policy = execution_policy::serial());
+    void channel_compare(const planar_image& img, rgba_channel channel, uint8_t threshold, fixed_vector<uint8_t>& out, const execution_policy& policy = execution_policy::serial());
+    void channel_compare(const planar_image& img, rgba_channel channel, uint8_t threshold, uint8_t* out, size_t out_len, const execution_policy& policy = execution_policy::serial());
+    void channel_compare(planar_image& img, rgba_channel channel, uint8_t threshold, rgba_channel dst, const execution_policy& policy = execution_policy::serial());
+
+    // Whole-image reductions, tiles are reduced independently and merged when the policy is parallel
+    image_histogram histogram(const planar_image& img, const execution_policy& policy = execution_policy::serial());
+    image_stats statistics(const planar_image& img, const execution_policy& policy = execution_policy::serial());
+
+    // Separable resampling of every plane, 'dst' dimensions define the output size.
+    // Both passes run on the planes directly and are split in bands of rows when the policy is parallel
+    void resize(const planar_image& src, planar_image& dst, resize_filter filter = resize_filter::BICUBIC, const execution_policy& policy = execution_policy::serial());
+    planar_image resize(const planar_image& src, size_t width, size_t height, resize_filter filter = resize_filter::BICUBIC, const execution_policy& policy = execution_policy::serial());
+
+    // LSB steganography: every pixel carries bits_r + bits_g + bits_b + bits_a (0 to 8 each) payload bits in the
+    // low bits of its channels, the same bits truncate_channel_data clears. The payload is read LSB first, the first
+    // bits of a pixel go to R, then G, B and A. Only the pixels needed to hold the payload are modified.
+    // Throws std::invalid_argument when the payload does not fit (see lsb_capacity) or a bit count is out of range
+    size_t lsb_capacity(const planar_image& img, int bits_r, int bits_g, int bits_b, int bits_a);
+
+    void lsb_embed(planar_image& img, int bits_r, int bits_g, int bits_b, int bits_a, const uint8_t* payload, size_t len, const execution_policy& policy = execution_policy::serial());
 
-    fixed_vector<uint8_t> channel_compare(const planar_image& img, rgba_channel channel, uint8_t threshold);
+    fixed_vector<uint8_t> lsb_extract(const planar_image& img, int bits_r, int bits_g, int bits_b, int bits_a, size_t len, const execution_policy& policy = execution_policy::serial());
+    void lsb_extract(const planar_image& img, int bits_r, int bits_g, int bits_b, int bits_a, uint8_t* out, size_t len, const execution_policy& policy = execution_policy::serial());
 }
\ No newline at end of file
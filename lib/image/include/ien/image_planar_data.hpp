@@ -1,5 +1,6 @@
 #pragma once
 
+#include <ien/allocators/alloc_policy.hpp>
 #include <ien/fixed_vector.hpp>
 
 #include <array>
@@ -9,6 +10,10 @@
 namespace ien
 {
     class planar_image;
+
+    // The four planes share one allocation. Each plane is padded to a multiple of
+    // LIEN_CACHE_LINE_SIZE bytes ('stride'), so every plane starts on a cache line boundary
+    // and full vector iterations can always run up to the stride. Padding bytes are zeroed.
     class image_planar_data
     {
         friend class planar_image;
@@ -20,6 +25,8 @@ namespace ien
         uint8_t* _a;
         size_t _alignment;
         size_t _size;
+        size_t _stride;
+        allocators::alloc_policy _policy = allocators::alloc_policy::HEAP;
         bool _moved = false;
 
         constexpr image_planar_data() noexcept 
@@ -29,10 +36,13 @@ namespace ien
             , _a(nullptr)
             , _alignment(0)
             , _size(0)
+            , _stride(0)
         { }
         
     public:
         image_planar_data(size_t pixel_count);
+
+        image_planar_data(size_t pixel_count, allocators::alloc_policy policy);
         ~image_planar_data();
 
         image_planar_data(const image_planar_data& cp_src);
@@ -51,6 +61,8 @@ namespace ien
         const uint8_t* cdata_a() const noexcept;
 
         size_t size() const noexcept;
+        size_t stride() const noexcept;
+        allocators::alloc_policy policy() const noexcept;
 
         void resize(size_t len);
 
@@ -58,5 +70,9 @@ namespace ien
         void set_pixel(size_t index, uint32_t rgba);
 
         [[nodiscard]] ien::fixed_vector<uint8_t> pack_data() const;
+
+    private:
+        void allocate_planes(size_t pixel_count);
+        void release_planes();
     };
 }
\ No newline at end of file
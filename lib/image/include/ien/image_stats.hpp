@@ -0,0 +1,67 @@
+#pragma once
+
+#include <ien/rgba_channel.hpp>
+
+#include <array>
+#include <cinttypes>
+#include <cstddef>
+
+namespace ien
+{
+    typedef std::array<uint64_t, 256> channel_histogram;
+
+    // 256-bin histogram of every channel, computed by image_ops::histogram
+    struct image_histogram
+    {
+        std::array<channel_histogram, 4> bins = {}; // indexed by rgba_channel
+        uint64_t pixel_count = 0;
+
+        const channel_histogram& channel(rgba_channel ch) const
+        {
+            return bins[static_cast<size_t>(ch)];
+        }
+
+        // Smallest value 'v' so that at least a 'fraction' (0 to 1) of the pixels are <= v
+        uint8_t percentile(rgba_channel ch, double fraction) const
+        {
+            const channel_histogram& hist = channel(ch);
+            const double target = fraction * static_cast<double>(pixel_count);
+
+            uint64_t accum = 0;
+            for (size_t i = 0; i < hist.size(); ++i)
+            {
+                accum += hist[i];
+                if (accum > 0 && static_cast<double>(accum) >= target)
+                {
+                    return static_cast<uint8_t>(i);
+                }
+            }
+            return 255;
+        }
+
+        uint8_t median(rgba_channel ch) const
+        {
+            return percentile(ch, 0.5);
+        }
+    };
+
+    struct channel_stats
+    {
+        uint8_t min = 0;
+        uint8_t max = 0;
+        double mean = 0.0;
+        double variance = 0.0; // population variance
+    };
+
+    // Whole-image aggregates of every channel, computed by image_ops::statistics
+    struct image_stats
+    {
+        std::array<channel_stats, 4> channels = {}; // indexed by rgba_channel
+        uint64_t pixel_count = 0;
+
+        const channel_stats& channel(rgba_channel ch) const
+        {
+            return channels[static_cast<size_t>(ch)];
+        }
+    };
+}
\ No newline at end of file
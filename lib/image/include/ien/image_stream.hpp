@@ -0,0 +1,142 @@
+#pragma once
+
+#include <ien/encode_sink.hpp>
+#include <ien/fixed_vector.hpp>
+#include <ien/planar_image.hpp>
+
+#include <cinttypes>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace ien
+{
+    namespace _internal { struct image_stream_access; }
+
+    enum class image_stream_format
+    {
+        PNG, // needs zlib (LIEN_IMAGE_ZLIB)
+        TGA,
+        PPM, // binary P6, alpha is dropped on write
+        PAM  // P7
+    };
+
+    // The file may be valid but has no streaming decoder (unknown format, interlaced PNG, ...),
+    // it can still be loaded whole through planar_image/interleaved_image
+    class unsupported_image_format : public std::runtime_error
+    {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    // Sequential top-to-bottom decoder. Only a few rows are held in memory at any time,
+    // so images larger than memory can be processed strip by strip:
+    //
+    //   auto reader = open_image_reader(in_path);
+    //   auto writer = open_image_writer(out_path, image_stream_format::PNG, reader->width(), reader->height());
+    //   planar_image strip;
+    //   while(reader->read_strip(strip, 64))
+    //   {
+    //       // image_ops on 'strip'
+    //       writer->write_strip(strip);
+    //   }
+    //   writer->finish();
+    class image_stream_reader
+    {
+    protected:
+        size_t _width = 0;
+        size_t _height = 0;
+        size_t _next_row = 0;
+        fixed_vector<uint8_t> _row;
+        fixed_vector<uint8_t> _strip;
+
+    public:
+        virtual ~image_stream_reader() = default;
+
+        inline size_t width() const noexcept { return _width; }
+        inline size_t height() const noexcept { return _height; }
+        inline size_t rows_remaining() const noexcept { return _height - _next_row; }
+
+        // Decodes the next row as packed RGBA, 'rgba' must hold width() * 4 bytes
+        void read_row(uint8_t* rgba);
+
+        // Decodes the next row into four planes of width() bytes
+        void read_row(uint8_t* r, uint8_t* g, uint8_t* b, uint8_t* a);
+
+        // Decodes up to 'max_rows' rows into 'strip'. 'strip' is only reallocated when
+        // its dimensions change, i.e. on the first and last strip. Returns false once every row has been read
+        bool read_strip(planar_image& strip, size_t max_rows);
+
+    protected:
+        void init(size_t width, size_t height);
+
+        virtual void decode_row(uint8_t* rgba) = 0;
+    };
+
+    // Sequential top-to-bottom encoder into an encode_sink, rows must be written in order. finish() must be called
+    // once all height() rows have been written, otherwise the output is left incomplete
+    class image_stream_writer
+    {
+        friend struct _internal::image_stream_access;
+
+    private:
+        std::unique_ptr<encode_sink> _owned_sink;
+
+    protected:
+        encode_sink* _sink = nullptr;
+        size_t _width = 0;
+        size_t _height = 0;
+        size_t _next_row = 0;
+        bool _finished = false;
+        fixed_vector<uint8_t> _row;
+        fixed_vector<uint8_t> _strip;
+
+    public:
+        virtual ~image_stream_writer() = default;
+
+        inline size_t width() const noexcept { return _width; }
+        inline size_t height() const noexcept { return _height; }
+        inline size_t rows_remaining() const noexcept { return _height - _next_row; }
+
+        // Encodes one row of packed RGBA, 'rgba' must hold width() * 4 bytes
+        void write_row(const uint8_t* rgba);
+
+        // Encodes one row from four planes of width() bytes
+        void write_row(const uint8_t* r, const uint8_t* g, const uint8_t* b, const uint8_t* a);
+
+        // Encodes every row of 'strip', its width must match width()
+        void write_strip(const planar_image& strip);
+
+        void finish();
+
+    protected:
+        void init(encode_sink& sink, size_t width, size_t height);
+
+        virtual void encode_row(const uint8_t* rgba) = 0;
+        virtual void encode_end() = 0;
+    };
+
+    // Format is detected from the file signature, or the extension for TGA (which has none).
+    // Throws std::invalid_argument if the file can't be opened, unsupported_image_format for files
+    // without a streaming decoder (e.g. interlaced PNGs), std::runtime_error for I/O failures and corrupt files
+    std::unique_ptr<image_stream_reader> open_image_reader(const std::string& path);
+
+    // 'compression_level' (0 to 9) is only used by PNG
+    std::unique_ptr<image_stream_writer> open_image_writer(
+        const std::string& path,
+        image_stream_format format,
+        size_t width,
+        size_t height,
+        int compression_level = 4
+    );
+
+    // 'sink' must outlive the writer
+    std::unique_ptr<image_stream_writer> open_image_writer(
+        encode_sink& sink,
+        image_stream_format format,
+        size_t width,
+        size_t height,
+        int compression_level = 4
+    );
+}
\ No newline at end of file
@@ -24,9 +24,12 @@ namespace ien
         interleaved_image(const interleaved_image& cp_src);
         interleaved_image(interleaved_image&& mv_src) noexcept;
 
-        interleaved_image(size_t width, size_t height);
+        interleaved_image(size_t width, size_t height, allocators::alloc_policy policy = allocators::alloc_policy::HEAP);
         interleaved_image(const std::string& path);
 
+        // Takes ownership of a packed RGBA buffer of at least width * height * 4 bytes, without copying it
+        interleaved_image(ien::fixed_vector<uint8_t>&& rgba_data, size_t width, size_t height);
+
         uint8_t* data() noexcept;
         const uint8_t* cdata() const noexcept;
 
@@ -38,16 +41,12 @@ namespace ien
 
         std::vector<uint32_t> get_chunk(const rect<size_t>& r) const override;
 
-        bool save_to_file_png(const std::string& path, int compression_level = 4) const override;
-        bool save_to_file_jpeg(const std::string& path, int quality = 100) const override;
-        bool save_to_file_tga(const std::string& path) const override;
-
-        ien::fixed_vector<uint8_t> save_to_memory_png(int compression_level = 4) const override;
-        ien::fixed_vector<uint8_t> save_to_memory_jpeg(int quality = 100) const override;
-        ien::fixed_vector<uint8_t> save_to_memory_tga() const override;
+        void encode_png(encode_sink& sink, int compression_level = 4) const override;
+        void encode_jpeg(encode_sink& sink, int quality = 100) const override;
+        void encode_tga(encode_sink& sink) const override;
 
-        void resize_absolute(size_t w, size_t h) override;
-        void resize_relative(float w, float h) override;
+        void resize_absolute(size_t w, size_t h, resize_filter filter = resize_filter::BICUBIC) override;
+        void resize_relative(float w, float h, resize_filter filter = resize_filter::BICUBIC) override;
 
         ien::fixed_vector<uint8_t> get_rgba_buff_copy();
 
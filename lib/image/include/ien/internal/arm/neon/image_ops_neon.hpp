@@ -9,27 +9,37 @@ namespace ien::image_ops::_internal
 {
     void truncate_channel_data_neon(const truncate_channel_args& args);
 
-    fixed_vector<uint8_t> rgba_average_neon(const channel_info_extract_args_rgba& args);
+    void rgba_average_neon(const channel_info_extract_args_rgba& args, uint8_t* out);
 
-    fixed_vector<uint8_t> rgba_max_neon(const channel_info_extract_args_rgba& args);
+    void rgba_max_neon(const channel_info_extract_args_rgba& args, uint8_t* out);
 
-    fixed_vector<uint8_t> rgba_min_neon(const channel_info_extract_args_rgba& args);
+    void rgba_min_neon(const channel_info_extract_args_rgba& args, uint8_t* out);
 
-    fixed_vector<float> rgb_average_neon(const channel_info_extract_args_rgb& args);
+    void rgb_average_neon(const channel_info_extract_args_rgb& args, float* out);
 
-    fixed_vector<uint8_t> rgb_max_neon(const channel_info_extract_args_rgb& args);
+    void rgb_max_neon(const channel_info_extract_args_rgb& args, uint8_t* out);
 
-    fixed_vector<uint8_t> rgb_min_neon(const channel_info_extract_args_rgb& args);
+    void rgb_min_neon(const channel_info_extract_args_rgb& args, uint8_t* out);
 
-    fixed_vector<uint8_t> rgba_sum_saturated_neon(const channel_info_extract_args_rgba& args);
+    void rgba_sum_saturated_neon(const channel_info_extract_args_rgba& args, uint8_t* out);
 
-    fixed_vector<float> rgb_saturation_neon(const channel_info_extract_args_rgb& args);
+    void rgb_saturation_neon(const channel_info_extract_args_rgb& args, float* out);
 
-    fixed_vector<float> rgb_luminance_neon(const channel_info_extract_args_rgb& args);
+    void rgb_luminance_neon(const channel_info_extract_args_rgb& args, float* out);
 
-	image_planar_data unpack_image_data_neon(const uint8_t* data, size_t len);
+    void rgb_metrics_neon(const rgb_metrics_args& args);
 
-    fixed_vector<uint8_t> channel_compare_neon(const channel_compare_args& args);
+	void unpack_image_data_neon(const uint8_t* data, size_t len, image_planar_data& out);
+
+	void pack_image_data_neon(const channel_info_extract_args_rgba& args, uint8_t* out);
+
+    void channel_compare_neon(const channel_compare_args& args, uint8_t* out);
+
+    void rgba_reduce_neon(const channel_info_extract_args_rgba& args, rgba_reduction& out);
+
+    void resample_horizontal_neon(const resample_args& args);
+
+    void resample_vertical_neon(const resample_args& args);
 }
 
 #endif
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <ien/encode_sink.hpp>
+
+#include <exception>
+
+namespace ien::_internal
+{
+    // Bridges C-style write callbacks (stb_image_write) to an encode_sink.
+    // Exceptions must not unwind through the encoder, so they are held until finish()
+    class encode_sink_adapter
+    {
+    private:
+        encode_sink& _sink;
+        std::exception_ptr _error;
+
+    public:
+        explicit encode_sink_adapter(encode_sink& sink) noexcept;
+
+        // stbi_write_func signature, 'ctx' is the adapter
+        static void write_callback(void* ctx, void* data, int size);
+
+        inline void* context() noexcept { return this; }
+
+        // Rethrows the first sink failure, throws std::runtime_error if the encoder itself failed ('ok' == false)
+        // and flushes the sink otherwise
+        void finish(bool ok, const char* format);
+    };
+}
\ No newline at end of file
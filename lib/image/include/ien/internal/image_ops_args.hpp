@@ -1,8 +1,12 @@
 #pragma once
 
 #include <ien/planar_image.hpp>
+#include <ien/rgb_metric.hpp>
+#include <ien/resize_filter.hpp>
 #include <ien/rgba_channel.hpp>
+#include <algorithm>
 #include <cinttypes>
+#include <vector>
 
 namespace ien::image_ops::_internal
 {
@@ -20,8 +24,9 @@ namespace ien::image_ops::_internal
 
         constexpr truncate_channel_args() { }
 
+        // Truncation is element-wise, so it runs over the padded stride of the planes
         truncate_channel_args(planar_image& img, int r, int g, int b, int a)
-            : len(img.pixel_count())
+            : len(img.data()->stride())
             , ch_r(img.data()->data_r())
             , ch_g(img.data()->data_g())
             , ch_b(img.data()->data_b())
@@ -33,7 +38,7 @@ namespace ien::image_ops::_internal
         { }
 
         truncate_channel_args(image_planar_data& img, int r, int g, int b, int a)
-            : len(img.size())
+            : len(img.stride())
             , ch_r(img.data_r())
             , ch_g(img.data_g())
             , ch_b(img.data_b())
@@ -43,8 +48,68 @@ namespace ien::image_ops::_internal
             , bits_b(b)
             , bits_a(a)
         { }
+
+        truncate_channel_args subrange(size_t offset, size_t count) const
+        {
+            truncate_channel_args result = *this;
+            result.len = count;
+            result.ch_r += offset;
+            result.ch_g += offset;
+            result.ch_b += offset;
+            result.ch_a += offset;
+            return result;
+        }
+    };
+
+    // Payload bits stored in the low bits of the planes, see image_ops::lsb_embed for the layout.
+    // 'len' is the pixel count, pixel i holds payload bits [i * pixel_bits(), (i + 1) * pixel_bits())
+    template<typename TChannel, typename TPayload>
+    struct lsb_args
+    {
+        size_t len = 0;
+        TChannel* ch_r = nullptr;
+        TChannel* ch_g = nullptr;
+        TChannel* ch_b = nullptr;
+        TChannel* ch_a = nullptr;
+        int bits_r = 0;
+        int bits_g = 0;
+        int bits_b = 0;
+        int bits_a = 0;
+        TPayload* payload = nullptr;
+        size_t payload_len = 0; // bytes, bits past the end read as zero and are not written
+
+        constexpr lsb_args() { }
+
+        int pixel_bits() const { return bits_r + bits_g + bits_b + bits_a; }
+
+        // Low-bit mask of every channel, R in the lowest byte (matches a packed little-endian RGBA pixel)
+        uint32_t pixel_mask() const
+        {
+            return (((1u << bits_r) - 1) << 0)
+                 | (((1u << bits_g) - 1) << 8)
+                 | (((1u << bits_b) - 1) << 16)
+                 | (((1u << bits_a) - 1) << 24);
+        }
+
+        // 'offset' must be a multiple of 8, so the payload of the subrange starts on a byte boundary
+        lsb_args subrange(size_t offset, size_t count) const
+        {
+            const size_t payload_offset = std::min(payload_len, (offset * static_cast<size_t>(pixel_bits())) / 8);
+            lsb_args result = *this;
+            result.len = count;
+            result.ch_r += offset;
+            result.ch_g += offset;
+            result.ch_b += offset;
+            result.ch_a += offset;
+            result.payload += payload_offset;
+            result.payload_len -= payload_offset;
+            return result;
+        }
     };
 
+    typedef lsb_args<uint8_t, const uint8_t> lsb_embed_args;
+    typedef lsb_args<const uint8_t, uint8_t> lsb_extract_args;
+
     struct channel_info_extract_args_rgba
     {
         size_t len = 0;
@@ -62,6 +127,25 @@ namespace ien::image_ops::_internal
             , ch_b(img.cdata()->cdata_b())
             , ch_a(img.cdata()->cdata_a())
         { }
+
+        channel_info_extract_args_rgba(const image_planar_data& data)
+            : len(data.size())
+            , ch_r(data.cdata_r())
+            , ch_g(data.cdata_g())
+            , ch_b(data.cdata_b())
+            , ch_a(data.cdata_a())
+        { }
+
+        channel_info_extract_args_rgba subrange(size_t offset, size_t count) const
+        {
+            channel_info_extract_args_rgba result = *this;
+            result.len = count;
+            result.ch_r += offset;
+            result.ch_g += offset;
+            result.ch_b += offset;
+            result.ch_a += offset;
+            return result;
+        }
     };
 
     struct channel_info_extract_args_rgb
@@ -79,6 +163,49 @@ namespace ien::image_ops::_internal
             , ch_g(img.cdata()->cdata_g())
             , ch_b(img.cdata()->cdata_b())
         { }
+
+        channel_info_extract_args_rgb subrange(size_t offset, size_t count) const
+        {
+            channel_info_extract_args_rgb result = *this;
+            result.len = count;
+            result.ch_r += offset;
+            result.ch_g += offset;
+            result.ch_b += offset;
+            return result;
+        }
+    };
+
+    struct rgb_metrics_args
+    {
+        size_t len = 0;
+        const uint8_t* ch_r = nullptr;
+        const uint8_t* ch_g = nullptr;
+        const uint8_t* ch_b = nullptr;
+
+        // Null for the metrics that were not requested
+        float* luminance = nullptr;
+        float* saturation = nullptr;
+        float* average = nullptr;
+        uint8_t* max = nullptr;
+        uint8_t* min = nullptr;
+
+        constexpr rgb_metrics_args() { }
+
+        rgb_metrics_args(const planar_image& img, rgb_metric metrics, const rgb_metrics_output& out)
+            : len(img.pixel_count())
+            , ch_r(img.cdata()->cdata_r())
+            , ch_g(img.cdata()->cdata_g())
+            , ch_b(img.cdata()->cdata_b())
+            , luminance(has_metric(metrics, rgb_metric::LUMINANCE) ? out.luminance : nullptr)
+            , saturation(has_metric(metrics, rgb_metric::SATURATION) ? out.saturation : nullptr)
+            , average(has_metric(metrics, rgb_metric::AVERAGE) ? out.average : nullptr)
+            , max(has_metric(metrics, rgb_metric::MAX) ? out.max : nullptr)
+            , min(has_metric(metrics, rgb_metric::MIN) ? out.min : nullptr)
+        { }
+
+        // Same request restricted to pixels [offset, offset + count), used for vector loop tails and tiling.
+        // Out of line, the SIMD tier objects call it for their tails
+        rgb_metrics_args subrange(size_t offset, size_t count) const;
     };
 
     struct channel_compare_args
@@ -107,5 +234,65 @@ namespace ien::image_ops::_internal
                     break;
             }
         }
+
+        channel_compare_args subrange(size_t offset, size_t count) const
+        {
+            channel_compare_args result = *this;
+            result.len = count;
+            result.ch += offset;
+            return result;
+        }
+    };
+
+    // Partial per-channel aggregates of a pixel range, merged across tiles by image_ops::statistics
+    struct rgba_reduction
+    {
+        uint64_t sum[4] = { 0, 0, 0, 0 };
+        uint64_t sum_sq[4] = { 0, 0, 0, 0 };
+        uint8_t min[4] = { 0xFF, 0xFF, 0xFF, 0xFF };
+        uint8_t max[4] = { 0, 0, 0, 0 };
+
+        void merge(const rgba_reduction& other)
+        {
+            for (size_t ch = 0; ch < 4; ++ch)
+            {
+                sum[ch] += other.sum[ch];
+                sum_sq[ch] += other.sum_sq[ch];
+                min[ch] = std::min(min[ch], other.min[ch]);
+                max[ch] = std::max(max[ch], other.max[ch]);
+            }
+        }
+    };
+
+    // Fixed point filter weights of one resampling axis.
+    // Output pixel 'i' reads source pixels [first[i], first[i] + taps), every window lies within the source
+    struct resample_coeffs
+    {
+        static constexpr int PRECISION_BITS = 14;
+
+        size_t in_len = 0;
+        size_t out_len = 0;
+        size_t taps = 0;
+        size_t weight_stride = 0; // taps rounded up to a multiple of 8, padding weights are zero
+        std::vector<size_t> first;
+        std::vector<int16_t> weights; // out_len * weight_stride, each row sums to 1 << PRECISION_BITS
+
+        // Out of line, the SIMD tier objects read the tables without instantiating std::vector members
+        const size_t* first_data() const;
+        const int16_t* weights_data() const;
+    };
+
+    // One pass of the separable resampler, over contiguous rows.
+    // Horizontal: rows of coeffs->in_len pixels to rows of coeffs->out_len pixels.
+    // Vertical: coeffs->in_len rows of 'width' pixels to coeffs->out_len rows.
+    // Only output rows [row_begin, row_end) are written
+    struct resample_args
+    {
+        const resample_coeffs* coeffs = nullptr;
+        const uint8_t* src = nullptr;
+        uint8_t* dst = nullptr;
+        size_t width = 0;
+        size_t row_begin = 0;
+        size_t row_end = 0;
     };
 }
\ No newline at end of file
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <ien/image_stream.hpp>
+
+#include <array>
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(LIEN_IMAGE_ZLIB)
+    #include <zlib.h>
+#endif
+
+namespace ien::_internal
+{
+    struct image_stream_access
+    {
+        static void own_sink(image_stream_writer& writer, std::unique_ptr<encode_sink> sink)
+        {
+            writer._owned_sink = std::move(sink);
+        }
+    };
+
+    // Read-only, buffered by stdio. Every failure throws std::runtime_error,
+    // unsupported() throws unsupported_image_format for valid files a reader can't handle
+    class stream_file
+    {
+    private:
+        struct file_closer { void operator()(std::FILE* f) const { std::fclose(f); } };
+        std::unique_ptr<std::FILE, file_closer> _file;
+        std::string _path;
+
+    public:
+        stream_file(const std::string& path, const char* mode);
+
+        std::FILE* handle() const noexcept;
+
+        void read(void* dst, size_t len);
+        uint8_t read_u8();
+        void skip(long len);
+        void seek(long offset);
+        long tell() const;
+
+        [[noreturn]] void fail(const std::string& reason) const;
+        [[noreturn]] void unsupported(const std::string& reason) const;
+    };
+
+    class pnm_stream_reader : public image_stream_reader
+    {
+    private:
+        stream_file _file;
+        size_t _channels = 0;
+        size_t _sample_bytes = 1;
+        unsigned int _maxval = 255;
+        fixed_vector<uint8_t> _raw;
+
+    public:
+        pnm_stream_reader(const std::string& path);
+
+    protected:
+        void decode_row(uint8_t* rgba) override;
+
+    private:
+        std::string read_token();
+        size_t read_header_value();
+    };
+
+    class pnm_stream_writer : public image_stream_writer
+    {
+    private:
+        bool _alpha;
+        fixed_vector<uint8_t> _raw;
+
+    public:
+        // 'alpha' selects PAM (P7, RGB_ALPHA) over PPM (P6)
+        pnm_stream_writer(encode_sink& sink, size_t width, size_t height, bool alpha);
+
+    protected:
+        void encode_row(const uint8_t* rgba) override;
+        void encode_end() override;
+    };
+
+    class tga_stream_reader : public image_stream_reader
+    {
+    private:
+        // Decoder position, snapshotted at every row start for bottom-up files
+        struct rle_state
+        {
+            long offset = 0;
+            uint32_t remaining = 0; // pixels left in the current packet
+            bool repeat = false;
+            std::array<uint8_t, 4> pixel = {};
+        };
+
+        stream_file _file;
+        size_t _pixel_bytes = 0;
+        bool _rle = false;
+        bool _right_to_left = false;
+        bool _bottom_up = false;
+        bool _alpha = false;
+        long _data_offset = 0;
+        rle_state _state;
+        std::vector<rle_state> _row_states;
+
+    public:
+        tga_stream_reader(const std::string& path);
+
+    protected:
+        void decode_row(uint8_t* rgba) override;
+
+    private:
+        void decode_pixels(uint8_t* rgba, size_t count);
+        void read_pixel(uint8_t* rgba);
+    };
+
+    class tga_stream_writer : public image_stream_writer
+    {
+    private:
+        fixed_vector<uint8_t> _raw;
+        fixed_vector<uint8_t> _packets;
+
+    public:
+        tga_stream_writer(encode_sink& sink, size_t width, size_t height);
+
+    protected:
+        void encode_row(const uint8_t* rgba) override;
+        void encode_end() override;
+    };
+
+#if defined(LIEN_IMAGE_ZLIB)
+    class png_stream_reader : public image_stream_reader
+    {
+    private:
+        stream_file _file;
+        z_stream _zs = {};
+        bool _zs_ready = false;
+        uint32_t _idat_remaining = 0;
+        bool _idat_done = false;
+        uLong _chunk_crc = 0; // over the type and data read so far
+        uint8_t _bit_depth = 0;
+        uint8_t _color_type = 0;
+        size_t _channels = 0;
+        size_t _filter_bpp = 0;
+        size_t _row_bytes = 0;
+        std::array<uint8_t, 1024> _palette = {}; // RGBA
+        bool _has_color_key = false;
+        std::array<uint16_t, 3> _color_key = {};
+        fixed_vector<uint8_t> _in;
+        fixed_vector<uint8_t> _cur;
+        fixed_vector<uint8_t> _prev;
+
+    public:
+        png_stream_reader(const std::string& path);
+        ~png_stream_reader();
+
+    protected:
+        void decode_row(uint8_t* rgba) override;
+
+    private:
+        void read_chunk_header(uint32_t& len, char* type);
+        void read_chunk_data(uint8_t* dst, size_t len);
+        void skip_chunk_data(size_t len);
+        void check_chunk_crc();
+        void refill_input();
+        void unfilter_row();
+        void expand_row(uint8_t* rgba) const;
+    };
+
+    class png_stream_writer : public image_stream_writer
+    {
+    private:
+        z_stream _zs = {};
+        bool _zs_ready = false;
+        bool _adaptive_filter;
+        fixed_vector<uint8_t> _prev;
+        fixed_vector<uint8_t> _filtered;
+        fixed_vector<uint8_t> _best;
+        fixed_vector<uint8_t> _out;
+
+    public:
+        png_stream_writer(encode_sink& sink, size_t width, size_t height, int compression_level);
+        ~png_stream_writer();
+
+    protected:
+        void encode_row(const uint8_t* rgba) override;
+        void encode_end() override;
+
+    private:
+        void deflate_input(const uint8_t* data, size_t len, int flush);
+        void write_chunk(const char* type, const uint8_t* data, size_t len);
+    };
+#endif
+}
\ No newline at end of file
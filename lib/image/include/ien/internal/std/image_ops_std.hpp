@@ -9,25 +9,44 @@ namespace ien::image_ops::_internal
 {
     void truncate_channel_data_std(const truncate_channel_args& args);
 
-    fixed_vector<uint8_t> rgba_average_std(const channel_info_extract_args_rgba& args);
+    void rgba_average_std(const channel_info_extract_args_rgba& args, uint8_t* out);
 
-    fixed_vector<uint8_t> rgba_max_std(const channel_info_extract_args_rgba& args);
+    void rgba_max_std(const channel_info_extract_args_rgba& args, uint8_t* out);
 
-    fixed_vector<uint8_t> rgba_min_std(const channel_info_extract_args_rgba& args);
+    void rgba_min_std(const channel_info_extract_args_rgba& args, uint8_t* out);
 
-    fixed_vector<float> rgb_average_std(const channel_info_extract_args_rgb& args);
+    void rgb_average_std(const channel_info_extract_args_rgb& args, float* out);
 
-    fixed_vector<uint8_t> rgb_max_std(const channel_info_extract_args_rgb& args);
+    void rgb_max_std(const channel_info_extract_args_rgb& args, uint8_t* out);
 
-    fixed_vector<uint8_t> rgb_min_std(const channel_info_extract_args_rgb& args);
+    void rgb_min_std(const channel_info_extract_args_rgb& args, uint8_t* out);
 
-    fixed_vector<uint8_t> rgba_sum_saturated_std(const channel_info_extract_args_rgba& args);
+    void rgba_sum_saturated_std(const channel_info_extract_args_rgba& args, uint8_t* out);
     
-    fixed_vector<float> rgb_saturation_std(const channel_info_extract_args_rgb& args);
+    void rgb_saturation_std(const channel_info_extract_args_rgb& args, float* out);
     
-    fixed_vector<float> rgb_luminance_std(const channel_info_extract_args_rgb& args);
+    void rgb_luminance_std(const channel_info_extract_args_rgb& args, float* out);
 
-    image_planar_data unpack_image_data_std(const uint8_t* data, size_t len);
+    void rgb_metrics_std(const rgb_metrics_args& args);
 
-    fixed_vector<uint8_t> channel_compare_std(const channel_compare_args& args);
+    void unpack_image_data_std(const uint8_t* data, size_t len, image_planar_data& out);
+
+    void pack_image_data_std(const channel_info_extract_args_rgba& args, uint8_t* out);
+
+    void channel_compare_std(const channel_compare_args& args, uint8_t* out);
+
+    // Adds the 4x256 bins (R, G, B, A) of the range to 'bins'
+    void rgba_histogram_std(const channel_info_extract_args_rgba& args, uint64_t* bins);
+
+    void rgba_reduce_std(const channel_info_extract_args_rgba& args, rgba_reduction& out);
+
+    resample_coeffs build_resample_coeffs(size_t in_len, size_t out_len, resize_filter filter);
+
+    void resample_horizontal_std(const resample_args& args);
+
+    void resample_vertical_std(const resample_args& args);
+
+    void lsb_embed_std(const lsb_embed_args& args);
+
+    void lsb_extract_std(const lsb_extract_args& args);
 }
\ No newline at end of file
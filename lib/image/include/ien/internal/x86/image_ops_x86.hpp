@@ -11,40 +11,79 @@ namespace ien::image_ops::_internal
 {
     void truncate_channel_data_sse2(const truncate_channel_args& args);
     void truncate_channel_data_avx2(const truncate_channel_args& args);
+    void truncate_channel_data_avx512(const truncate_channel_args& args);
 
-    fixed_vector<uint8_t> rgba_average_sse2(const channel_info_extract_args_rgba& args);
-    fixed_vector<uint8_t> rgba_average_avx2(const channel_info_extract_args_rgba& args);
+    void rgba_average_sse2(const channel_info_extract_args_rgba& args, uint8_t* out);
+    void rgba_average_avx2(const channel_info_extract_args_rgba& args, uint8_t* out);
+    void rgba_average_avx512(const channel_info_extract_args_rgba& args, uint8_t* out);
 
-    fixed_vector<uint8_t> rgba_max_sse2(const channel_info_extract_args_rgba& args);
-    fixed_vector<uint8_t> rgba_max_avx2(const channel_info_extract_args_rgba& args);
+    void rgba_max_sse2(const channel_info_extract_args_rgba& args, uint8_t* out);
+    void rgba_max_avx2(const channel_info_extract_args_rgba& args, uint8_t* out);
+    void rgba_max_avx512(const channel_info_extract_args_rgba& args, uint8_t* out);
 
-    fixed_vector<uint8_t> rgba_min_sse2(const channel_info_extract_args_rgba& args);
-    fixed_vector<uint8_t> rgba_min_avx2(const channel_info_extract_args_rgba& args);
+    void rgba_min_sse2(const channel_info_extract_args_rgba& args, uint8_t* out);
+    void rgba_min_avx2(const channel_info_extract_args_rgba& args, uint8_t* out);
+    void rgba_min_avx512(const channel_info_extract_args_rgba& args, uint8_t* out);
 
-    fixed_vector<float> rgb_average_sse2(const channel_info_extract_args_rgb& args);
-    fixed_vector<float> rgb_average_sse41(const channel_info_extract_args_rgb& args);
-    fixed_vector<float> rgb_average_avx2(const channel_info_extract_args_rgb& args);
+    void rgb_average_sse2(const channel_info_extract_args_rgb& args, float* out);
+    void rgb_average_sse41(const channel_info_extract_args_rgb& args, float* out);
+    void rgb_average_avx2(const channel_info_extract_args_rgb& args, float* out);
+    void rgb_average_avx512(const channel_info_extract_args_rgb& args, float* out);
 
-    fixed_vector<uint8_t> rgb_max_sse2(const channel_info_extract_args_rgb& args);
-    fixed_vector<uint8_t> rgb_max_avx2(const channel_info_extract_args_rgb& args);
+    void rgb_max_sse2(const channel_info_extract_args_rgb& args, uint8_t* out);
+    void rgb_max_avx2(const channel_info_extract_args_rgb& args, uint8_t* out);
+    void rgb_max_avx512(const channel_info_extract_args_rgb& args, uint8_t* out);
 
-    fixed_vector<uint8_t> rgb_min_sse2(const channel_info_extract_args_rgb& args);
-    fixed_vector<uint8_t> rgb_min_avx2(const channel_info_extract_args_rgb& args);
+    void rgb_min_sse2(const channel_info_extract_args_rgb& args, uint8_t* out);
+    void rgb_min_avx2(const channel_info_extract_args_rgb& args, uint8_t* out);
+    void rgb_min_avx512(const channel_info_extract_args_rgb& args, uint8_t* out);
 
-    fixed_vector<uint8_t> rgba_sum_saturated_sse2(const channel_info_extract_args_rgba& args);
-    fixed_vector<uint8_t> rgba_sum_saturated_avx2(const channel_info_extract_args_rgba& args);
+    void rgba_sum_saturated_sse2(const channel_info_extract_args_rgba& args, uint8_t* out);
+    void rgba_sum_saturated_avx2(const channel_info_extract_args_rgba& args, uint8_t* out);
+    void rgba_sum_saturated_avx512(const channel_info_extract_args_rgba& args, uint8_t* out);
 
-    fixed_vector<float> rgb_saturation_sse2(const channel_info_extract_args_rgb& args);
-    fixed_vector<float> rgb_saturation_avx2(const channel_info_extract_args_rgb& args);
+    void rgb_saturation_sse2(const channel_info_extract_args_rgb& args, float* out);
+    void rgb_saturation_avx2(const channel_info_extract_args_rgb& args, float* out);
+    void rgb_saturation_avx512(const channel_info_extract_args_rgb& args, float* out);
 
-    fixed_vector<float> rgb_luminance_sse2(const channel_info_extract_args_rgb& args);
-    fixed_vector<float> rgb_luminance_avx2(const channel_info_extract_args_rgb& args);
+    void rgb_luminance_sse2(const channel_info_extract_args_rgb& args, float* out);
+    void rgb_luminance_avx2(const channel_info_extract_args_rgb& args, float* out);
+    void rgb_luminance_avx512(const channel_info_extract_args_rgb& args, float* out);
 
-    image_planar_data unpack_image_data_ssse3(const uint8_t* data, size_t len);
-    image_planar_data unpack_image_data_avx2(const uint8_t* data, size_t len);
+    void rgb_metrics_sse2(const rgb_metrics_args& args);
+    void rgb_metrics_avx2(const rgb_metrics_args& args);
+    void rgb_metrics_avx512(const rgb_metrics_args& args);
 
-    fixed_vector<uint8_t> channel_compare_sse2(const channel_compare_args& args);
-    fixed_vector<uint8_t> channel_compare_avx2(const channel_compare_args& args);
+    void unpack_image_data_ssse3(const uint8_t* data, size_t len, image_planar_data& out);
+    void unpack_image_data_avx2(const uint8_t* data, size_t len, image_planar_data& out);
+    void unpack_image_data_avx512(const uint8_t* data, size_t len, image_planar_data& out);
+
+    void pack_image_data_sse2(const channel_info_extract_args_rgba& args, uint8_t* out);
+    void pack_image_data_avx2(const channel_info_extract_args_rgba& args, uint8_t* out);
+    void pack_image_data_avx512(const channel_info_extract_args_rgba& args, uint8_t* out);
+
+    void channel_compare_sse2(const channel_compare_args& args, uint8_t* out);
+    void channel_compare_avx2(const channel_compare_args& args, uint8_t* out);
+    void channel_compare_avx512(const channel_compare_args& args, uint8_t* out);
+
+    void rgba_reduce_sse2(const channel_info_extract_args_rgba& args, rgba_reduction& out);
+    void rgba_reduce_avx2(const channel_info_extract_args_rgba& args, rgba_reduction& out);
+    void rgba_reduce_avx512(const channel_info_extract_args_rgba& args, rgba_reduction& out);
+
+    void resample_horizontal_sse2(const resample_args& args);
+    void resample_horizontal_avx2(const resample_args& args);
+
+    void resample_vertical_sse2(const resample_args& args);
+    void resample_vertical_avx2(const resample_args& args);
+
+    // AVX2 + BMI2 (PDEP/PEXT), defined in image_ops.cpp: the block kernels below plus a scalar tail
+    void lsb_embed_avx2_bmi2(const lsb_embed_args& args);
+    void lsb_extract_avx2_bmi2(const lsb_extract_args& args);
+
+    // Whole blocks only, returns the number of pixels processed.
+    // 'pixel_bits' and 'pixel_mask' are those of 'args', computed by the caller
+    size_t lsb_embed_blocks_avx2_bmi2(const lsb_embed_args& args, size_t pixel_bits, uint32_t pixel_mask);
+    size_t lsb_extract_blocks_avx2_bmi2(const lsb_extract_args& args, size_t pixel_bits, uint32_t pixel_mask);
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cinttypes>
+#include <cstddef>
+
+#if defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)
+
+// Scalar helpers for the SIMD tier sources only.
+// Every tier object is compiled with its own ISA flags, so shared inline or template helpers
+// (ien::average, std::max, ...) would be emitted as weak symbols the linker may pick over the
+// baseline copy. These have internal linkage instead
+namespace ien::image_ops::_internal
+{
+    static inline bool tier_ptr_aligned(const void* ptr, size_t alignment)
+    {
+        return (reinterpret_cast<uintptr_t>(ptr) % alignment) == 0;
+    }
+
+    static inline uint8_t tier_max(uint8_t a, uint8_t b)
+    {
+        return (a > b) ? a : b;
+    }
+
+    static inline uint8_t tier_min(uint8_t a, uint8_t b)
+    {
+        return (a < b) ? a : b;
+    }
+
+    static inline uint8_t tier_max(uint8_t a, uint8_t b, uint8_t c)
+    {
+        return tier_max(tier_max(a, b), c);
+    }
+
+    static inline uint8_t tier_min(uint8_t a, uint8_t b, uint8_t c)
+    {
+        return tier_min(tier_min(a, b), c);
+    }
+
+    static inline uint8_t tier_max(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+    {
+        return tier_max(tier_max(a, b), tier_max(c, d));
+    }
+
+    static inline uint8_t tier_min(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+    {
+        return tier_min(tier_min(a, b), tier_min(c, d));
+    }
+
+    // Same result as ien::average<uint8_t>
+    static inline uint8_t tier_average(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+    {
+        return static_cast<uint8_t>((uint32_t(a) + b + c + d) / 4);
+    }
+
+    // Same result as ien::safe_add<float>(a, b, c) / 3
+    static inline float tier_average(uint8_t a, uint8_t b, uint8_t c)
+    {
+        return (static_cast<float>(a) + static_cast<float>(b) + static_cast<float>(c)) / 3;
+    }
+}
+
+#endif
\ No newline at end of file
@@ -22,7 +22,7 @@ namespace ien
             : image(image_type::PLANAR)
         { }
 
-        planar_image(size_t width, size_t height);
+        planar_image(size_t width, size_t height, allocators::alloc_policy policy = allocators::alloc_policy::HEAP);
         planar_image(const std::string& path);
 
         planar_image(const planar_image& cp_src) = default;
@@ -41,16 +41,12 @@ namespace ien
 
         std::vector<uint32_t> get_chunk(const rect<size_t>& r) const override;
 
-        bool save_to_file_png(const std::string& path, int compression_level = 4) const override;
-        bool save_to_file_jpeg(const std::string& path, int quality = 100) const override;
-        bool save_to_file_tga(const std::string& path) const override;
+        void encode_png(encode_sink& sink, int compression_level = 4) const override;
+        void encode_jpeg(encode_sink& sink, int quality = 100) const override;
+        void encode_tga(encode_sink& sink) const override;
 
-        ien::fixed_vector<uint8_t> save_to_memory_png(int compression_level = 4) const override;
-        ien::fixed_vector<uint8_t> save_to_memory_jpeg(int quality = 100) const override;
-        ien::fixed_vector<uint8_t> save_to_memory_tga() const override;
-
-        void resize_absolute(size_t w, size_t h) override;
-        void resize_relative(float w, float h) override;
+        void resize_absolute(size_t w, size_t h, resize_filter filter = resize_filter::BICUBIC) override;
+        void resize_relative(float w, float h, resize_filter filter = resize_filter::BICUBIC) override;
 
         interleaved_image to_interleaved_image();
         std::string to_png_base64(int comp_level = 4);
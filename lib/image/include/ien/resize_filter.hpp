@@ -0,0 +1,13 @@
+#pragma once
+
+namespace ien
+{
+    // Reconstruction filters of the planar resampler, see image_ops::resize
+    enum class resize_filter
+    {
+        BOX,        // Nearest neighbour when upscaling, area average when downscaling
+        BILINEAR,
+        BICUBIC,    // Catmull-Rom
+        LANCZOS3
+    };
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cinttypes>
+
+namespace ien
+{
+    // Per-pixel metrics computed by image_ops::rgb_metrics, combinable as a bitmask
+    enum class rgb_metric : uint32_t
+    {
+        NONE        = 0,
+        LUMINANCE   = 1 << 0,
+        SATURATION  = 1 << 1,
+        AVERAGE     = 1 << 2,
+        MAX         = 1 << 3,
+        MIN         = 1 << 4,
+        ALL         = LUMINANCE | SATURATION | AVERAGE | MAX | MIN
+    };
+
+    constexpr rgb_metric operator|(rgb_metric lhs, rgb_metric rhs)
+    {
+        return static_cast<rgb_metric>(static_cast<uint32_t>(lhs) | static_cast<uint32_t>(rhs));
+    }
+
+    constexpr rgb_metric operator&(rgb_metric lhs, rgb_metric rhs)
+    {
+        return static_cast<rgb_metric>(static_cast<uint32_t>(lhs) & static_cast<uint32_t>(rhs));
+    }
+
+    constexpr bool has_metric(rgb_metric metrics, rgb_metric metric)
+    {
+        return (metrics & metric) != rgb_metric::NONE;
+    }
+
+    // Caller owned destination of every metric, each requested one must hold pixel_count() elements
+    struct rgb_metrics_output
+    {
+        float* luminance = nullptr;
+        float* saturation = nullptr;
+        float* average = nullptr;
+        uint8_t* max = nullptr;
+        uint8_t* min = nullptr;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,271 @@
+#include <ien/encode_sink.hpp>
+
+#include <ien/internal/encode_sink_adapter.hpp>
+#include <ien/platform.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#if defined(LIEN_OS_WIN32) || defined(LIEN_OS_WIN64)
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+
+namespace ien
+{
+    // Smallest allocation, so tiny first writes (headers) don't cause a series of reallocations
+    constexpr size_t SINK_MIN_CAPACITY = 4096;
+
+    growable_buffer_sink::growable_buffer_sink(size_t initial_capacity)
+    {
+        reserve(initial_capacity);
+    }
+
+    growable_buffer_sink::~growable_buffer_sink()
+    {
+        std::free(_data);
+    }
+
+    growable_buffer_sink::growable_buffer_sink(growable_buffer_sink&& mv_src) noexcept
+        : _data(mv_src._data)
+        , _size(mv_src._size)
+        , _capacity(mv_src._capacity)
+    {
+        mv_src._data = nullptr;
+        mv_src._size = 0;
+        mv_src._capacity = 0;
+    }
+
+    growable_buffer_sink& growable_buffer_sink::operator=(growable_buffer_sink&& mv_src) noexcept
+    {
+        if(this != &mv_src)
+        {
+            std::free(_data);
+            _data = mv_src._data;
+            _size = mv_src._size;
+            _capacity = mv_src._capacity;
+            mv_src._data = nullptr;
+            mv_src._size = 0;
+            mv_src._capacity = 0;
+        }
+        return *this;
+    }
+
+    void growable_buffer_sink::write(const uint8_t* data, size_t len)
+    {
+        if(len > _capacity - _size)
+        {
+            if(len > std::numeric_limits<size_t>::max() - _size)
+            {
+                throw std::length_error("Encoded data exceeds the addressable size");
+            }
+            const size_t required = _size + len;
+            const size_t doubled = _capacity > std::numeric_limits<size_t>::max() / 2
+                ? std::numeric_limits<size_t>::max()
+                : _capacity * 2;
+            reserve(std::max({ required, doubled, SINK_MIN_CAPACITY }));
+        }
+        std::memcpy(_data + _size, data, len);
+        _size += len;
+    }
+
+    void growable_buffer_sink::reserve(size_t capacity)
+    {
+        if(capacity <= _capacity)
+        {
+            return;
+        }
+
+        void* ptr = std::realloc(_data, capacity);
+        if(ptr == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        _data = static_cast<uint8_t*>(ptr);
+        _capacity = capacity;
+    }
+
+    void growable_buffer_sink::clear() noexcept
+    {
+        _size = 0;
+    }
+
+    fixed_vector<uint8_t> growable_buffer_sink::release()
+    {
+        if(_size == 0)
+        {
+            return fixed_vector<uint8_t>();
+        }
+
+        // Give back the unused tail, realloc shrinks in place
+        if(_capacity > _size)
+        {
+            if(void* ptr = std::realloc(_data, _size))
+            {
+                _data = static_cast<uint8_t*>(ptr);
+            }
+        }
+
+        fixed_vector<uint8_t> result = fixed_vector<uint8_t>::adopt(_data, _size, alignof(uint8_t), &std::free);
+        _data = nullptr;
+        _size = 0;
+        _capacity = 0;
+        return result;
+    }
+
+    fixed_buffer_sink::fixed_buffer_sink(uint8_t* data, size_t capacity) noexcept
+        : _data(data)
+        , _capacity(capacity)
+    { }
+
+    fixed_buffer_sink::fixed_buffer_sink(fixed_vector<uint8_t>& buffer) noexcept
+        : fixed_buffer_sink(buffer.data(), buffer.size())
+    { }
+
+    void fixed_buffer_sink::write(const uint8_t* data, size_t len)
+    {
+        if(len > _capacity - _size)
+        {
+            throw std::length_error("Encoded data exceeds the output buffer capacity");
+        }
+        std::memcpy(_data + _size, data, len);
+        _size += len;
+    }
+
+    fd_sink::fd_sink(int fd) noexcept
+        : _fd(fd)
+    { }
+
+    void fd_sink::write(const uint8_t* data, size_t len)
+    {
+        // Pipes and sockets may accept less than requested
+        while(len > 0)
+        {
+#if defined(LIEN_OS_WIN32) || defined(LIEN_OS_WIN64)
+            const int written = ::_write(_fd, data, static_cast<unsigned int>(std::min<size_t>(len, INT_MAX)));
+#else
+            const ssize_t written = ::write(_fd, data, len);
+#endif
+            if(written < 0)
+            {
+                if(errno == EINTR)
+                {
+                    continue;
+                }
+                throw std::runtime_error(std::string("Write to file descriptor failed: ") + std::strerror(errno));
+            }
+            data += written;
+            len -= static_cast<size_t>(written);
+        }
+    }
+
+    file_sink::file_sink(const std::string& path)
+        : _file(std::fopen(path.c_str(), "wb"))
+        , _path(path)
+    {
+        if(_file == nullptr)
+        {
+            throw std::runtime_error(std::string(std::strerror(errno)) + ": " + path);
+        }
+    }
+
+    file_sink::~file_sink()
+    {
+        std::fclose(_file);
+    }
+
+    void file_sink::write(const uint8_t* data, size_t len)
+    {
+        if(std::fwrite(data, 1, len, _file) != len)
+        {
+            throw std::runtime_error("Write failed: " + _path);
+        }
+    }
+
+    void file_sink::flush()
+    {
+        if(std::fflush(_file) != 0)
+        {
+            throw std::runtime_error("Write failed: " + _path);
+        }
+    }
+
+    base64_encode_sink::base64_encode_sink(encode_sink& sink, base64::alphabet abc) noexcept
+        : _sink(sink)
+        , _encoder(abc)
+    { }
+
+    void base64_encode_sink::write(const uint8_t* data, size_t len)
+    {
+        // Up to 2 bytes are held back by the encoder, 3072 more still fit the buffer
+        constexpr size_t MAX_CHUNK = (sizeof(_buffer) / 4) * 3;
+
+        while(len > 0)
+        {
+            const size_t n = std::min(len, MAX_CHUNK);
+            const size_t written = _encoder.update(data, n, _buffer);
+            if(written > 0)
+            {
+                _sink.write(reinterpret_cast<const uint8_t*>(_buffer), written);
+            }
+            data += n;
+            len -= n;
+        }
+    }
+
+    void base64_encode_sink::flush()
+    {
+        const size_t written = _encoder.finish(_buffer);
+        if(written > 0)
+        {
+            _sink.write(reinterpret_cast<const uint8_t*>(_buffer), written);
+        }
+        _sink.flush();
+    }
+}
+
+namespace ien::_internal
+{
+    encode_sink_adapter::encode_sink_adapter(encode_sink& sink) noexcept
+        : _sink(sink)
+    { }
+
+    void encode_sink_adapter::write_callback(void* ctx, void* data, int size)
+    {
+        auto* adapter = static_cast<encode_sink_adapter*>(ctx);
+        if(adapter->_error != nullptr || size <= 0)
+        {
+            return;
+        }
+
+        try
+        {
+            adapter->_sink.write(static_cast<const uint8_t*>(data), static_cast<size_t>(size));
+        }
+        catch(...)
+        {
+            adapter->_error = std::current_exception();
+        }
+    }
+
+    void encode_sink_adapter::finish(bool ok, const char* format)
+    {
+        if(_error != nullptr)
+        {
+            std::rethrow_exception(_error);
+        }
+        if(!ok)
+        {
+            throw std::runtime_error(std::string("Failed to encode ") + format + " data");
+        }
+        _sink.flush();
+    }
+}
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include <ien/interleaved_image.hpp>
 #include <ien/planar_image.hpp>
 
+#include <exception>
+
 namespace ien
 {
     size_t image::pixel_count() const noexcept
@@ -15,6 +17,63 @@ namespace ien
         return _width * _height * 4;
     }    
 
+    template<typename EncodeFunc>
+    static bool save_to_file(const std::string& path, EncodeFunc&& encode)
+    {
+        try
+        {
+            file_sink sink(path);
+            encode(sink);
+            return true;
+        }
+        catch(const std::exception&)
+        {
+            return false;
+        }
+    }
+
+    bool image::save_to_file_png(const std::string& path, int compression_level) const
+    {
+        return save_to_file(path, [&](encode_sink& sink) { encode_png(sink, compression_level); });
+    }
+
+    bool image::save_to_file_jpeg(const std::string& path, int quality) const
+    {
+        return save_to_file(path, [&](encode_sink& sink) { encode_jpeg(sink, quality); });
+    }
+
+    bool image::save_to_file_tga(const std::string& path) const
+    {
+        return save_to_file(path, [&](encode_sink& sink) { encode_tga(sink); });
+    }
+
+    void image::encode_png_base64(encode_sink& sink, int compression_level, base64::alphabet abc) const
+    {
+        base64_encode_sink b64_sink(sink, abc);
+        encode_png(b64_sink, compression_level);
+    }
+
+    ien::fixed_vector<uint8_t> image::save_to_memory_png(int compression_level) const
+    {
+        growable_buffer_sink sink;
+        encode_png(sink, compression_level);
+        return sink.release();
+    }
+
+    ien::fixed_vector<uint8_t> image::save_to_memory_jpeg(int quality) const
+    {
+        growable_buffer_sink sink;
+        encode_jpeg(sink, quality);
+        return sink.release();
+    }
+
+    ien::fixed_vector<uint8_t> image::save_to_memory_tga() const
+    {
+        growable_buffer_sink sink;
+        encode_tga(sink);
+        return sink.release();
+    }
+
     std::unique_ptr<ien::image> read_image(const std::string& imgpath, image_type type)
     {
         if (type == image_type::INTERLEAVED)        
@@ -1,10 +1,15 @@
 #include <ien/image_ops.hpp>
 
 #include <ien/fixed_vector.hpp>
+#include <ien/parallel.hpp>
 #include <ien/platform.hpp>
 #include <ien/internal/image_ops_args.hpp>
 #include <ien/internal/std/image_ops_std.hpp>
 #include <algorithm>
+#include <array>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
 
 #if defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)
     #include <ien/internal/x86/image_ops_x86.hpp>
@@ -22,14 +27,19 @@ namespace ien::image_ops
     #define HAS_SSE42() platform::x86::get_feature(platform::x86::feature::SSE42)
     #define HAS_AVX()   platform::x86::get_feature(platform::x86::feature::AVX)
     #define HAS_AVX2()  platform::x86::get_feature(platform::x86::feature::AVX2)
+    #define HAS_BMI2()  platform::x86::get_feature(platform::x86::feature::BMI2)
+    #define HAS_AVX512() (platform::x86::get_feature(platform::x86::feature::AVX512F) \
+                       && platform::x86::get_feature(platform::x86::feature::AVX512BW))
 
     template<typename TFuncPtr>
-    TFuncPtr ARCH_X86_OVERLOAD_SELECT(TFuncPtr def, TFuncPtr sse2, TFuncPtr avx2)
+    TFuncPtr ARCH_X86_OVERLOAD_SELECT(TFuncPtr def, TFuncPtr sse2, TFuncPtr avx2, TFuncPtr avx512)
     {
         #if defined(LIEN_ARCH_X86_64) // on x86-64 SSE2 is guaranteed
-            return HAS_AVX2() ? avx2 : sse2;
+            return HAS_AVX512() ? avx512
+                 : HAS_AVX2() ? avx2 : sse2;
         #elif defined(LIEN_ARCH_X86)
-            return HAS_AVX2() ? avx2
+            return HAS_AVX512() ? avx512
+                 : HAS_AVX2() ? avx2
                  : HAS_SSE2() ? sse2 : def;
         #else
             #error "Unable to select x86 overload on non-x86 platform!"
@@ -37,7 +47,83 @@ namespace ien::image_ops
     }
 #endif
 
-    void truncate_channel_data(image_planar_data* img, int bits_r, int bits_g, int bits_b, int bits_a)
+    const size_t TILE_ALIGNMENT = 64;
+
+    template<typename T>
+    static void validate_output_buffer(const T* out, size_t out_len, size_t required_len)
+    {
+        if (out_len < required_len || (required_len > 0 && out == nullptr))
+        {
+            throw std::invalid_argument("Output buffer is smaller than the image pixel count");
+        }
+        if (!is_ptr_aligned(out, alignof(T)))
+        {
+            throw std::invalid_argument("Output buffer is not aligned to its element type");
+        }
+    }
+
+    static uint8_t* channel_data(planar_image& img, rgba_channel channel)
+    {
+        switch (channel)
+        {
+            case rgba_channel::R: return img.data()->data_r();
+            case rgba_channel::G: return img.data()->data_g();
+            case rgba_channel::B: return img.data()->data_b();
+            case rgba_channel::A: return img.data()->data_a();
+        }
+        throw std::invalid_argument("Invalid rgba channel");
+    }
+
+    // Runs kernel(tile_args, tile_offset) over the whole image, split in tiles when the policy is parallel
+    template<typename TArgs, typename TKernel>
+    static void run_tiled(const execution_policy& policy, const TArgs& args, TKernel&& kernel)
+    {
+        const size_t len = args.len;
+        if (policy.pool == nullptr || len < policy.serial_threshold)
+        {
+            kernel(args, 0);
+            return;
+        }
+
+        // Keep every tile start on the plane alignment, so the kernels' aligned loads stay valid
+        const size_t tile_size = std::max<size_t>(1, (policy.tile_size + TILE_ALIGNMENT - 1) / TILE_ALIGNMENT) * TILE_ALIGNMENT;
+
+        parallel_for_range_params params(static_cast<long>(len), static_cast<long>(tile_size));
+        params.max_threads = (policy.max_threads != 0)
+            ? policy.max_threads
+            : static_cast<unsigned int>(std::max<size_t>(1, policy.pool->thread_count()));
+
+        parallel_for_range(*policy.pool, params, [&](long begin, long end)
+        {
+            const size_t offset = static_cast<size_t>(begin);
+            kernel(args.subrange(offset, static_cast<size_t>(end - begin)), offset);
+        });
+    }
+
+    // Runs body(row_begin, row_end) over 'rows' rows of 'row_len' pixels, split in bands of rows when the policy is parallel
+    template<typename TBody>
+    static void run_rows(const execution_policy& policy, size_t rows, size_t row_len, TBody&& body)
+    {
+        if (policy.pool == nullptr || (rows * row_len) < policy.serial_threshold)
+        {
+            body(size_t(0), rows);
+            return;
+        }
+
+        const size_t band_rows = std::max<size_t>(1, policy.tile_size / std::max<size_t>(1, row_len));
+
+        parallel_for_range_params params(static_cast<long>(rows), static_cast<long>(band_rows));
+        params.max_threads = (policy.max_threads != 0)
+            ? policy.max_threads
+            : static_cast<unsigned int>(std::max<size_t>(1, policy.pool->thread_count()));
+
+        parallel_for_range(*policy.pool, params, [&](long begin, long end)
+        {
+            body(static_cast<size_t>(begin), static_cast<size_t>(end));
+        });
+    }
+
+    void truncate_channel_data(image_planar_data* img, int bits_r, int bits_g, int bits_b, int bits_a, const execution_policy& policy)
     {
         typedef void(*func_ptr_t)(const _internal::truncate_channel_args& args);
 
@@ -45,7 +131,8 @@ namespace ien::image_ops
             static func_ptr_t func = ARCH_X86_OVERLOAD_SELECT(
                 &_internal::truncate_channel_data_std,
                 &_internal::truncate_channel_data_sse2,
-                &_internal::truncate_channel_data_avx2
+                &_internal::truncate_channel_data_avx2,
+                &_internal::truncate_channel_data_avx512
             );
         #elif defined(LIEN_ARM_NEON) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = &_internal::truncate_channel_data_neon;
@@ -54,18 +141,24 @@ namespace ien::image_ops
         #endif
 
         _internal::truncate_channel_args args(*img, bits_r, bits_g, bits_b, bits_a);
-        func(args);
+        run_tiled(policy, args, [&, kernel = func](const auto& tile_args, size_t)
+        {
+            kernel(tile_args);
+        });
     }
 
-    fixed_vector<uint8_t> rgba_average(const planar_image& img)
+    void rgba_average(const planar_image& img, uint8_t* out, size_t out_len, const execution_policy& policy)
     {
-        typedef fixed_vector<uint8_t>(*func_ptr_t)(const _internal::channel_info_extract_args_rgba&);
+        validate_output_buffer(out, out_len, img.pixel_count());
+
+        typedef void(*func_ptr_t)(const _internal::channel_info_extract_args_rgba&, uint8_t*);
 
         #if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = ARCH_X86_OVERLOAD_SELECT(
                 &_internal::rgba_average_std,
                 &_internal::rgba_average_sse2,
-                &_internal::rgba_average_avx2
+                &_internal::rgba_average_avx2,
+                &_internal::rgba_average_avx512
             );
         #elif defined(LIEN_ARM_NEON) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = &_internal::rgba_average_neon;
@@ -74,18 +167,41 @@ namespace ien::image_ops
         #endif
 
         _internal::channel_info_extract_args_rgba args(img);
-        return func(args);
+        run_tiled(policy, args, [&, kernel = func](const auto& tile_args, size_t offset)
+        {
+            kernel(tile_args, out + offset);
+        });
+    }
+
+    fixed_vector<uint8_t> rgba_average(const planar_image& img, const execution_policy& policy)
+    {
+        fixed_vector<uint8_t> result(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT, img.cdata()->policy());
+        rgba_average(img, result.data(), result.size(), policy);
+        return result;
+    }
+
+    void rgba_average(const planar_image& img, fixed_vector<uint8_t>& out, const execution_policy& policy)
+    {
+        rgba_average(img, out.data(), out.size(), policy);
+    }
+
+    void rgba_average(planar_image& img, rgba_channel dst, const execution_policy& policy)
+    {
+        rgba_average(img, channel_data(img, dst), img.pixel_count(), policy);
     }    
 
-    fixed_vector<uint8_t> rgba_max(const planar_image& img)
+    void rgba_max(const planar_image& img, uint8_t* out, size_t out_len, const execution_policy& policy)
     {
-        typedef fixed_vector<uint8_t>(*func_ptr_t)(const _internal::channel_info_extract_args_rgba&);
+        validate_output_buffer(out, out_len, img.pixel_count());
+
+        typedef void(*func_ptr_t)(const _internal::channel_info_extract_args_rgba&, uint8_t*);
 
         #if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = ARCH_X86_OVERLOAD_SELECT(
                 &_internal::rgba_max_std,
                 &_internal::rgba_max_sse2,
-                &_internal::rgba_max_avx2
+                &_internal::rgba_max_avx2,
+                &_internal::rgba_max_avx512
             );
         #elif defined(LIEN_ARM_NEON) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = &_internal::rgba_max_neon;
@@ -94,18 +210,41 @@ namespace ien::image_ops
         #endif
 
         _internal::channel_info_extract_args_rgba args(img);
-        return func(args);
+        run_tiled(policy, args, [&, kernel = func](const auto& tile_args, size_t offset)
+        {
+            kernel(tile_args, out + offset);
+        });
     }
 
-    fixed_vector<uint8_t> rgba_min(const planar_image& img)
+    fixed_vector<uint8_t> rgba_max(const planar_image& img, const execution_policy& policy)
     {
-        typedef fixed_vector<uint8_t>(*func_ptr_t)(const _internal::channel_info_extract_args_rgba&);
+        fixed_vector<uint8_t> result(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT, img.cdata()->policy());
+        rgba_max(img, result.data(), result.size(), policy);
+        return result;
+    }
+
+    void rgba_max(const planar_image& img, fixed_vector<uint8_t>& out, const execution_policy& policy)
+    {
+        rgba_max(img, out.data(), out.size(), policy);
+    }
+
+    void rgba_max(planar_image& img, rgba_channel dst, const execution_policy& policy)
+    {
+        rgba_max(img, channel_data(img, dst), img.pixel_count(), policy);
+    }
+
+    void rgba_min(const planar_image& img, uint8_t* out, size_t out_len, const execution_policy& policy)
+    {
+        validate_output_buffer(out, out_len, img.pixel_count());
+
+        typedef void(*func_ptr_t)(const _internal::channel_info_extract_args_rgba&, uint8_t*);
 
         #if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = ARCH_X86_OVERLOAD_SELECT(
                 &_internal::rgba_min_std,
                 &_internal::rgba_min_sse2,
-                &_internal::rgba_min_avx2
+                &_internal::rgba_min_avx2,
+                &_internal::rgba_min_avx512
             );
         #elif defined(LIEN_ARM_NEON) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = &_internal::rgba_min_neon;
@@ -114,19 +253,44 @@ namespace ien::image_ops
         #endif
 
         _internal::channel_info_extract_args_rgba args(img);
-        return func(args);
+        run_tiled(policy, args, [&, kernel = func](const auto& tile_args, size_t offset)
+        {
+            kernel(tile_args, out + offset);
+        });
+    }
+
+    fixed_vector<uint8_t> rgba_min(const planar_image& img, const execution_policy& policy)
+    {
+        fixed_vector<uint8_t> result(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT, img.cdata()->policy());
+        rgba_min(img, result.data(), result.size(), policy);
+        return result;
     }
 
-    fixed_vector<float> rgb_average(const planar_image& img)
+    void rgba_min(const planar_image& img, fixed_vector<uint8_t>& out, const execution_policy& policy)
     {
-        typedef fixed_vector<float>(*func_ptr_t)(const _internal::channel_info_extract_args_rgb&);
+        rgba_min(img, out.data(), out.size(), policy);
+    }
+
+    void rgba_min(planar_image& img, rgba_channel dst, const execution_policy& policy)
+    {
+        rgba_min(img, channel_data(img, dst), img.pixel_count(), policy);
+    }
+
+    void rgb_average(const planar_image& img, float* out, size_t out_len, const execution_policy& policy)
+    {
+        validate_output_buffer(out, out_len, img.pixel_count());
+
+        typedef void(*func_ptr_t)(const _internal::channel_info_extract_args_rgb&, float*);
 
         #if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
         static func_ptr_t func = 
+            HAS_AVX512()
+            ? &_internal::rgb_average_avx512
+            :
             HAS_AVX2()
             ? &_internal::rgb_average_avx2
             : 
-            HAS_SSSE3()
+            HAS_SSE41()
             ? &_internal::rgb_average_sse41
             : 
             HAS_SSE2()
@@ -139,18 +303,36 @@ namespace ien::image_ops
         #endif
 
         _internal::channel_info_extract_args_rgb args(img);
-        return func(args);
+        run_tiled(policy, args, [&, kernel = func](const auto& tile_args, size_t offset)
+        {
+            kernel(tile_args, out + offset);
+        });
+    }
+
+    fixed_vector<float> rgb_average(const planar_image& img, const execution_policy& policy)
+    {
+        fixed_vector<float> result(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT, img.cdata()->policy());
+        rgb_average(img, result.data(), result.size(), policy);
+        return result;
+    }
+
+    void rgb_average(const planar_image& img, fixed_vector<float>& out, const execution_policy& policy)
+    {
+        rgb_average(img, out.data(), out.size(), policy);
     }
 
-    fixed_vector<uint8_t> rgb_max(const planar_image& img)
+    void rgb_max(const planar_image& img, uint8_t* out, size_t out_len, const execution_policy& policy)
     {
-        typedef fixed_vector<uint8_t>(*func_ptr_t)(const _internal::channel_info_extract_args_rgb&);
+        validate_output_buffer(out, out_len, img.pixel_count());
+
+        typedef void(*func_ptr_t)(const _internal::channel_info_extract_args_rgb&, uint8_t*);
 
         #if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = ARCH_X86_OVERLOAD_SELECT(
                 &_internal::rgb_max_std,
                 &_internal::rgb_max_sse2,
-                &_internal::rgb_max_avx2
+                &_internal::rgb_max_avx2,
+                &_internal::rgb_max_avx512
             );
         #elif defined(LIEN_ARM_NEON) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = &_internal::rgb_max_neon;
@@ -159,18 +341,41 @@ namespace ien::image_ops
         #endif
 
         _internal::channel_info_extract_args_rgb args(img);
-        return func(args);
+        run_tiled(policy, args, [&, kernel = func](const auto& tile_args, size_t offset)
+        {
+            kernel(tile_args, out + offset);
+        });
     }
 
-    fixed_vector<uint8_t> rgb_min(const planar_image& img)
+    fixed_vector<uint8_t> rgb_max(const planar_image& img, const execution_policy& policy)
     {
-        typedef fixed_vector<uint8_t>(*func_ptr_t)(const _internal::channel_info_extract_args_rgb&);
+        fixed_vector<uint8_t> result(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT, img.cdata()->policy());
+        rgb_max(img, result.data(), result.size(), policy);
+        return result;
+    }
+
+    void rgb_max(const planar_image& img, fixed_vector<uint8_t>& out, const execution_policy& policy)
+    {
+        rgb_max(img, out.data(), out.size(), policy);
+    }
+
+    void rgb_max(planar_image& img, rgba_channel dst, const execution_policy& policy)
+    {
+        rgb_max(img, channel_data(img, dst), img.pixel_count(), policy);
+    }
+
+    void rgb_min(const planar_image& img, uint8_t* out, size_t out_len, const execution_policy& policy)
+    {
+        validate_output_buffer(out, out_len, img.pixel_count());
+
+        typedef void(*func_ptr_t)(const _internal::channel_info_extract_args_rgb&, uint8_t*);
 
         #if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = ARCH_X86_OVERLOAD_SELECT(
                 &_internal::rgb_min_std,
                 &_internal::rgb_min_sse2,
-                &_internal::rgb_min_avx2
+                &_internal::rgb_min_avx2,
+                &_internal::rgb_min_avx512
             );
         #elif defined(LIEN_ARM_NEON) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = &_internal::rgb_min_neon;
@@ -179,18 +384,41 @@ namespace ien::image_ops
         #endif
 
         _internal::channel_info_extract_args_rgb args(img);
-        return func(args);
+        run_tiled(policy, args, [&, kernel = func](const auto& tile_args, size_t offset)
+        {
+            kernel(tile_args, out + offset);
+        });
+    }
+
+    fixed_vector<uint8_t> rgb_min(const planar_image& img, const execution_policy& policy)
+    {
+        fixed_vector<uint8_t> result(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT, img.cdata()->policy());
+        rgb_min(img, result.data(), result.size(), policy);
+        return result;
     }
 
-    fixed_vector<uint8_t> rgba_sum_saturated(const planar_image& img)
+    void rgb_min(const planar_image& img, fixed_vector<uint8_t>& out, const execution_policy& policy)
     {
-        typedef fixed_vector<uint8_t>(*func_ptr_t)(const _internal::channel_info_extract_args_rgba&);
+        rgb_min(img, out.data(), out.size(), policy);
+    }
+
+    void rgb_min(planar_image& img, rgba_channel dst, const execution_policy& policy)
+    {
+        rgb_min(img, channel_data(img, dst), img.pixel_count(), policy);
+    }
+
+    void rgba_sum_saturated(const planar_image& img, uint8_t* out, size_t out_len, const execution_policy& policy)
+    {
+        validate_output_buffer(out, out_len, img.pixel_count());
+
+        typedef void(*func_ptr_t)(const _internal::channel_info_extract_args_rgba&, uint8_t*);
 
         #if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = ARCH_X86_OVERLOAD_SELECT(
                 &_internal::rgba_sum_saturated_std,
                 &_internal::rgba_sum_saturated_sse2,
-                &_internal::rgba_sum_saturated_avx2
+                &_internal::rgba_sum_saturated_avx2,
+                &_internal::rgba_sum_saturated_avx512
             );
         #elif defined(LIEN_ARM_NEON) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = &_internal::rgba_sum_saturated_neon;
@@ -199,18 +427,41 @@ namespace ien::image_ops
         #endif
 
         _internal::channel_info_extract_args_rgba args(img);
-        return func(args);
+        run_tiled(policy, args, [&, kernel = func](const auto& tile_args, size_t offset)
+        {
+            kernel(tile_args, out + offset);
+        });
     }
 
-    fixed_vector<float> rgb_saturation(const planar_image& img)
+    fixed_vector<uint8_t> rgba_sum_saturated(const planar_image& img, const execution_policy& policy)
     {
-        typedef fixed_vector<float>(*func_ptr_t)(const _internal::channel_info_extract_args_rgb&);
+        fixed_vector<uint8_t> result(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT, img.cdata()->policy());
+        rgba_sum_saturated(img, result.data(), result.size(), policy);
+        return result;
+    }
+
+    void rgba_sum_saturated(const planar_image& img, fixed_vector<uint8_t>& out, const execution_policy& policy)
+    {
+        rgba_sum_saturated(img, out.data(), out.size(), policy);
+    }
+
+    void rgba_sum_saturated(planar_image& img, rgba_channel dst, const execution_policy& policy)
+    {
+        rgba_sum_saturated(img, channel_data(img, dst), img.pixel_count(), policy);
+    }
+
+    void rgb_saturation(const planar_image& img, float* out, size_t out_len, const execution_policy& policy)
+    {
+        validate_output_buffer(out, out_len, img.pixel_count());
+
+        typedef void(*func_ptr_t)(const _internal::channel_info_extract_args_rgb&, float*);
 
         #if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = ARCH_X86_OVERLOAD_SELECT(
                 &_internal::rgb_saturation_std,
                 &_internal::rgb_saturation_sse2,
-                &_internal::rgb_saturation_avx2
+                &_internal::rgb_saturation_avx2,
+                &_internal::rgb_saturation_avx512
             );
         #elif defined(LIEN_ARM_NEON) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = &_internal::rgb_saturation_neon;
@@ -219,18 +470,36 @@ namespace ien::image_ops
         #endif
 
         _internal::channel_info_extract_args_rgb args(img);
-        return func(args);
+        run_tiled(policy, args, [&, kernel = func](const auto& tile_args, size_t offset)
+        {
+            kernel(tile_args, out + offset);
+        });
     }
 
-    fixed_vector<float> rgb_luminance(const planar_image& img)
+    fixed_vector<float> rgb_saturation(const planar_image& img, const execution_policy& policy)
     {
-        typedef fixed_vector<float>(*func_ptr_t)(const _internal::channel_info_extract_args_rgb&);
+        fixed_vector<float> result(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT, img.cdata()->policy());
+        rgb_saturation(img, result.data(), result.size(), policy);
+        return result;
+    }
+
+    void rgb_saturation(const planar_image& img, fixed_vector<float>& out, const execution_policy& policy)
+    {
+        rgb_saturation(img, out.data(), out.size(), policy);
+    }
+
+    void rgb_luminance(const planar_image& img, float* out, size_t out_len, const execution_policy& policy)
+    {
+        validate_output_buffer(out, out_len, img.pixel_count());
+
+        typedef void(*func_ptr_t)(const _internal::channel_info_extract_args_rgb&, float*);
 
         #if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = ARCH_X86_OVERLOAD_SELECT(
                 &_internal::rgb_luminance_std,
                 &_internal::rgb_luminance_sse2,
-                &_internal::rgb_luminance_avx2
+                &_internal::rgb_luminance_avx2,
+                &_internal::rgb_luminance_avx512
             );
         #elif defined(LIEN_ARM_NEON) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = &_internal::rgb_luminance_neon;
@@ -239,15 +508,78 @@ namespace ien::image_ops
         #endif
 
         _internal::channel_info_extract_args_rgb args(img);
-        return func(args);
+        run_tiled(policy, args, [&, kernel = func](const auto& tile_args, size_t offset)
+        {
+            kernel(tile_args, out + offset);
+        });
     }
 
-	image_planar_data unpack_image_data(const uint8_t* data, size_t len)
+    fixed_vector<float> rgb_luminance(const planar_image& img, const execution_policy& policy)
+    {
+        fixed_vector<float> result(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT, img.cdata()->policy());
+        rgb_luminance(img, result.data(), result.size(), policy);
+        return result;
+    }
+
+    void rgb_luminance(const planar_image& img, fixed_vector<float>& out, const execution_policy& policy)
+    {
+        rgb_luminance(img, out.data(), out.size(), policy);
+    }
+
+    void rgb_metrics(const planar_image& img, rgb_metric metrics, const rgb_metrics_output& out, const execution_policy& policy)
+    {
+        typedef void(*func_ptr_t)(const _internal::rgb_metrics_args&);
+
+        if ((has_metric(metrics, rgb_metric::LUMINANCE) && out.luminance == nullptr)
+            || (has_metric(metrics, rgb_metric::SATURATION) && out.saturation == nullptr)
+            || (has_metric(metrics, rgb_metric::AVERAGE) && out.average == nullptr)
+            || (has_metric(metrics, rgb_metric::MAX) && out.max == nullptr)
+            || (has_metric(metrics, rgb_metric::MIN) && out.min == nullptr))
+        {
+            throw std::invalid_argument("Missing output buffer for requested rgb metric");
+        }
+
+        #if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
+            static func_ptr_t func = ARCH_X86_OVERLOAD_SELECT(
+                &_internal::rgb_metrics_std,
+                &_internal::rgb_metrics_sse2,
+                &_internal::rgb_metrics_avx2,
+                &_internal::rgb_metrics_avx512
+            );
+        #elif defined(LIEN_ARM_NEON) && defined(LIEN_USE_CUSTOM_SIMD)
+            static func_ptr_t func = &_internal::rgb_metrics_neon;
+        #else
+            static func_ptr_t func = &_internal::rgb_metrics_std;
+        #endif
+
+        _internal::rgb_metrics_args args(img, metrics, out);
+        run_tiled(policy, args, [&, kernel = func](const auto& tile_args, size_t)
+        {
+            kernel(tile_args);
+        });
+    }
+
+    image_planar_data unpack_image_data(const uint8_t* data, size_t len)
+    {
+        image_planar_data result(len / 4);
+        unpack_image_data(data, len, result);
+        return result;
+    }
+
+	void unpack_image_data(const uint8_t* data, size_t len, image_planar_data& out)
 	{
-		typedef image_planar_data(*func_ptr_t)(const uint8_t*, size_t len);
+        if (out.size() < (len / 4))
+        {
+            throw std::invalid_argument("Output planar data is smaller than the unpacked pixel count");
+        }
+
+		typedef void(*func_ptr_t)(const uint8_t*, size_t len, image_planar_data&);
 
 		#if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = 
+                HAS_AVX512()
+                    ? &_internal::unpack_image_data_avx512
+                    :
                 HAS_AVX2()
                     ? &_internal::unpack_image_data_avx2
                     :
@@ -260,19 +592,64 @@ namespace ien::image_ops
             static func_ptr_t func = &_internal::unpack_image_data_std;
 		#endif
 
-		return func(data, len);
+		func(data, len, out);
 	}
 
-    fixed_vector<uint8_t> channel_compare(const planar_image& img, rgba_channel channel, uint8_t threshold)
+    fixed_vector<uint8_t> pack_image_data(const image_planar_data& data, const execution_policy& policy)
+    {
+        fixed_vector<uint8_t> result(data.size() * 4, LIEN_DEFAULT_ALIGNMENT, data.policy());
+        pack_image_data(data, result.data(), policy);
+        return result;
+    }
+
+    void pack_image_data(const image_planar_data& data, fixed_vector<uint8_t>& out, const execution_policy& policy)
+    {
+        pack_image_data(data, out.data(), out.size(), policy);
+    }
+
+    void pack_image_data(const image_planar_data& data, uint8_t* out, size_t out_len, const execution_policy& policy)
     {
-        typedef fixed_vector<uint8_t>(*func_ptr_t)(const _internal::channel_compare_args& args);
+        validate_output_buffer(out, out_len, data.size() * 4);
+        pack_image_data(data, out, policy);
+    }
+
+    void pack_image_data(const image_planar_data& data, uint8_t* out, const execution_policy& policy)
+    {
+        typedef void(*func_ptr_t)(const _internal::channel_info_extract_args_rgba&, uint8_t*);
+
+        #if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
+            static func_ptr_t func = ARCH_X86_OVERLOAD_SELECT(
+                &_internal::pack_image_data_std,
+                &_internal::pack_image_data_sse2,
+                &_internal::pack_image_data_avx2,
+                &_internal::pack_image_data_avx512
+            );
+        #elif defined(LIEN_ARM_NEON) && defined(LIEN_USE_CUSTOM_SIMD)
+            static func_ptr_t func = &_internal::pack_image_data_neon;
+        #else
+            static func_ptr_t func = &_internal::pack_image_data_std;
+        #endif
+
+        _internal::channel_info_extract_args_rgba args(data);
+        run_tiled(policy, args, [&, kernel = func](const auto& tile_args, size_t offset)
+        {
+            kernel(tile_args, out + (offset * 4));
+        });
+    }
+
+    void channel_compare(const planar_image& img, rgba_channel channel, uint8_t threshold, uint8_t* out, size_t out_len, const execution_policy& policy)
+    {
+        validate_output_buffer(out, out_len, img.pixel_count());
+
+        typedef void(*func_ptr_t)(const _internal::channel_compare_args& args, uint8_t*);
         
         #if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = ARCH_X86_OVERLOAD_SELECT(
-                    &_internal::channel_compare_avx2,
-                    &_internal::channel_compare_sse2,
-                    &_internal::channel_compare_std
-                );
+                &_internal::channel_compare_std,
+                &_internal::channel_compare_sse2,
+                &_internal::channel_compare_avx2,
+                &_internal::channel_compare_avx512
+            );
         #elif defined(LIEN_ARM_NEON) && defined(LIEN_USE_CUSTOM_SIMD)
             static func_ptr_t func = &_internal::channel_compare_neon;
 		#else
@@ -280,6 +657,331 @@ namespace ien::image_ops
 		#endif
 
         _internal::channel_compare_args args(img, channel, threshold);
-		return func(args);
+        run_tiled(policy, args, [&, kernel = func](const auto& tile_args, size_t offset)
+        {
+            kernel(tile_args, out + offset);
+        });
+    }
+
+    fixed_vector<uint8_t> channel_compare(const planar_image& img, rgba_channel channel, uint8_t threshold, const execution_policy& policy)
+    {
+        fixed_vector<uint8_t> result(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT, img.cdata()->policy());
+        channel_compare(img, channel, threshold, result.data(), result.size(), policy);
+        return result;
+    }
+
+    void channel_compare(const planar_image& img, rgba_channel channel, uint8_t threshold, fixed_vector<uint8_t>& out, const execution_policy& policy)
+    {
+        channel_compare(img, channel, threshold, out.data(), out.size(), policy);
+    }
+
+    void channel_compare(planar_image& img, rgba_channel channel, uint8_t threshold, rgba_channel dst, const execution_policy& policy)
+    {
+        channel_compare(img, channel, threshold, channel_data(img, dst), img.pixel_count(), policy);
+    }
+
+    image_histogram histogram(const planar_image& img, const execution_policy& policy)
+    {
+        image_histogram result;
+        result.pixel_count = img.pixel_count();
+
+        std::mutex merge_mux;
+        _internal::channel_info_extract_args_rgba args(*img.cdata());
+        run_tiled(policy, args, [&](const auto& tile_args, size_t)
+        {
+            std::array<uint64_t, 4 * 256> bins = {};
+            _internal::rgba_histogram_std(tile_args, bins.data());
+
+            std::lock_guard<std::mutex> lock(merge_mux);
+            for (size_t ch = 0; ch < 4; ++ch)
+            {
+                for (size_t bin = 0; bin < 256; ++bin)
+                {
+                    result.bins[ch][bin] += bins[(ch * 256) + bin];
+                }
+            }
+        });
+        return result;
+    }
+
+    image_stats statistics(const planar_image& img, const execution_policy& policy)
+    {
+        typedef void(*func_ptr_t)(const _internal::channel_info_extract_args_rgba&, _internal::rgba_reduction&);
+
+        #if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
+            static func_ptr_t func = ARCH_X86_OVERLOAD_SELECT(
+                &_internal::rgba_reduce_std,
+                &_internal::rgba_reduce_sse2,
+                &_internal::rgba_reduce_avx2,
+                &_internal::rgba_reduce_avx512
+            );
+        #elif defined(LIEN_ARM_NEON) && defined(LIEN_USE_CUSTOM_SIMD)
+            static func_ptr_t func = &_internal::rgba_reduce_neon;
+        #else
+            static func_ptr_t func = &_internal::rgba_reduce_std;
+        #endif
+
+        _internal::rgba_reduction total;
+        std::mutex merge_mux;
+        _internal::channel_info_extract_args_rgba args(*img.cdata());
+        run_tiled(policy, args, [&, kernel = func](const auto& tile_args, size_t)
+        {
+            _internal::rgba_reduction partial;
+            kernel(tile_args, partial);
+
+            std::lock_guard<std::mutex> lock(merge_mux);
+            total.merge(partial);
+        });
+
+        image_stats result;
+        result.pixel_count = img.pixel_count();
+        if (result.pixel_count == 0)
+        {
+            return result;
+        }
+
+        const double count = static_cast<double>(result.pixel_count);
+        for (size_t ch = 0; ch < 4; ++ch)
+        {
+            channel_stats& stats = result.channels[ch];
+            stats.min = total.min[ch];
+            stats.max = total.max[ch];
+            stats.mean = static_cast<double>(total.sum[ch]) / count;
+            stats.variance = std::max(0.0, (static_cast<double>(total.sum_sq[ch]) / count) - (stats.mean * stats.mean));
+        }
+        return result;
+    }
+
+    void resize(const planar_image& src, planar_image& dst, resize_filter filter, const execution_policy& policy)
+    {
+        typedef void(*func_ptr_t)(const _internal::resample_args&);
+
+        #if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
+            static func_ptr_t horizontal = ARCH_X86_OVERLOAD_SELECT(
+                &_internal::resample_horizontal_std,
+                &_internal::resample_horizontal_sse2,
+                &_internal::resample_horizontal_avx2,
+                &_internal::resample_horizontal_avx2
+            );
+            static func_ptr_t vertical = ARCH_X86_OVERLOAD_SELECT(
+                &_internal::resample_vertical_std,
+                &_internal::resample_vertical_sse2,
+                &_internal::resample_vertical_avx2,
+                &_internal::resample_vertical_avx2
+            );
+        #elif defined(LIEN_ARM_NEON) && defined(LIEN_USE_CUSTOM_SIMD)
+            static func_ptr_t horizontal = &_internal::resample_horizontal_neon;
+            static func_ptr_t vertical = &_internal::resample_vertical_neon;
+        #else
+            static func_ptr_t horizontal = &_internal::resample_horizontal_std;
+            static func_ptr_t vertical = &_internal::resample_vertical_std;
+        #endif
+
+        const size_t in_w = src.width();
+        const size_t in_h = src.height();
+        const size_t out_w = dst.width();
+        const size_t out_h = dst.height();
+
+        if (in_w == 0 || in_h == 0 || out_w == 0 || out_h == 0)
+        {
+            throw std::invalid_argument("Unable to resize from or to an empty image");
+        }
+
+        const _internal::resample_coeffs coeffs_h = _internal::build_resample_coeffs(in_w, out_w, filter);
+        const _internal::resample_coeffs coeffs_v = _internal::build_resample_coeffs(in_h, out_h, filter);
+        const bool scale_h = (in_w != out_w);
+        const bool scale_v = (in_h != out_h);
+
+        // Run the cheaper pass order, costs are in multiply-adds. Unchanged axes skip their pass
+        const size_t cost_hv = (scale_h ? in_h * out_w * coeffs_h.taps : 0) + (scale_v ? out_h * out_w * coeffs_v.taps : 0);
+        const size_t cost_vh = (scale_v ? out_h * in_w * coeffs_v.taps : 0) + (scale_h ? out_h * out_w * coeffs_h.taps : 0);
+        const bool horizontal_first = cost_hv <= cost_vh;
+
+        fixed_vector<uint8_t> temp((scale_h && scale_v) ? (horizontal_first ? (out_w * in_h) : (in_w * out_h)) : 0);
+
+        auto run_horizontal = [&](const uint8_t* in, uint8_t* out, size_t rows)
+        {
+            run_rows(policy, rows, out_w, [&](size_t begin, size_t end)
+            {
+                _internal::resample_args args;
+                args.coeffs = &coeffs_h;
+                args.src = in;
+                args.dst = out;
+                args.row_begin = begin;
+                args.row_end = end;
+                horizontal(args);
+            });
+        };
+
+        auto run_vertical = [&](const uint8_t* in, uint8_t* out, size_t width)
+        {
+            run_rows(policy, out_h, width, [&](size_t begin, size_t end)
+            {
+                _internal::resample_args args;
+                args.coeffs = &coeffs_v;
+                args.src = in;
+                args.dst = out;
+                args.width = width;
+                args.row_begin = begin;
+                args.row_end = end;
+                vertical(args);
+            });
+        };
+
+        const uint8_t* src_planes[4] = { src.cdata()->cdata_r(), src.cdata()->cdata_g(), src.cdata()->cdata_b(), src.cdata()->cdata_a() };
+        uint8_t* dst_planes[4] = { dst.data()->data_r(), dst.data()->data_g(), dst.data()->data_b(), dst.data()->data_a() };
+
+        for (size_t p = 0; p < 4; ++p)
+        {
+            if (scale_h && scale_v)
+            {
+                if (horizontal_first)
+                {
+                    run_horizontal(src_planes[p], temp.data(), in_h);
+                    run_vertical(temp.cdata(), dst_planes[p], out_w);
+                }
+                else
+                {
+                    run_vertical(src_planes[p], temp.data(), in_w);
+                    run_horizontal(temp.cdata(), dst_planes[p], out_h);
+                }
+            }
+            else if (scale_h)
+            {
+                run_horizontal(src_planes[p], dst_planes[p], in_h);
+            }
+            else if (scale_v)
+            {
+                run_vertical(src_planes[p], dst_planes[p], in_w);
+            }
+            else
+            {
+                std::memcpy(dst_planes[p], src_planes[p], src.pixel_count());
+            }
+        }
+    }
+
+    planar_image resize(const planar_image& src, size_t width, size_t height, resize_filter filter, const execution_policy& policy)
+    {
+        planar_image result(width, height, src.cdata()->policy());
+        resize(src, result, filter, policy);
+        return result;
+    }
+
+    // Pixels needed to hold 'len' payload bytes, validating the request against the image
+    static size_t lsb_pixel_count(const planar_image& img, int bits_r, int bits_g, int bits_b, int bits_a, size_t len)
+    {
+        const size_t capacity = lsb_capacity(img, bits_r, bits_g, bits_b, bits_a);
+        if (len > capacity)
+        {
+            throw std::invalid_argument("Payload exceeds the LSB capacity of the image");
+        }
+        const size_t pixel_bits = static_cast<size_t>(bits_r + bits_g + bits_b + bits_a);
+        return (len == 0) ? 0 : (((len * 8) + pixel_bits - 1) / pixel_bits);
+    }
+
+    size_t lsb_capacity(const planar_image& img, int bits_r, int bits_g, int bits_b, int bits_a)
+    {
+        for (int bits : { bits_r, bits_g, bits_b, bits_a })
+        {
+            if (bits < 0 || bits > 8)
+            {
+                throw std::invalid_argument("LSB bit count must be between 0 and 8");
+            }
+        }
+        return (img.pixel_count() * static_cast<size_t>(bits_r + bits_g + bits_b + bits_a)) / 8;
+    }
+
+#if defined(LIEN_ARCH_X86_64) || defined(LIEN_ARCH_X86)
+    // The args members are evaluated here rather than in the BMI2 object
+    void _internal::lsb_embed_avx2_bmi2(const lsb_embed_args& args)
+    {
+        const size_t done = lsb_embed_blocks_avx2_bmi2(args, static_cast<size_t>(args.pixel_bits()), args.pixel_mask());
+        if (done < args.len)
+        {
+            lsb_embed_std(args.subrange(done, args.len - done));
+        }
+    }
+
+    void _internal::lsb_extract_avx2_bmi2(const lsb_extract_args& args)
+    {
+        const size_t done = lsb_extract_blocks_avx2_bmi2(args, static_cast<size_t>(args.pixel_bits()), args.pixel_mask());
+        if (done < args.len)
+        {
+            lsb_extract_std(args.subrange(done, args.len - done));
+        }
+    }
+#endif
+
+    void lsb_embed(planar_image& img, int bits_r, int bits_g, int bits_b, int bits_a, const uint8_t* payload, size_t len, const execution_policy& policy)
+    {
+        typedef void(*func_ptr_t)(const _internal::lsb_embed_args&);
+
+        // No NEON kernel yet, ARM uses the scalar one
+        #if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
+            static func_ptr_t func = (HAS_AVX2() && HAS_BMI2())
+                ? &_internal::lsb_embed_avx2_bmi2
+                : &_internal::lsb_embed_std;
+        #else
+            static func_ptr_t func = &_internal::lsb_embed_std;
+        #endif
+
+        _internal::lsb_embed_args args;
+        args.len = lsb_pixel_count(img, bits_r, bits_g, bits_b, bits_a, len);
+        args.ch_r = img.data()->data_r();
+        args.ch_g = img.data()->data_g();
+        args.ch_b = img.data()->data_b();
+        args.ch_a = img.data()->data_a();
+        args.bits_r = bits_r;
+        args.bits_g = bits_g;
+        args.bits_b = bits_b;
+        args.bits_a = bits_a;
+        args.payload = payload;
+        args.payload_len = len;
+
+        // Tiles start on multiples of TILE_ALIGNMENT pixels, so their payload starts on a byte boundary
+        run_tiled(policy, args, [kernel = func](const auto& tile_args, size_t)
+        {
+            kernel(tile_args);
+        });
+    }
+
+    void lsb_extract(const planar_image& img, int bits_r, int bits_g, int bits_b, int bits_a, uint8_t* out, size_t len, const execution_policy& policy)
+    {
+        typedef void(*func_ptr_t)(const _internal::lsb_extract_args&);
+
+        // No NEON kernel yet, ARM uses the scalar one
+        #if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
+            static func_ptr_t func = (HAS_AVX2() && HAS_BMI2())
+                ? &_internal::lsb_extract_avx2_bmi2
+                : &_internal::lsb_extract_std;
+        #else
+            static func_ptr_t func = &_internal::lsb_extract_std;
+        #endif
+
+        _internal::lsb_extract_args args;
+        args.len = lsb_pixel_count(img, bits_r, bits_g, bits_b, bits_a, len);
+        args.ch_r = img.cdata()->cdata_r();
+        args.ch_g = img.cdata()->cdata_g();
+        args.ch_b = img.cdata()->cdata_b();
+        args.ch_a = img.cdata()->cdata_a();
+        args.bits_r = bits_r;
+        args.bits_g = bits_g;
+        args.bits_b = bits_b;
+        args.bits_a = bits_a;
+        args.payload = out;
+        args.payload_len = len;
+
+        run_tiled(policy, args, [kernel = func](const auto& tile_args, size_t)
+        {
+            kernel(tile_args);
+        });
+    }
+
+    fixed_vector<uint8_t> lsb_extract(const planar_image& img, int bits_r, int bits_g, int bits_b, int bits_a, size_t len, const execution_policy& policy)
+    {
+        fixed_vector<uint8_t> result(len);
+        lsb_extract(img, bits_r, bits_g, bits_b, bits_a, result.data(), len, policy);
+        return result;
     }
 }
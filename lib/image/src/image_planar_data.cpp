@@ -2,46 +2,45 @@
 
 #include <ien/arithmetic.hpp>
 #include <ien/assert.hpp>
+#include <ien/image_ops.hpp>
 #include <ien/platform.hpp>
 
 #include <array>
 #include <cstring>
+#include <new>
 
 namespace ien
 {
+    static size_t plane_stride(size_t pixel_count)
+    {
+        return ((pixel_count + LIEN_CACHE_LINE_SIZE - 1) / LIEN_CACHE_LINE_SIZE) * LIEN_CACHE_LINE_SIZE;
+    }
+
     image_planar_data::image_planar_data(size_t pixel_count)
-        : _r(reinterpret_cast<uint8_t*>(ien::aligned_alloc(pixel_count, LIEN_DEFAULT_ALIGNMENT)))
-        , _g(reinterpret_cast<uint8_t*>(ien::aligned_alloc(pixel_count, LIEN_DEFAULT_ALIGNMENT)))
-        , _b(reinterpret_cast<uint8_t*>(ien::aligned_alloc(pixel_count, LIEN_DEFAULT_ALIGNMENT)))
-        , _a(reinterpret_cast<uint8_t*>(ien::aligned_alloc(pixel_count, LIEN_DEFAULT_ALIGNMENT)))
-        , _alignment(LIEN_DEFAULT_ALIGNMENT)
-        , _size(pixel_count)        
+        : image_planar_data(pixel_count, allocators::alloc_policy::HEAP)
     { }
 
+    image_planar_data::image_planar_data(size_t pixel_count, allocators::alloc_policy policy)
+        : _alignment(LIEN_CACHE_LINE_SIZE)
+        , _policy(policy)
+    {
+        allocate_planes(pixel_count);
+    }
+
     image_planar_data::~image_planar_data()
     {
         if(!_moved)
         {
-            ien::aligned_free(_r);
-            ien::aligned_free(_g);
-            ien::aligned_free(_b);
-            ien::aligned_free(_a);
+            release_planes();
         }
     }
 
     image_planar_data::image_planar_data(const image_planar_data& cp_src)
-        : _r(reinterpret_cast<uint8_t*>(ien::aligned_alloc(cp_src._size, cp_src._alignment)))
-        , _g(reinterpret_cast<uint8_t*>(ien::aligned_alloc(cp_src._size, cp_src._alignment)))
-        , _b(reinterpret_cast<uint8_t*>(ien::aligned_alloc(cp_src._size, cp_src._alignment)))
-        , _a(reinterpret_cast<uint8_t*>(ien::aligned_alloc(cp_src._size, cp_src._alignment)))
-        , _alignment(cp_src._alignment)
-        , _size(cp_src._size)
-        , _moved(cp_src._moved)
+        : _alignment(cp_src._alignment)
+        , _policy(cp_src._policy)
     {
-        std::memcpy(_r, cp_src._r, cp_src._size);
-        std::memcpy(_g, cp_src._g, cp_src._size);
-        std::memcpy(_b, cp_src._b, cp_src._size);
-        std::memcpy(_a, cp_src._a, cp_src._size);
+        allocate_planes(cp_src._size);
+        std::memcpy(_r, cp_src._r, _stride * 4);
     }
 
 	image_planar_data::image_planar_data(image_planar_data&& mv_src) noexcept
@@ -51,6 +50,8 @@ namespace ien
         , _a(mv_src._a)
         , _alignment(mv_src._alignment)
         , _size(mv_src._size)
+        , _stride(mv_src._stride)
+        , _policy(mv_src._policy)
         , _moved(false)
     {
         mv_src._moved = true;
@@ -59,20 +60,55 @@ namespace ien
 		mv_src._b = nullptr;
 		mv_src._a = nullptr;
 		mv_src._size = 0;
+		mv_src._stride = 0;
     }
 
     void image_planar_data::operator=(image_planar_data&& mv_src) noexcept
     {
+        if(this == &mv_src) { return; }
+        if(!_moved) { release_planes(); }
+
         _r = mv_src._r;
         _g = mv_src._g;
         _b = mv_src._b;
         _a = mv_src._a;
         _alignment = mv_src._alignment;
         _size = mv_src._size;
+        _stride = mv_src._stride;
+        _policy = mv_src._policy;
         _moved = mv_src._moved;
         mv_src._moved = true;
     }
 
+    void image_planar_data::allocate_planes(size_t pixel_count)
+    {
+        _size = pixel_count;
+        _stride = plane_stride(pixel_count);
+
+        const size_t block_size = safe_mul<size_t>(_stride, 4);
+        _r = reinterpret_cast<uint8_t*>(allocators::policy_alloc(block_size, _alignment, _policy));
+
+        if(_r == nullptr) { throw std::bad_alloc(); }
+
+        _g = _r + _stride;
+        _b = _g + _stride;
+        _a = _b + _stride;
+
+        const size_t padding = _stride - _size;
+        std::memset(_r + _size, 0, padding);
+        std::memset(_g + _size, 0, padding);
+        std::memset(_b + _size, 0, padding);
+        std::memset(_a + _size, 0, padding);
+    }
+
+    void image_planar_data::release_planes()
+    {
+        // _r is the start of the block
+        allocators::policy_free(_r, _stride * 4, _policy);
+
+        _r = _g = _b = _a = nullptr;
+    }
+
     uint8_t* image_planar_data::data_r() noexcept { return _r; }
     uint8_t* image_planar_data::data_g() noexcept { return _g; }
     uint8_t* image_planar_data::data_b() noexcept { return _b; }
@@ -85,12 +121,14 @@ namespace ien
 
     size_t image_planar_data::size() const noexcept { return _size; }
 
+    size_t image_planar_data::stride() const noexcept { return _stride; }
+
+    allocators::alloc_policy image_planar_data::policy() const noexcept { return _policy; }
+
     void image_planar_data::resize(size_t pixel_count)
     {
-        _r = reinterpret_cast<uint8_t*>(ien::aligned_realloc(_r, pixel_count, _alignment));
-        _g = reinterpret_cast<uint8_t*>(ien::aligned_realloc(_g, pixel_count, _alignment));
-        _b = reinterpret_cast<uint8_t*>(ien::aligned_realloc(_b, pixel_count, _alignment));
-        _a = reinterpret_cast<uint8_t*>(ien::aligned_realloc(_a, pixel_count, _alignment));
+        release_planes();
+        allocate_planes(pixel_count);
     }
 
     uint32_t image_planar_data::get_pixel(size_t index) const
@@ -108,15 +146,6 @@ namespace ien
 
     ien::fixed_vector<uint8_t> image_planar_data::pack_data() const
     {
-        ien::fixed_vector<uint8_t> result(this->size() * 4, _alignment);
-
-        for(size_t i = 0; i < _size; ++i)
-        {
-            result[(i * 4) + 0] = _r[i];
-            result[(i * 4) + 1] = _g[i];
-            result[(i * 4) + 2] = _b[i];
-            result[(i * 4) + 3] = _a[i];
-        }
-        return result;
+        return image_ops::pack_image_data(*this);
     }
 }
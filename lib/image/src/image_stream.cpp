@@ -0,0 +1,309 @@
+#include <ien/image_stream.hpp>
+
+#include <ien/arithmetic.hpp>
+#include <ien/image_ops.hpp>
+#include <ien/internal/image_stream_formats.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace ien
+{
+    void image_stream_reader::init(size_t width, size_t height)
+    {
+        if(width == 0 || height == 0)
+        {
+            throw std::runtime_error("Image has no pixels");
+        }
+        _width = width;
+        _height = height;
+        _row = fixed_vector<uint8_t>(safe_mul<size_t>(width, 4));
+    }
+
+    void image_stream_reader::read_row(uint8_t* rgba)
+    {
+        if(_next_row >= _height)
+        {
+            throw std::out_of_range("Every row of the image has already been read");
+        }
+        decode_row(rgba);
+        ++_next_row;
+    }
+
+    void image_stream_reader::read_row(uint8_t* r, uint8_t* g, uint8_t* b, uint8_t* a)
+    {
+        read_row(_row.data());
+
+        const uint8_t* src = _row.cdata();
+        for(size_t i = 0; i < _width; ++i)
+        {
+            r[i] = src[(i * 4) + 0];
+            g[i] = src[(i * 4) + 1];
+            b[i] = src[(i * 4) + 2];
+            a[i] = src[(i * 4) + 3];
+        }
+    }
+
+    bool image_stream_reader::read_strip(planar_image& strip, size_t max_rows)
+    {
+        const size_t rows = std::min(max_rows, rows_remaining());
+        if(rows == 0)
+        {
+            return false;
+        }
+
+        if(strip.width() != _width || strip.height() != rows)
+        {
+            strip = planar_image(_width, rows);
+        }
+
+        const size_t len = safe_mul<size_t>(_width, rows, 4);
+        if(_strip.size() < len)
+        {
+            _strip = fixed_vector<uint8_t>(len, LIEN_DEFAULT_ALIGNMENT);
+        }
+
+        for(size_t y = 0; y < rows; ++y)
+        {
+            read_row(_strip.data() + (y * _width * 4));
+        }
+        image_ops::unpack_image_data(_strip.cdata(), len, *strip.data());
+        return true;
+    }
+
+    void image_stream_writer::init(encode_sink& sink, size_t width, size_t height)
+    {
+        if(width == 0 || height == 0)
+        {
+            throw std::invalid_argument("Unable to write an image with no pixels");
+        }
+        _sink = &sink;
+        _width = width;
+        _height = height;
+        _row = fixed_vector<uint8_t>(safe_mul<size_t>(width, 4));
+    }
+
+    void image_stream_writer::write_row(const uint8_t* rgba)
+    {
+        if(_next_row >= _height)
+        {
+            throw std::out_of_range("Every row of the image has already been written");
+        }
+        encode_row(rgba);
+        ++_next_row;
+    }
+
+    void image_stream_writer::write_row(const uint8_t* r, const uint8_t* g, const uint8_t* b, const uint8_t* a)
+    {
+        uint8_t* dst = _row.data();
+        for(size_t i = 0; i < _width; ++i)
+        {
+            dst[(i * 4) + 0] = r[i];
+            dst[(i * 4) + 1] = g[i];
+            dst[(i * 4) + 2] = b[i];
+            dst[(i * 4) + 3] = a[i];
+        }
+        write_row(_row.cdata());
+    }
+
+    void image_stream_writer::write_strip(const planar_image& strip)
+    {
+        if(strip.width() != _width)
+        {
+            throw std::invalid_argument("Strip width does not match the image width");
+        }
+        if(strip.height() > rows_remaining())
+        {
+            throw std::out_of_range("Strip exceeds the image height");
+        }
+
+        const size_t len = safe_mul<size_t>(_width, strip.height(), 4);
+        if(_strip.size() < len)
+        {
+            _strip = fixed_vector<uint8_t>(len, LIEN_DEFAULT_ALIGNMENT);
+        }
+        image_ops::pack_image_data(*strip.cdata(), _strip.data(), len);
+
+        for(size_t y = 0; y < strip.height(); ++y)
+        {
+            write_row(_strip.cdata() + (y * _width * 4));
+        }
+    }
+
+    void image_stream_writer::finish()
+    {
+        if(_finished)
+        {
+            return;
+        }
+        if(_next_row != _height)
+        {
+            throw std::logic_error("Unable to finish an image with rows left to write");
+        }
+        encode_end();
+        _finished = true;
+    }
+
+    static bool has_extension(const std::string& path, const char* ext)
+    {
+        const size_t len = std::strlen(ext);
+        if(path.size() < len)
+        {
+            return false;
+        }
+        return std::equal(path.end() - len, path.end(), ext, [](char a, char b)
+        {
+            return std::tolower(static_cast<unsigned char>(a)) == b;
+        });
+    }
+
+    std::unique_ptr<image_stream_reader> open_image_reader(const std::string& path)
+    {
+        // Same exception planar_image threw for unreadable paths before streaming readers existed
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        if(file == nullptr)
+        {
+            throw std::invalid_argument("Unable to load image with path: " + path);
+        }
+
+        uint8_t signature[8] = {};
+        size_t signature_len = 0;
+        for(; signature_len < sizeof(signature); ++signature_len)
+        {
+            int c = std::fgetc(file);
+            if(c == EOF) { break; }
+            signature[signature_len] = static_cast<uint8_t>(c);
+        }
+        std::fclose(file);
+
+        static const uint8_t png_signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+        if(signature_len == 8 && std::memcmp(signature, png_signature, 8) == 0)
+        {
+#if defined(LIEN_IMAGE_ZLIB)
+            return std::make_unique<_internal::png_stream_reader>(path);
+#else
+            throw unsupported_image_format("PNG streaming requires zlib (LIEN_IMAGE_ZLIB): " + path);
+#endif
+        }
+        if(signature_len >= 2 && signature[0] == 'P' && (signature[1] == '6' || signature[1] == '7'))
+        {
+            return std::make_unique<_internal::pnm_stream_reader>(path);
+        }
+        if(has_extension(path, ".tga"))
+        {
+            return std::make_unique<_internal::tga_stream_reader>(path);
+        }
+        throw unsupported_image_format("Unsupported image stream format: " + path);
+    }
+
+    std::unique_ptr<image_stream_writer> open_image_writer(
+        const std::string& path,
+        image_stream_format format,
+        size_t width,
+        size_t height,
+        int compression_level)
+    {
+        auto sink = std::make_unique<file_sink>(path);
+        auto writer = open_image_writer(*sink, format, width, height, compression_level);
+        _internal::image_stream_access::own_sink(*writer, std::move(sink));
+        return writer;
+    }
+
+    std::unique_ptr<image_stream_writer> open_image_writer(
+        encode_sink& sink,
+        image_stream_format format,
+        size_t width,
+        size_t height,
+        int compression_level)
+    {
+        switch(format)
+        {
+        case image_stream_format::PNG:
+#if defined(LIEN_IMAGE_ZLIB)
+            return std::make_unique<_internal::png_stream_writer>(sink, width, height, compression_level);
+#else
+            static_cast<void>(compression_level);
+            throw std::runtime_error("PNG streaming requires zlib (LIEN_IMAGE_ZLIB)");
+#endif
+        case image_stream_format::TGA:
+            return std::make_unique<_internal::tga_stream_writer>(sink, width, height);
+        case image_stream_format::PPM:
+            return std::make_unique<_internal::pnm_stream_writer>(sink, width, height, false);
+        case image_stream_format::PAM:
+            return std::make_unique<_internal::pnm_stream_writer>(sink, width, height, true);
+        }
+        throw std::invalid_argument("Invalid image stream format");
+    }
+}
+
+namespace ien::_internal
+{
+    stream_file::stream_file(const std::string& path, const char* mode)
+        : _file(std::fopen(path.c_str(), mode))
+        , _path(path)
+    {
+        if(_file == nullptr)
+        {
+            fail(std::strerror(errno));
+        }
+    }
+
+    std::FILE* stream_file::handle() const noexcept { return _file.get(); }
+
+    void stream_file::read(void* dst, size_t len)
+    {
+        if(std::fread(dst, 1, len, _file.get()) != len)
+        {
+            fail("Unexpected end of file");
+        }
+    }
+
+    uint8_t stream_file::read_u8()
+    {
+        int c = std::fgetc(_file.get());
+        if(c == EOF)
+        {
+            fail("Unexpected end of file");
+        }
+        return static_cast<uint8_t>(c);
+    }
+
+    void stream_file::skip(long len)
+    {
+        if(std::fseek(_file.get(), len, SEEK_CUR) != 0)
+        {
+            fail("Seek failed");
+        }
+    }
+
+    void stream_file::seek(long offset)
+    {
+        if(std::fseek(_file.get(), offset, SEEK_SET) != 0)
+        {
+            fail("Seek failed");
+        }
+    }
+
+    long stream_file::tell() const
+    {
+        long pos = std::ftell(_file.get());
+        if(pos < 0)
+        {
+            fail("Unable to query the file position");
+        }
+        return pos;
+    }
+
+    void stream_file::fail(const std::string& reason) const
+    {
+        throw std::runtime_error(reason + ": " + _path);
+    }
+
+    void stream_file::unsupported(const std::string& reason) const
+    {
+        throw unsupported_image_format(reason + ": " + _path);
+    }
+}
\ No newline at end of file
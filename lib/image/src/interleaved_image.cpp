@@ -1,11 +1,13 @@
 #include <ien/interleaved_image.hpp>
 
 #include <ien/arithmetic.hpp>
+#include <ien/image_ops.hpp>
+#include <ien/image_stream.hpp>
+#include <ien/internal/encode_sink_adapter.hpp>
 #include <ien/planar_image.hpp>
 #include <ien/platform.hpp>
 
 #include <stb_image.h>
-#include <stb_image_resize.h>
 #include <stb_image_write.h>
 
 #include <cstring>
@@ -13,12 +15,13 @@
 
 namespace ien
 {
-    interleaved_image::interleaved_image(size_t width, size_t height)
+    interleaved_image::interleaved_image(size_t width, size_t height, allocators::alloc_policy policy)
         : image(width, height, image_type::INTERLEAVED)
     { 
         _data = std::make_unique<ien::fixed_vector<uint8_t>>(
             safe_mul<size_t>(_width, _height , 4),
-            LIEN_DEFAULT_ALIGNMENT
+            LIEN_DEFAULT_ALIGNMENT,
+            policy
         );
     }
 
@@ -35,12 +38,23 @@ namespace ien
             throw std::invalid_argument("Invalid image path or file format");
         }
 
-        _data = std::make_unique<ien::fixed_vector<uint8_t>>(
-            safe_mul<size_t>(_width, _height , 4),
-            LIEN_DEFAULT_ALIGNMENT
-        );
+        // stb allocates through ien::aligned_alloc, so the decoded buffer is adopted as is
+        _data = std::make_unique<ien::fixed_vector<uint8_t>>(ien::fixed_vector<uint8_t>::adopt(
+            stbdata,
+            safe_mul<size_t>(_width, _height, 4),
+            LIEN_DEFAULT_ALIGNMENT,
+            stbi_image_free
+        ));
+    }
 
-        std::copy(stbdata, stbdata + safe_mul<size_t>(_width, _height, 4), _data->data());
+    interleaved_image::interleaved_image(ien::fixed_vector<uint8_t>&& rgba_data, size_t width, size_t height)
+        : image(width, height, image_type::INTERLEAVED)
+    {
+        if(rgba_data.size() < safe_mul<size_t>(width, height, 4))
+        {
+            throw std::invalid_argument("Buffer is too small for the image dimensions");
+        }
+        _data = std::make_unique<ien::fixed_vector<uint8_t>>(std::move(rgba_data));
     }
 
     interleaved_image::interleaved_image(const interleaved_image& cp_src)
@@ -99,131 +113,79 @@ namespace ien
         return result;
     }
 
-    bool interleaved_image::save_to_file_png(const std::string& path, int compression_level) const
-    {
-        stbi_write_png_compression_level = compression_level;
-        return stbi_write_png(
-            path.c_str(), 
-            static_cast<int>(_width), 
-            static_cast<int>(_height), 
-            4, 
-            _data->data(), 
-            static_cast<int>(_width * 4)
-        );
-    }
-
-    bool interleaved_image::save_to_file_jpeg(const std::string& path, int quality) const
-    {
-        return stbi_write_jpg(
-            path.c_str(), 
-            static_cast<int>(_width), 
-            static_cast<int>(_height), 
-            4, 
-            _data->data(), 
-            quality
-        );
-    }
-
-    bool interleaved_image::save_to_file_tga(const std::string& path) const
-    {
-        return stbi_write_tga(
-            path.c_str(), 
-            static_cast<int>(_width), 
-            static_cast<int>(_height), 
-            4, 
-            _data->data()
-        );
-    }
-
-    static void save_to_memory_func(void* ctx, void* data, int size)
+    // Streams the rows through an image_stream_writer, stb would build the whole filtered image
+    // and its compressed copy first
+    static void encode_streamed(
+        const uint8_t* rgba,
+        size_t width,
+        size_t height,
+        encode_sink& sink,
+        image_stream_format format,
+        int compression_level = 4)
     {
-        printf("STBI REPORTED LEN: %d\n", size);
-        auto* vec = reinterpret_cast<ien::fixed_vector<uint8_t>*>(ctx);
-        
-        *vec = ien::fixed_vector<uint8_t>(size);
-        std::memcpy(vec->data(), data, size);
+        auto writer = open_image_writer(sink, format, width, height, compression_level);
+        for(size_t y = 0; y < height; ++y)
+        {
+            writer->write_row(rgba + (y * width * 4));
+        }
+        writer->finish();
     }
 
-    ien::fixed_vector<uint8_t> interleaved_image::save_to_memory_png(int compression_level) const
+    void interleaved_image::encode_png(encode_sink& sink, int compression_level) const
     {
-        ien::fixed_vector<uint8_t> result;
+#if defined(LIEN_IMAGE_ZLIB)
+        encode_streamed(_data->cdata(), _width, _height, sink, image_stream_format::PNG, compression_level);
+#else
+        _internal::encode_sink_adapter adapter(sink);
+        stbi_write_png_compression_level = compression_level;
         bool ok = stbi_write_png_to_func(
-            save_to_memory_func,
-            reinterpret_cast<void*>(&result),
+            &_internal::encode_sink_adapter::write_callback,
+            adapter.context(),
             static_cast<int>(_width),
             static_cast<int>(_height),
             4,
             _data->cdata(),
             static_cast<int>(_width * 4)
         );
-        
-        if(!ok) { throw std::runtime_error("Failed to write png data to memory"); }
-
-        return result;
+        adapter.finish(ok, "png");
+#endif
     }
 
-    ien::fixed_vector<uint8_t> interleaved_image::save_to_memory_jpeg(int quality) const
+    void interleaved_image::encode_jpeg(encode_sink& sink, int quality) const
     {
-        ien::fixed_vector<uint8_t> result;        
+        _internal::encode_sink_adapter adapter(sink);
         bool ok = stbi_write_jpg_to_func(
-            save_to_memory_func,
-            reinterpret_cast<void*>(&result), 
+            &_internal::encode_sink_adapter::write_callback,
+            adapter.context(),
             static_cast<int>(_width), 
             static_cast<int>(_height),
             4,
-            _data->data(),
+            _data->cdata(),
             quality
         );
-
-        if(!ok) { throw std::runtime_error("Failed to write jpeg data to memory"); }
-
-        return result;
+        adapter.finish(ok, "jpeg");
     }
 
-    ien::fixed_vector<uint8_t> interleaved_image::save_to_memory_tga() const
+    void interleaved_image::encode_tga(encode_sink& sink) const
     {
-        ien::fixed_vector<uint8_t> result;
-        bool ok = stbi_write_tga_to_func(
-            save_to_memory_func,
-            reinterpret_cast<void*>(&result), 
-            static_cast<int>(_width), 
-            static_cast<int>(_height),
-            4,
-            _data->data()
-        );
-
-        if(!ok) { throw std::runtime_error("Failed to write tga data to memory"); }
-
-        return result;
+        encode_streamed(_data->cdata(), _width, _height, sink, image_stream_format::TGA);
     }
 
-    void interleaved_image::resize_absolute(size_t w, size_t h)
+    void interleaved_image::resize_absolute(size_t w, size_t h, resize_filter filter)
     {
-        std::unique_ptr<ien::fixed_vector<uint8_t>> resized_data = std::make_unique<ien::fixed_vector<uint8_t>>(
-            safe_mul<size_t>(w, h, 4), 
-            _data->alignment()
-        );
-
-        stbir_resize_uint8(
-            _data->cdata(), 
-            static_cast<int>(_width), 
-            static_cast<int>(_height), 
-            4, 
-            resized_data->data(), 
-            static_cast<int>(w), 
-            static_cast<int>(h), 
-            4, 
-            4
-        );
-        _data = std::move(resized_data);
+        // Unpack and pack are single SIMD passes, the resampler itself only works on planes
+        const planar_image resized = image_ops::resize(to_planar_image(), w, h, filter);
+        _data = std::make_unique<ien::fixed_vector<uint8_t>>(image_ops::pack_image_data(*resized.cdata()));
+        _width = w;
+        _height = h;
     }
 
-    void interleaved_image::resize_relative(float w, float h)
+    void interleaved_image::resize_relative(float w, float h, resize_filter filter)
     {
         size_t real_w = static_cast<size_t>(safe_mul<float>(_width, w));
         size_t real_h = static_cast<size_t>(safe_mul<float>(_height, h));
 
-        resize_absolute(real_w, real_h);
+        resize_absolute(real_w, real_h, filter);
     }
 
     ien::fixed_vector<uint8_t> interleaved_image::get_rgba_buff_copy()
@@ -240,7 +202,8 @@ namespace ien
     {
         _data = std::make_unique<ien::fixed_vector<uint8_t>>(
             cp_src.pixel_count() * 4,
-            LIEN_DEFAULT_ALIGNMENT
+            LIEN_DEFAULT_ALIGNMENT,
+            cp_src._data->policy()
         );
         std::memcpy(_data->data(), cp_src.cdata(), cp_src.pixel_count() * 4);
         _width = cp_src._width;
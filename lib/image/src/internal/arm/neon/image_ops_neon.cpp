@@ -140,22 +140,21 @@ namespace ien::image_ops::_internal
         }
     }
 
-    fixed_vector<uint8_t> rgba_average_neon(const channel_info_extract_args_rgba& args)
+    void rgba_average_neon(const channel_info_extract_args_rgba& args, uint8_t* out)
     {        
         // not implemented
-        return rgba_average_std(args);
+        return rgba_average_std(args, out);
     }
 
-    fixed_vector<uint8_t> rgba_max_neon(const channel_info_extract_args_rgba& args)
+    void rgba_max_neon(const channel_info_extract_args_rgba& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
         if(img_sz < NEON_ALIGNMENT)
         {
-            return rgba_max_std(args);
+            return rgba_max_std(args, out);
         }
         BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
 
-        fixed_vector<uint8_t> result(args.len, NEON_ALIGNMENT);
         size_t last_v_idx = img_sz - (img_sz % NEON_ALIGNMENT);
         for (size_t i = 0; i < last_v_idx; i += NEON_ALIGNMENT)
         {
@@ -168,26 +167,24 @@ namespace ien::image_ops::_internal
             uint8x16_t vmax_ba = vmaxq_u8(vseg_b, vseg_a);
             uint8x16_t vmax_rgba = vmaxq_u8(vmax_rg, vmax_ba);
 
-            vst1q_u8(result.data() + i, vmax_rgba);
+            vst1q_u8(out + i, vmax_rgba);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            result[i] = std::max({r[i], g[i], b[i], a[i]});
+            out[i] = std::max({r[i], g[i], b[i], a[i]});
         }
-        return result;
     }
 
-    fixed_vector<uint8_t> rgba_min_neon(const channel_info_extract_args_rgba& args)
+    void rgba_min_neon(const channel_info_extract_args_rgba& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
         if(img_sz < NEON_ALIGNMENT)
         {
-            return rgba_min_std(args);
+            return rgba_min_std(args, out);
         }
         BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
 
-        fixed_vector<uint8_t> result(args.len, NEON_ALIGNMENT);
         size_t last_v_idx = img_sz - (img_sz % NEON_ALIGNMENT);
         for (size_t i = 0; i < last_v_idx; i += NEON_ALIGNMENT)
         {
@@ -200,32 +197,30 @@ namespace ien::image_ops::_internal
             uint8x16_t vmin_ba = vminq_u8(vseg_b, vseg_a);
             uint8x16_t vmin_rgba = vminq_u8(vmin_rg, vmin_ba);
 
-            vst1q_u8(result.data() + i, vmin_rgba);
+            vst1q_u8(out + i, vmin_rgba);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            result[i] = std::min({r[i], g[i], b[i], a[i]});
+            out[i] = std::min({r[i], g[i], b[i], a[i]});
         }
-        return result;
     }
 
-    fixed_vector<float> rgb_average_neon(const channel_info_extract_args_rgb& args)
+    void rgb_average_neon(const channel_info_extract_args_rgb& args, float* out)
     {
-        return rgb_average_std(args);
+        return rgb_average_std(args, out);
         // Not implemented...
     }
 
-    fixed_vector<uint8_t> rgb_max_neon(const channel_info_extract_args_rgb& args)
+    void rgb_max_neon(const channel_info_extract_args_rgb& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
         if(img_sz < NEON_ALIGNMENT)
         {
-            return rgb_max_std(args);
+            return rgb_max_std(args, out);
         }
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
-        fixed_vector<uint8_t> result(args.len, NEON_ALIGNMENT);
         size_t last_v_idx = img_sz - (img_sz % NEON_ALIGNMENT);
         for (size_t i = 0; i < last_v_idx; i += NEON_ALIGNMENT)
         {
@@ -236,26 +231,24 @@ namespace ien::image_ops::_internal
             uint8x16_t vmax_rg = vmaxq_u8(vseg_r, vseg_g);
             uint8x16_t vmax_rgb = vmaxq_u8(vseg_b, vseg_b);
 
-            vst1q_u8(result.data() + i, vmax_rgb);
+            vst1q_u8(out + i, vmax_rgb);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            result[i] = std::max({ r[i], g[i], b[i] });
+            out[i] = std::max({ r[i], g[i], b[i] });
         }
-        return result;
     }
 
-    fixed_vector<uint8_t> rgb_min_neon(const channel_info_extract_args_rgb& args)
+    void rgb_min_neon(const channel_info_extract_args_rgb& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
         if(img_sz < NEON_ALIGNMENT)
         {
-            return rgb_min_std(args);
+            return rgb_min_std(args, out);
         }
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
-        fixed_vector<uint8_t> result(args.len, NEON_ALIGNMENT);
         size_t last_v_idx = img_sz - (img_sz % NEON_ALIGNMENT);
         for (size_t i = 0; i < last_v_idx; i += NEON_ALIGNMENT)
         {
@@ -266,26 +259,24 @@ namespace ien::image_ops::_internal
             uint8x16_t vmin_rg = vminq_u8(vseg_r, vseg_g);
             uint8x16_t vmin_rgb = vminq_u8(vmin_rg, vseg_b);
 
-            vst1q_u8(result.data() + i, vmin_rgb);
+            vst1q_u8(out + i, vmin_rgb);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            result[i] = std::min({r[i], g[i], b[i] });
+            out[i] = std::min({r[i], g[i], b[i] });
         }
-        return result;
     }
 
-    fixed_vector<uint8_t> rgba_sum_saturated_neon(const channel_info_extract_args_rgba& args)
+    void rgba_sum_saturated_neon(const channel_info_extract_args_rgba& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
         if(img_sz < NEON_ALIGNMENT)
         {
-            return rgba_sum_saturated_std(args);
+            return rgba_sum_saturated_std(args, out);
         }
         BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
 
-        fixed_vector<uint8_t> result(args.len, NEON_ALIGNMENT);
         size_t last_v_idx = img_sz - (img_sz % NEON_ALIGNMENT);
         for (size_t i = 0; i < last_v_idx; i += NEON_ALIGNMENT)
         {
@@ -298,28 +289,25 @@ namespace ien::image_ops::_internal
             uint8x16_t vsum_ba = vqaddq_u8(vseg_b, vseg_a);
             uint8x16_t vsum_rgba = vqaddq_u8(vsum_rg, vsum_ba);
 
-            vst1q_u8(result.data() + i, vsum_rgba);
+            vst1q_u8(out + i, vsum_rgba);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
             uint16_t sum = static_cast<uint16_t>(r[i]) + g[i] + b[i] + a[i];
-            result[i] = static_cast<uint8_t>(std::min(static_cast<uint16_t>(255), sum));
+            out[i] = static_cast<uint8_t>(std::min(static_cast<uint16_t>(255), sum));
         }
-        return result;
     }    
 
-    fixed_vector<float> rgb_saturation_neon(const channel_info_extract_args_rgb& args)
+    void rgb_saturation_neon(const channel_info_extract_args_rgb& args, float* out)
     {
         const size_t img_sz = args.len;
         if(img_sz < NEON_ALIGNMENT)
         {
-            return rgb_saturation_std(args);
+            return rgb_saturation_std(args, out);
         }
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
-        fixed_vector<float> result(args.len, NEON_ALIGNMENT);
-
         size_t last_v_idx = img_sz - (img_sz % NEON_ALIGNMENT);
         for (size_t i = 0; i < last_v_idx; i += NEON_ALIGNMENT)
         {
@@ -341,7 +329,7 @@ namespace ien::image_ops::_internal
             for(int vidx = 0; vidx < 4; ++vidx)
             {
                 float32x4_t vfsat = neon_divide_f32(vfdiffq.val[vidx], vfmaxq.val[vidx], 2);
-                float* dest_ptr = result.data() + i + (vidx * 4);
+                float* dest_ptr = out + i + (vidx * 4);
                 vst1q_f32(dest_ptr, vfsat);
             }
         }
@@ -350,23 +338,19 @@ namespace ien::image_ops::_internal
         {
             float vmax = static_cast<float>(std::max({ r[i], g[i], b[i] })) / 255.0F;
             float vmin = static_cast<float>(std::min({ r[i], g[i], b[i] })) / 255.0F;
-            result[i] = (vmax - vmin) / vmax;
+            out[i] = (vmax - vmin) / vmax;
         }
-
-        return result;
     }
 
-    fixed_vector<float> rgb_luminance_neon(const channel_info_extract_args_rgb& args)
+    void rgb_luminance_neon(const channel_info_extract_args_rgb& args, float* out)
     {
         const size_t img_sz = args.len;
         if(img_sz < NEON_ALIGNMENT)
         {
-            return rgb_luminance_std(args);
+            return rgb_luminance_std(args, out);
         }
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
-        fixed_vector<float> result(args.len, NEON_ALIGNMENT);
-
         const float div_255 = 1.0F / 255;
         const float lum_mul_r = 0.2126F;
         const float lum_mul_g = 0.7152F;
@@ -413,35 +397,100 @@ namespace ien::image_ops::_internal
             vlum.val[2] = vmulq_f32(vlum.val[2], vdiv_255);
             vlum.val[3] = vmulq_f32(vlum.val[3], vdiv_255);
 
-            vst1q_f32(result.data() + i + 0, vlum.val[0]);
-            vst1q_f32(result.data() + i + 4, vlum.val[1]);
-            vst1q_f32(result.data() + i + 8, vlum.val[2]);
-            vst1q_f32(result.data() + i + 12, vlum.val[3]);
+            vst1q_f32(out + i + 0, vlum.val[0]);
+            vst1q_f32(out + i + 4, vlum.val[1]);
+            vst1q_f32(out + i + 8, vlum.val[2]);
+            vst1q_f32(out + i + 12, vlum.val[3]);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {            
-            result[i] = (r[i] * 0.2126F / 255) + (g[i] * 0.7152F / 255) + (b[i] * 0.0722F / 255);
+            out[i] = (r[i] * 0.2126F / 255) + (g[i] * 0.7152F / 255) + (b[i] * 0.0722F / 255);
         }
+    }
+
+    void rgb_metrics_neon(const rgb_metrics_args& args)
+    {
+        const size_t img_sz = args.len;
+        if(img_sz < NEON_ALIGNMENT)
+        {
+            return rgb_metrics_std(args);
+        }
+        BIND_CHANNELS_RGB_CONST(args, r, g, b);
+
+        const float32x4_t vlum_mul_r = vdupq_n_f32(0.2126F / 255);
+        const float32x4_t vlum_mul_g = vdupq_n_f32(0.7152F / 255);
+        const float32x4_t vlum_mul_b = vdupq_n_f32(0.0722F / 255);
+        const float32x4_t vmul_div3 = vdupq_n_f32(0.333334F);
+
+        const bool need_channels_f32 = args.luminance || args.average;
+
+        size_t last_v_idx = img_sz - (img_sz % NEON_ALIGNMENT);
+        for (size_t i = 0; i < last_v_idx; i += NEON_ALIGNMENT)
+        {
+            uint8x16_t vseg_r = vld1q_u8(r + i);
+            uint8x16_t vseg_g = vld1q_u8(g + i);
+            uint8x16_t vseg_b = vld1q_u8(b + i);
+
+            uint8x16_t vmax_rgb = vmaxq_u8(vmaxq_u8(vseg_r, vseg_g), vseg_b);
+            uint8x16_t vmin_rgb = vminq_u8(vminq_u8(vseg_r, vseg_g), vseg_b);
+
+            if(args.max) { vst1q_u8(args.max + i, vmax_rgb); }
+            if(args.min) { vst1q_u8(args.min + i, vmin_rgb); }
+
+            if(need_channels_f32)
+            {
+                float32x4x4_t vfr = extract_4x4f32_from_8x16u8(vseg_r);
+                float32x4x4_t vfg = extract_4x4f32_from_8x16u8(vseg_g);
+                float32x4x4_t vfb = extract_4x4f32_from_8x16u8(vseg_b);
+
+                for(int vidx = 0; vidx < 4; ++vidx)
+                {
+                    if(args.luminance)
+                    {
+                        float32x4_t vlum = vmulq_f32(vfr.val[vidx], vlum_mul_r);
+                        vlum = vmlaq_f32(vlum, vfg.val[vidx], vlum_mul_g);
+                        vlum = vmlaq_f32(vlum, vfb.val[vidx], vlum_mul_b);
+                        vst1q_f32(args.luminance + i + (vidx * 4), vlum);
+                    }
+                    if(args.average)
+                    {
+                        float32x4_t vsum = vaddq_f32(vaddq_f32(vfr.val[vidx], vfg.val[vidx]), vfb.val[vidx]);
+                        vst1q_f32(args.average + i + (vidx * 4), vmulq_f32(vsum, vmul_div3));
+                    }
+                }
+            }
 
-        return result;
+            if(args.saturation)
+            {
+                float32x4x4_t vfdiff = extract_4x4f32_from_8x16u8(vsubq_u8(vmax_rgb, vmin_rgb));
+                float32x4x4_t vfmax = extract_4x4f32_from_8x16u8(vmax_rgb);
+
+                for(int vidx = 0; vidx < 4; ++vidx)
+                {
+                    float32x4_t vfsat = neon_divide_f32(vfdiff.val[vidx], vfmax.val[vidx], 2);
+                    vst1q_f32(args.saturation + i + (vidx * 4), vfsat);
+                }
+            }
+        }
+
+        rgb_metrics_std(args.subrange(last_v_idx, img_sz - last_v_idx));
     }
 
-    image_planar_data unpack_image_data_neon(const uint8_t* data, size_t len)
+    void unpack_image_data_neon(const uint8_t* data, size_t len, image_planar_data& out)
     {
         if(len < NEON_ALIGNMENT)
         {
-            return unpack_image_data_std(data, len);
+            return unpack_image_data_std(data, len, out);
         }
-        image_planar_data result(len / 4);
 
-        uint8_t* r = result.data_r();
-        uint8_t* g = result.data_g();
-        uint8_t* b = result.data_b();
-        uint8_t* a = result.data_a();
+        uint8_t* r = out.data_r();
+        uint8_t* g = out.data_g();
+        uint8_t* b = out.data_b();
+        uint8_t* a = out.data_a();
 
-        size_t last_v_idx = len - (len % NEON_ALIGNMENT);
-        for(size_t i = 0; i < last_v_idx; i += NEON_ALIGNMENT)
+        size_t last_v_idx = len - (len % (NEON_ALIGNMENT * 4));
+        for(size_t i = 0; i < last_v_idx; i += NEON_ALIGNMENT * 4)
         {
             uint8x16x4_t vrgba = vld4q_u8(data + i);
             size_t vidx = i / 4;
@@ -451,7 +500,7 @@ namespace ien::image_ops::_internal
             vst1q_u8(a + (vidx), vrgba.val[3]);
         }
 
-        for (size_t i = last_v_idx; i < len; ++i)
+        for (size_t i = last_v_idx; i < len; i += 4)
         {
             size_t vidx = i / 4;
             r[vidx] = data[i + 0];
@@ -459,18 +508,45 @@ namespace ien::image_ops::_internal
             b[vidx] = data[i + 2];
             a[vidx] = data[i + 3];
         }
+    }
+
+    void pack_image_data_neon(const channel_info_extract_args_rgba& args, uint8_t* out)
+    {
+        const size_t len = args.len;
+        if(len < NEON_ALIGNMENT)
+        {
+            return pack_image_data_std(args, out);
+        }
+
+        BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
+
+        size_t last_v_idx = len - (len % NEON_ALIGNMENT);
+        for(size_t i = 0; i < last_v_idx; i += NEON_ALIGNMENT)
+        {
+            uint8x16x4_t vrgba;
+            vrgba.val[0] = vld1q_u8(r + i);
+            vrgba.val[1] = vld1q_u8(g + i);
+            vrgba.val[2] = vld1q_u8(b + i);
+            vrgba.val[3] = vld1q_u8(a + i);
+            vst4q_u8(out + (i * 4), vrgba);
+        }
 
-        return result;
+        for (size_t i = last_v_idx; i < len; ++i)
+        {
+            out[(i * 4) + 0] = r[i];
+            out[(i * 4) + 1] = g[i];
+            out[(i * 4) + 2] = b[i];
+            out[(i * 4) + 3] = a[i];
+        }
     }
 
-    fixed_vector<uint8_t> channel_compare_neon(const channel_compare_args& args)
+    void channel_compare_neon(const channel_compare_args& args, uint8_t* out)
     {
         const size_t len = args.len;
         if (len < NEON_ALIGNMENT)
         {
-            return channel_compare_std(args);
+            return channel_compare_std(args, out);
         }
-        fixed_vector<uint8_t> result(len, NEON_ALIGNMENT);
         const uint8x16_t vthreshold = vld1q_dup_u8(&args.threshold);
 
         size_t last_v_idx = len - (len % (NEON_ALIGNMENT));
@@ -478,15 +554,183 @@ namespace ien::image_ops::_internal
         {
             uint8x16_t vseg = vld1q_u8(args.ch + i);
             uint8x16_t vcmp = vcgeq_u8(vseg, vthreshold);
-            vst1q_u8(result.data() + i, vcmp);
+            vst1q_u8(out + i, vcmp);
         }
 
         for (size_t i = last_v_idx; i < len; ++i)
         {
-            result[i] = args.ch[i] >= args.threshold;
+            out[i] = args.ch[i] >= args.threshold;
         }
+    }
+
+    // The 32-bit square accumulators grow by at most 4 * 255^2 per iteration,
+    // they are widened to 64 bits well before they could overflow
+    const size_t REDUCE_FLUSH_INTERVAL = 8192;
+
+    static void reduce_channel_neon(const uint8_t* data, size_t len, rgba_reduction& out, size_t ch)
+    {
+        uint64x2_t vsum = vdupq_n_u64(0);
+        uint64x2_t vsum_sq = vdupq_n_u64(0);
+        uint32x4_t vsum_sq32 = vdupq_n_u32(0);
+        uint8x16_t vmin = vdupq_n_u8(0xFF);
+        uint8x16_t vmax = vdupq_n_u8(0);
+
+        size_t last_v_idx = len - (len % NEON_ALIGNMENT);
+        size_t flush_count = 0;
+        for (size_t i = 0; i < last_v_idx; i += NEON_ALIGNMENT)
+        {
+            uint8x16_t vseg = vld1q_u8(data + i);
+            vsum = vpadalq_u32(vsum, vpaddlq_u16(vpaddlq_u8(vseg)));
+
+            uint8x8_t hv_lo = vget_low_u8(vseg);
+            uint8x8_t hv_hi = vget_high_u8(vseg);
+            vsum_sq32 = vpadalq_u16(vsum_sq32, vmull_u8(hv_lo, hv_lo));
+            vsum_sq32 = vpadalq_u16(vsum_sq32, vmull_u8(hv_hi, hv_hi));
+
+            vmin = vminq_u8(vmin, vseg);
+            vmax = vmaxq_u8(vmax, vseg);
+
+            if (++flush_count == REDUCE_FLUSH_INTERVAL)
+            {
+                vsum_sq = vpadalq_u32(vsum_sq, vsum_sq32);
+                vsum_sq32 = vdupq_n_u32(0);
+                flush_count = 0;
+            }
+        }
+        vsum_sq = vpadalq_u32(vsum_sq, vsum_sq32);
+
+        uint8_t mins[NEON_ALIGNMENT];
+        uint8_t maxs[NEON_ALIGNMENT];
+        vst1q_u8(mins, vmin);
+        vst1q_u8(maxs, vmax);
+
+        uint64_t sum = vgetq_lane_u64(vsum, 0) + vgetq_lane_u64(vsum, 1);
+        uint64_t sum_sq = vgetq_lane_u64(vsum_sq, 0) + vgetq_lane_u64(vsum_sq, 1);
+        uint8_t min = *std::min_element(mins, mins + NEON_ALIGNMENT);
+        uint8_t max = *std::max_element(maxs, maxs + NEON_ALIGNMENT);
+
+        for (size_t i = last_v_idx; i < len; ++i)
+        {
+            const uint32_t v = data[i];
+            sum += v;
+            sum_sq += v * v;
+            min = std::min(min, data[i]);
+            max = std::max(max, data[i]);
+        }
+
+        out.sum[ch] = sum;
+        out.sum_sq[ch] = sum_sq;
+        out.min[ch] = min;
+        out.max[ch] = max;
+    }
+
+    void rgba_reduce_neon(const channel_info_extract_args_rgba& args, rgba_reduction& out)
+    {
+        BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
+
+        reduce_channel_neon(r, args.len, out, 0);
+        reduce_channel_neon(g, args.len, out, 1);
+        reduce_channel_neon(b, args.len, out, 2);
+        reduce_channel_neon(a, args.len, out, 3);
+    }
+
+    static inline uint8_t resample_round(int32_t accum)
+    {
+        const int32_t v = (accum + (1 << (resample_coeffs::PRECISION_BITS - 1))) >> resample_coeffs::PRECISION_BITS;
+        return static_cast<uint8_t>(std::clamp(v, 0, 255));
+    }
+
+    void resample_horizontal_neon(const resample_args& args)
+    {
+        const resample_coeffs& coeffs = *args.coeffs;
+
+        for (size_t row = args.row_begin; row < args.row_end; ++row)
+        {
+            const uint8_t* src = args.src + (row * coeffs.in_len);
+            uint8_t* dst = args.dst + (row * coeffs.out_len);
+
+            for (size_t i = 0; i < coeffs.out_len; ++i)
+            {
+                const uint8_t* px = src + coeffs.first[i];
+                const int16_t* weights = coeffs.weights.data() + (i * coeffs.weight_stride);
+
+                // Whole 8 tap chunks would read past the end of the row near the right edge
+                if (coeffs.first[i] + coeffs.weight_stride > coeffs.in_len)
+                {
+                    int32_t accum = 0;
+                    for (size_t t = 0; t < coeffs.taps; ++t)
+                    {
+                        accum += px[t] * weights[t];
+                    }
+                    dst[i] = resample_round(accum);
+                    continue;
+                }
+
+                int32x4_t vaccum = vdupq_n_s32(0);
+                for (size_t t = 0; t < coeffs.weight_stride; t += 8)
+                {
+                    int16x8_t vpx = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(px + t)));
+                    int16x8_t vweights = vld1q_s16(weights + t);
+                    vaccum = vmlal_s16(vaccum, vget_low_s16(vpx), vget_low_s16(vweights));
+                    vaccum = vmlal_s16(vaccum, vget_high_s16(vpx), vget_high_s16(vweights));
+                }
+                int32x2_t vsum = vadd_s32(vget_low_s32(vaccum), vget_high_s32(vaccum));
+                vsum = vpadd_s32(vsum, vsum);
+                dst[i] = resample_round(vget_lane_s32(vsum, 0));
+            }
+        }
+    }
+
+    void resample_vertical_neon(const resample_args& args)
+    {
+        const resample_coeffs& coeffs = *args.coeffs;
+        const size_t width = args.width;
+        if (width < NEON_ALIGNMENT)
+        {
+            return resample_vertical_std(args);
+        }
+
+        for (size_t row = args.row_begin; row < args.row_end; ++row)
+        {
+            const uint8_t* src = args.src + (coeffs.first[row] * width);
+            const int16_t* weights = coeffs.weights.data() + (row * coeffs.weight_stride);
+            uint8_t* dst = args.dst + (row * width);
 
-        return result;
+            for (size_t x = 0; x < width; x += NEON_ALIGNMENT)
+            {
+                // The last chunk overlaps the previous one instead of running a scalar tail
+                x = std::min(x, width - NEON_ALIGNMENT);
+
+                int32x4_t vaccum0 = vdupq_n_s32(0);
+                int32x4_t vaccum1 = vdupq_n_s32(0);
+                int32x4_t vaccum2 = vdupq_n_s32(0);
+                int32x4_t vaccum3 = vdupq_n_s32(0);
+
+                for (size_t t = 0; t < coeffs.taps; ++t)
+                {
+                    uint8x16_t vseg = vld1q_u8(src + (t * width) + x);
+                    int16x8_t vlo = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(vseg)));
+                    int16x8_t vhi = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(vseg)));
+                    const int16_t w = weights[t];
+
+                    vaccum0 = vmlal_n_s16(vaccum0, vget_low_s16(vlo), w);
+                    vaccum1 = vmlal_n_s16(vaccum1, vget_high_s16(vlo), w);
+                    vaccum2 = vmlal_n_s16(vaccum2, vget_low_s16(vhi), w);
+                    vaccum3 = vmlal_n_s16(vaccum3, vget_high_s16(vhi), w);
+                }
+
+                // Rounding narrowing shifts saturate exactly like the scalar clamp
+                uint16x8_t vres_lo = vcombine_u16(
+                    vqrshrun_n_s32(vaccum0, resample_coeffs::PRECISION_BITS),
+                    vqrshrun_n_s32(vaccum1, resample_coeffs::PRECISION_BITS)
+                );
+                uint16x8_t vres_hi = vcombine_u16(
+                    vqrshrun_n_s32(vaccum2, resample_coeffs::PRECISION_BITS),
+                    vqrshrun_n_s32(vaccum3, resample_coeffs::PRECISION_BITS)
+                );
+                vst1q_u8(dst + x, vcombine_u8(vqmovn_u16(vres_lo), vqmovn_u16(vres_hi)));
+            }
+        }
     }
 }
 
@@ -5,6 +5,9 @@
 
 #include <algorithm>
 #include <cinttypes>
+#include <cmath>
+#include <cstring>
+#include <vector>
 
 #define BIND_CHANNELS(args, r, g, b, a) \
     uint8_t* r = args.ch_r; \
@@ -60,27 +63,22 @@ namespace ien::image_ops::_internal
         }
     }
 
-    fixed_vector<uint8_t> rgba_average_std(const channel_info_extract_args_rgba& args)
+    void rgba_average_std(const channel_info_extract_args_rgba& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
         
-        fixed_vector<uint8_t> result(args.len);
-
         BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
 
         for(size_t i = 0; i < img_sz; ++i)
         {
-            result[i] = average<uint8_t>(r[i], g[i], b[i], a[i]);
+            out[i] = average<uint8_t>(r[i], g[i], b[i], a[i]);
         }
-        return result;
     }
 
-    fixed_vector<uint8_t> rgba_max_std(const channel_info_extract_args_rgba& args)
+    void rgba_max_std(const channel_info_extract_args_rgba& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
 
-        fixed_vector<uint8_t> result(args.len);
-
         BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
 
         for (size_t i = 0; i < img_sz; ++i)
@@ -91,92 +89,76 @@ namespace ien::image_ops::_internal
             if (max < b[i]) { max = b[i]; }
             if (max < a[i]) { max = a[i]; }
 
-            result[i] = max;
+            out[i] = max;
         }
-        return result;
     }
 
-    fixed_vector<uint8_t> rgba_min_std(const channel_info_extract_args_rgba& args)
+    void rgba_min_std(const channel_info_extract_args_rgba& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
 
-        fixed_vector<uint8_t> result(args.len);
-
         BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
 
         for (size_t i = 0; i < img_sz; ++i)
         {
-            result[i] = std::min({ r[i], g[i], b[i], a[i] });
+            out[i] = std::min({ r[i], g[i], b[i], a[i] });
         }
-        return result;
     }
 
-    fixed_vector<float> rgb_average_std(const channel_info_extract_args_rgb& args)
+    void rgb_average_std(const channel_info_extract_args_rgb& args, float* out)
     {
         const size_t img_sz = args.len;
         
-        fixed_vector<float> result(args.len);
-
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
         for(size_t i = 0; i < img_sz; ++i)
         {
             float sum = safe_add<float>(r[i], g[i], b[i]);
-            result[i] = sum / 3;
+            out[i] = sum / 3;
         }
-        return result;
     }
 
-    fixed_vector<uint8_t> rgb_max_std(const channel_info_extract_args_rgb& args)
+    void rgb_max_std(const channel_info_extract_args_rgb& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
-        fixed_vector<uint8_t> result(args.len);
 
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
         for (size_t i = 0; i < img_sz; ++i)
         {
-            result[i] = std::max({ r[i], g[i], b[i] });
+            out[i] = std::max({ r[i], g[i], b[i] });
         }
-        return result;
     }
 
-    fixed_vector<uint8_t> rgb_min_std(const channel_info_extract_args_rgb& args)
+    void rgb_min_std(const channel_info_extract_args_rgb& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
-        fixed_vector<uint8_t> result(args.len);
 
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
         for (size_t i = 0; i < img_sz; ++i)
         {
-            result[i] = std::min({ r[i], g[i], b[i] });
+            out[i] = std::min({ r[i], g[i], b[i] });
         }
-        return result;
     }
 
-    fixed_vector<uint8_t> rgba_sum_saturated_std(const channel_info_extract_args_rgba& args)
+    void rgba_sum_saturated_std(const channel_info_extract_args_rgba& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
 
-        fixed_vector<uint8_t> result(args.len);
-
         BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
 
         for (size_t i = 0; i < img_sz; ++i)
         {
             uint16_t sum = static_cast<uint16_t>(r[i]) + g[i] + b[i] + a[i];
-            result[i] = static_cast<uint8_t>(std::min(static_cast<uint16_t>(0x00FFu), sum));
+            out[i] = static_cast<uint8_t>(std::min(static_cast<uint16_t>(0x00FFu), sum));
         }
-        return result;
     }
 
-    fixed_vector<float> rgb_saturation_std(const channel_info_extract_args_rgb& args)
+    void rgb_saturation_std(const channel_info_extract_args_rgb& args, float* out)
     {
         const size_t img_sz = args.len;
 
-        fixed_vector<float> result(args.len);
-
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
         // SATURATION(r, g, b) = (MAX(r, g, b) - MIN(r, g, b)) / MAX(r, g, b)
@@ -184,36 +166,71 @@ namespace ien::image_ops::_internal
         {
             float vmax = static_cast<float>(std::max({ r[i], g[i], b[i] })) / 255.0F;
             float vmin = static_cast<float>(std::min({ r[i], g[i], b[i] })) / 255.0F;
-            result[i] = (vmax - vmin) / vmax;
+            out[i] = (vmax - vmin) / vmax;
         }
-
-        return result;
     }
 
-    fixed_vector<float> rgb_luminance_std(const channel_info_extract_args_rgb& args)
+    void rgb_luminance_std(const channel_info_extract_args_rgb& args, float* out)
     {
         const size_t img_sz = args.len;
 
-        fixed_vector<float> result(args.len);
-
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
         for (size_t i = 0; i < img_sz; ++i)
         {
-            result[i] = (r[i] * 0.2126F / 255) + (g[i] * 0.7152F / 255) + (b[i] * 0.0722F / 255);
+            out[i] = (r[i] * 0.2126F / 255) + (g[i] * 0.7152F / 255) + (b[i] * 0.0722F / 255);
         }
+    }
 
+    rgb_metrics_args rgb_metrics_args::subrange(size_t offset, size_t count) const
+    {
+        rgb_metrics_args result = *this;
+        result.len = count;
+        result.ch_r += offset;
+        result.ch_g += offset;
+        result.ch_b += offset;
+        if (luminance) { result.luminance += offset; }
+        if (saturation) { result.saturation += offset; }
+        if (average) { result.average += offset; }
+        if (max) { result.max += offset; }
+        if (min) { result.min += offset; }
         return result;
     }
 
-	image_planar_data unpack_image_data_std(const uint8_t* data, size_t len)
-	{
-		image_planar_data result(len / 4);
+    void rgb_metrics_std(const rgb_metrics_args& args)
+    {
+        const size_t img_sz = args.len;
 
-		uint8_t* r = result.data_r();
-		uint8_t* g = result.data_g();
-		uint8_t* b = result.data_b();
-		uint8_t* a = result.data_a();
+        BIND_CHANNELS_RGB_CONST(args, r, g, b);
+
+        for (size_t i = 0; i < img_sz; ++i)
+        {
+            uint8_t vmax = std::max({ r[i], g[i], b[i] });
+            uint8_t vmin = std::min({ r[i], g[i], b[i] });
+
+            if (args.luminance)
+            {
+                args.luminance[i] = (r[i] * 0.2126F / 255) + (g[i] * 0.7152F / 255) + (b[i] * 0.0722F / 255);
+            }
+            if (args.saturation)
+            {
+                args.saturation[i] = static_cast<float>(vmax - vmin) / vmax;
+            }
+            if (args.average)
+            {
+                args.average[i] = ien::safe_add<float>(r[i], g[i], b[i]) / 3;
+            }
+            if (args.max) { args.max[i] = vmax; }
+            if (args.min) { args.min[i] = vmin; }
+        }
+    }
+
+	void unpack_image_data_std(const uint8_t* data, size_t len, image_planar_data& out)
+	{
+		uint8_t* r = out.data_r();
+		uint8_t* g = out.data_g();
+		uint8_t* b = out.data_b();
+		uint8_t* a = out.data_a();
 
 		for (size_t i = 0; i < len; i += 4)
 		{
@@ -222,16 +239,351 @@ namespace ien::image_ops::_internal
 			b[i / 4] = data[i + 2];
 			a[i / 4] = data[i + 3];
 		}
-		return result;
 	}
 
-    fixed_vector<uint8_t> channel_compare_std(const channel_compare_args& args)
+	void pack_image_data_std(const channel_info_extract_args_rgba& args, uint8_t* out)
+	{
+		for (size_t i = 0; i < args.len; ++i)
+		{
+			out[(i * 4) + 0] = args.ch_r[i];
+			out[(i * 4) + 1] = args.ch_g[i];
+			out[(i * 4) + 2] = args.ch_b[i];
+			out[(i * 4) + 3] = args.ch_a[i];
+		}
+	}
+
+    void channel_compare_std(const channel_compare_args& args, uint8_t* out)
     {
-        fixed_vector<uint8_t> result(args.len, LIEN_DEFAULT_ALIGNMENT);
         for(size_t i = 0; i < args.len; ++i)
         {
-            result[i] = args.ch[i] >= args.threshold;
+            out[i] = args.ch[i] >= args.threshold;
+        }
+    }
+
+    // Sub-histograms are 32-bit, each block keeps them far from overflowing
+    const size_t HISTOGRAM_BLOCK_SIZE = size_t(1) << 30;
+
+    void rgba_histogram_std(const channel_info_extract_args_rgba& args, uint64_t* bins)
+    {
+        BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
+        const uint8_t* channels[4] = { r, g, b, a };
+
+        // Four sub-histograms, so runs of equal values don't serialize on the increment of a single counter
+        uint32_t sub[4][256];
+
+        for (size_t ch = 0; ch < 4; ++ch)
+        {
+            const uint8_t* data = channels[ch];
+            uint64_t* ch_bins = bins + (ch * 256);
+
+            for (size_t block = 0; block < args.len; block += HISTOGRAM_BLOCK_SIZE)
+            {
+                const size_t block_end = std::min(args.len, block + HISTOGRAM_BLOCK_SIZE);
+                std::memset(sub, 0, sizeof(sub));
+
+                size_t i = block;
+                for (; i + 8 <= block_end; i += 8)
+                {
+                    uint64_t word;
+                    std::memcpy(&word, data + i, sizeof(word));
+                    ++sub[0][word & 0xFF];
+                    ++sub[1][(word >> 8) & 0xFF];
+                    ++sub[2][(word >> 16) & 0xFF];
+                    ++sub[3][(word >> 24) & 0xFF];
+                    ++sub[0][(word >> 32) & 0xFF];
+                    ++sub[1][(word >> 40) & 0xFF];
+                    ++sub[2][(word >> 48) & 0xFF];
+                    ++sub[3][(word >> 56) & 0xFF];
+                }
+                for (; i < block_end; ++i)
+                {
+                    ++sub[0][data[i]];
+                }
+
+                for (size_t bin = 0; bin < 256; ++bin)
+                {
+                    ch_bins[bin] += static_cast<uint64_t>(sub[0][bin]) + sub[1][bin] + sub[2][bin] + sub[3][bin];
+                }
+            }
+        }
+    }
+
+    void rgba_reduce_std(const channel_info_extract_args_rgba& args, rgba_reduction& out)
+    {
+        BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
+        const uint8_t* channels[4] = { r, g, b, a };
+
+        out = rgba_reduction();
+        for (size_t ch = 0; ch < 4; ++ch)
+        {
+            const uint8_t* data = channels[ch];
+            uint64_t sum = 0;
+            uint64_t sum_sq = 0;
+            uint8_t min = 0xFF;
+            uint8_t max = 0;
+
+            for (size_t i = 0; i < args.len; ++i)
+            {
+                const uint32_t v = data[i];
+                sum += v;
+                sum_sq += v * v;
+                min = std::min(min, data[i]);
+                max = std::max(max, data[i]);
+            }
+
+            out.sum[ch] = sum;
+            out.sum_sq[ch] = sum_sq;
+            out.min[ch] = min;
+            out.max[ch] = max;
+        }
+    }
+
+    static double resize_filter_support(resize_filter filter)
+    {
+        switch (filter)
+        {
+            case resize_filter::BOX: return 0.5;
+            case resize_filter::BILINEAR: return 1.0;
+            case resize_filter::BICUBIC: return 2.0;
+            case resize_filter::LANCZOS3: return 3.0;
+        }
+        return 1.0;
+    }
+
+    static double resize_filter_weight(resize_filter filter, double x)
+    {
+        const double PI = 3.14159265358979323846;
+        const double ax = std::abs(x);
+
+        switch (filter)
+        {
+            case resize_filter::BOX:
+                return (x > -0.5 && x <= 0.5) ? 1.0 : 0.0;
+
+            case resize_filter::BILINEAR:
+                return std::max(0.0, 1.0 - ax);
+
+            case resize_filter::BICUBIC:
+            {
+                const double a = -0.5;
+                if (ax < 1.0) { return ((a + 2.0) * ax * ax * ax) - ((a + 3.0) * ax * ax) + 1.0; }
+                if (ax < 2.0) { return (a * ax * ax * ax) - (5.0 * a * ax * ax) + (8.0 * a * ax) - (4.0 * a); }
+                return 0.0;
+            }
+
+            case resize_filter::LANCZOS3:
+            {
+                if (ax < 1e-8) { return 1.0; }
+                if (ax >= 3.0) { return 0.0; }
+                const double px = PI * x;
+                return (3.0 * std::sin(px) * std::sin(px / 3.0)) / (px * px);
+            }
+        }
+        return 0.0;
+    }
+
+    const size_t* resample_coeffs::first_data() const { return first.data(); }
+
+    const int16_t* resample_coeffs::weights_data() const { return weights.data(); }
+
+    resample_coeffs build_resample_coeffs(size_t in_len, size_t out_len, resize_filter filter)
+    {
+        const double scale = static_cast<double>(in_len) / static_cast<double>(out_len);
+        const double filter_scale = std::max(1.0, scale); // Downscaling widens the filter
+        const double support = resize_filter_support(filter) * filter_scale;
+
+        resample_coeffs result;
+        result.in_len = in_len;
+        result.out_len = out_len;
+        result.taps = std::min(in_len, static_cast<size_t>(std::ceil(support)) * 2 + 1);
+        result.weight_stride = (result.taps + 7) & ~size_t(7);
+        result.first.resize(out_len);
+        result.weights.assign(out_len * result.weight_stride, 0);
+
+        std::vector<double> raw(result.taps);
+        for (size_t i = 0; i < out_len; ++i)
+        {
+            const double center = (static_cast<double>(i) + 0.5) * scale;
+            const size_t xmin = static_cast<size_t>(std::max(0.0, std::floor(center - support + 0.5)));
+            const size_t xmax = std::min(in_len, static_cast<size_t>(std::max(0.0, std::floor(center + support + 0.5))));
+
+            // Windows are shifted back from the right edge so that all of them are 'taps' wide
+            const size_t first = std::min(xmin, in_len - result.taps);
+            result.first[i] = first;
+
+            double total = 0.0;
+            std::fill(raw.begin(), raw.end(), 0.0);
+            for (size_t x = xmin; x < xmax && (x - first) < result.taps; ++x)
+            {
+                const double w = resize_filter_weight(filter, (static_cast<double>(x) + 0.5 - center) / filter_scale);
+                raw[x - first] = w;
+                total += w;
+            }
+
+            if (total == 0.0)
+            {
+                // Degenerate window, take the nearest source pixel
+                const size_t nearest = std::clamp(static_cast<size_t>(center), first, first + result.taps - 1);
+                raw[nearest - first] = 1.0;
+                total = 1.0;
+            }
+
+            // Quantize, then put the rounding error on the largest weight so every row sums exactly to one
+            int16_t* weights = result.weights.data() + (i * result.weight_stride);
+            int sum = 0;
+            size_t largest = 0;
+            for (size_t t = 0; t < result.taps; ++t)
+            {
+                weights[t] = static_cast<int16_t>(std::lround((raw[t] / total) * (1 << resample_coeffs::PRECISION_BITS)));
+                sum += weights[t];
+                largest = (std::abs(weights[t]) > std::abs(weights[largest])) ? t : largest;
+            }
+            weights[largest] = static_cast<int16_t>(weights[largest] + ((1 << resample_coeffs::PRECISION_BITS) - sum));
         }
         return result;
     }
+
+    static inline uint8_t resample_round(int32_t accum)
+    {
+        const int32_t v = (accum + (1 << (resample_coeffs::PRECISION_BITS - 1))) >> resample_coeffs::PRECISION_BITS;
+        return static_cast<uint8_t>(std::clamp(v, 0, 255));
+    }
+
+    void resample_horizontal_std(const resample_args& args)
+    {
+        const resample_coeffs& coeffs = *args.coeffs;
+
+        for (size_t row = args.row_begin; row < args.row_end; ++row)
+        {
+            const uint8_t* src = args.src + (row * coeffs.in_len);
+            uint8_t* dst = args.dst + (row * coeffs.out_len);
+
+            for (size_t i = 0; i < coeffs.out_len; ++i)
+            {
+                const uint8_t* px = src + coeffs.first[i];
+                const int16_t* weights = coeffs.weights.data() + (i * coeffs.weight_stride);
+
+                int32_t accum = 0;
+                for (size_t t = 0; t < coeffs.taps; ++t)
+                {
+                    accum += px[t] * weights[t];
+                }
+                dst[i] = resample_round(accum);
+            }
+        }
+    }
+
+    void resample_vertical_std(const resample_args& args)
+    {
+        const resample_coeffs& coeffs = *args.coeffs;
+        const size_t width = args.width;
+
+        // Accumulating whole rows keeps the source reads sequential
+        std::vector<int32_t> accum(width);
+
+        for (size_t row = args.row_begin; row < args.row_end; ++row)
+        {
+            const uint8_t* src = args.src + (coeffs.first[row] * width);
+            const int16_t* weights = coeffs.weights.data() + (row * coeffs.weight_stride);
+            uint8_t* dst = args.dst + (row * width);
+
+            std::fill(accum.begin(), accum.end(), 0);
+            for (size_t t = 0; t < coeffs.taps; ++t)
+            {
+                const uint8_t* src_row = src + (t * width);
+                const int32_t w = weights[t];
+                for (size_t x = 0; x < width; ++x)
+                {
+                    accum[x] += src_row[x] * w;
+                }
+            }
+
+            for (size_t x = 0; x < width; ++x)
+            {
+                dst[x] = resample_round(accum[x]);
+            }
+        }
+    }
+
+    void lsb_embed_std(const lsb_embed_args& args)
+    {
+        BIND_CHANNELS(args, r, g, b, a);
+
+        // Locals, the byte stores below would otherwise force 'args' to be reloaded for every pixel
+        const uint8_t* payload = args.payload;
+        const size_t payload_len = args.payload_len;
+        const int pixel_bits = args.pixel_bits();
+        const int shift_g = args.bits_r;
+        const int shift_b = shift_g + args.bits_g;
+        const int shift_a = shift_b + args.bits_b;
+        const uint32_t mask_r = (1u << args.bits_r) - 1;
+        const uint32_t mask_g = (1u << args.bits_g) - 1;
+        const uint32_t mask_b = (1u << args.bits_b) - 1;
+        const uint32_t mask_a = (1u << args.bits_a) - 1;
+
+        uint64_t acc = 0;
+        int acc_bits = 0;
+        size_t next_byte = 0;
+        for (size_t i = 0; i < args.len; ++i)
+        {
+            while (acc_bits < pixel_bits)
+            {
+                const uint64_t byte = (next_byte < payload_len) ? payload[next_byte] : 0;
+                acc |= byte << acc_bits;
+                acc_bits += 8;
+                ++next_byte;
+            }
+
+            const uint32_t bits = static_cast<uint32_t>(acc);
+            acc >>= pixel_bits;
+            acc_bits -= pixel_bits;
+
+            r[i] = static_cast<uint8_t>((r[i] & ~mask_r) | (bits & mask_r));
+            g[i] = static_cast<uint8_t>((g[i] & ~mask_g) | ((bits >> shift_g) & mask_g));
+            b[i] = static_cast<uint8_t>((b[i] & ~mask_b) | ((bits >> shift_b) & mask_b));
+            a[i] = static_cast<uint8_t>((a[i] & ~mask_a) | ((bits >> shift_a) & mask_a));
+        }
+    }
+
+    void lsb_extract_std(const lsb_extract_args& args)
+    {
+        BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
+
+        uint8_t* payload = args.payload;
+        const size_t payload_len = args.payload_len;
+        const int pixel_bits = args.pixel_bits();
+        const uint32_t mask_r = (1u << args.bits_r) - 1;
+        const uint32_t mask_g = (1u << args.bits_g) - 1;
+        const uint32_t mask_b = (1u << args.bits_b) - 1;
+        const uint32_t mask_a = (1u << args.bits_a) - 1;
+        const int shift_g = args.bits_r;
+        const int shift_b = shift_g + args.bits_g;
+        const int shift_a = shift_b + args.bits_b;
+
+        uint64_t acc = 0;
+        int acc_bits = 0;
+        size_t next_byte = 0;
+        for (size_t i = 0; (i < args.len) && (next_byte < payload_len); ++i)
+        {
+            const uint32_t bits = (r[i] & mask_r)
+                | ((g[i] & mask_g) << shift_g)
+                | ((b[i] & mask_b) << shift_b)
+                | ((a[i] & mask_a) << shift_a);
+
+            acc |= static_cast<uint64_t>(bits) << acc_bits;
+            acc_bits += pixel_bits;
+            while (acc_bits >= 8 && next_byte < payload_len)
+            {
+                payload[next_byte++] = static_cast<uint8_t>(acc);
+                acc >>= 8;
+                acc_bits -= 8;
+            }
+        }
+
+        // Trailing partial byte, the missing high bits are zero
+        if (acc_bits > 0 && next_byte < payload_len)
+        {
+            payload[next_byte] = static_cast<uint8_t>(acc);
+        }
+    }
 }
\ No newline at end of file
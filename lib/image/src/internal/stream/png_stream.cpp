@@ -0,0 +1,577 @@
+#include <ien/internal/image_stream_formats.hpp>
+
+#if defined(LIEN_IMAGE_ZLIB)
+
+#include <ien/arithmetic.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+namespace ien::_internal
+{
+    constexpr uint8_t PNG_SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+    constexpr uint8_t PNG_COLOR_GRAY = 0;
+    constexpr uint8_t PNG_COLOR_RGB = 2;
+    constexpr uint8_t PNG_COLOR_PALETTE = 3;
+    constexpr uint8_t PNG_COLOR_GRAY_ALPHA = 4;
+    constexpr uint8_t PNG_COLOR_RGBA = 6;
+
+    constexpr uint8_t PNG_FILTER_NONE = 0;
+    constexpr uint8_t PNG_FILTER_SUB = 1;
+    constexpr uint8_t PNG_FILTER_UP = 2;
+    constexpr uint8_t PNG_FILTER_AVERAGE = 3;
+    constexpr uint8_t PNG_FILTER_PAETH = 4;
+
+    // Compressed input read and IDAT data written per call
+    constexpr size_t PNG_IO_BUFFER_SIZE = 64 * 1024;
+
+    // Same limit as stb_image, checked before anything is allocated
+    constexpr size_t PNG_MAX_DIMENSION = 1 << 24;
+
+    inline uint32_t read_be32(const uint8_t* p)
+    {
+        return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16)
+            | (static_cast<uint32_t>(p[2]) << 8) | p[3];
+    }
+
+    inline void write_be32(uint8_t* p, uint32_t v)
+    {
+        p[0] = static_cast<uint8_t>(v >> 24);
+        p[1] = static_cast<uint8_t>(v >> 16);
+        p[2] = static_cast<uint8_t>(v >> 8);
+        p[3] = static_cast<uint8_t>(v);
+    }
+
+    inline uint8_t paeth_predictor(int a, int b, int c)
+    {
+        const int p = a + b - c;
+        const int pa = std::abs(p - a);
+        const int pb = std::abs(p - b);
+        const int pc = std::abs(p - c);
+        if(pa <= pb && pa <= pc) { return static_cast<uint8_t>(a); }
+        if(pb <= pc) { return static_cast<uint8_t>(b); }
+        return static_cast<uint8_t>(c);
+    }
+
+    png_stream_reader::png_stream_reader(const std::string& path)
+        : _file(path, "rb")
+    {
+        uint8_t signature[8];
+        _file.read(signature, sizeof(signature));
+        if(std::memcmp(signature, PNG_SIGNATURE, sizeof(signature)) != 0)
+        {
+            _file.fail("Not a PNG file");
+        }
+
+        for(size_t i = 0; i < 256; ++i)
+        {
+            _palette[(i * 4) + 3] = 255;
+        }
+
+        // Header chunks up to the first IDAT
+        size_t w = 0, h = 0;
+        for(;;)
+        {
+            uint32_t len;
+            char type[4];
+            read_chunk_header(len, type);
+
+            if(std::memcmp(type, "IHDR", 4) == 0)
+            {
+                uint8_t ihdr[13];
+                if(len != sizeof(ihdr)) { _file.fail("Invalid PNG header"); }
+                read_chunk_data(ihdr, sizeof(ihdr));
+
+                w = read_be32(ihdr);
+                h = read_be32(ihdr + 4);
+                _bit_depth = ihdr[8];
+                _color_type = ihdr[9];
+                if(ihdr[10] != 0 || ihdr[11] != 0)
+                {
+                    _file.fail("Invalid PNG compression or filter method");
+                }
+                if(ihdr[12] != 0)
+                {
+                    _file.unsupported("Interlaced PNGs can't be decoded row by row");
+                }
+            }
+            else if(std::memcmp(type, "PLTE", 4) == 0)
+            {
+                if(len % 3 != 0 || len > 768) { _file.fail("Invalid PNG palette"); }
+                uint8_t plte[768];
+                read_chunk_data(plte, len);
+                for(size_t i = 0; i < len / 3; ++i)
+                {
+                    std::memcpy(&_palette[i * 4], plte + (i * 3), 3);
+                }
+            }
+            else if(std::memcmp(type, "tRNS", 4) == 0)
+            {
+                uint8_t trns[256];
+                if(len > sizeof(trns)) { _file.fail("Invalid PNG transparency"); }
+                read_chunk_data(trns, len);
+
+                if(_color_type == PNG_COLOR_PALETTE)
+                {
+                    for(size_t i = 0; i < len; ++i)
+                    {
+                        _palette[(i * 4) + 3] = trns[i];
+                    }
+                }
+                else if(_color_type == PNG_COLOR_GRAY || _color_type == PNG_COLOR_RGB)
+                {
+                    const size_t key_len = _color_type == PNG_COLOR_GRAY ? 1 : 3;
+                    if(len != key_len * 2) { _file.fail("Invalid PNG transparency"); }
+                    for(size_t i = 0; i < key_len; ++i)
+                    {
+                        _color_key[i] = static_cast<uint16_t>((trns[i * 2] << 8) | trns[(i * 2) + 1]);
+                    }
+                    _has_color_key = true;
+                }
+            }
+            else if(std::memcmp(type, "IDAT", 4) == 0)
+            {
+                _idat_remaining = len;
+                break;
+            }
+            else if(std::memcmp(type, "IEND", 4) == 0)
+            {
+                _file.fail("PNG has no image data");
+            }
+            else
+            {
+                skip_chunk_data(len);
+            }
+            check_chunk_crc();
+        }
+
+        if(w == 0 || h == 0 || w > PNG_MAX_DIMENSION || h > PNG_MAX_DIMENSION)
+        {
+            _file.fail("Invalid PNG dimensions");
+        }
+
+        switch(_color_type)
+        {
+        case PNG_COLOR_GRAY: _channels = 1; break;
+        case PNG_COLOR_RGB: _channels = 3; break;
+        case PNG_COLOR_PALETTE: _channels = 1; break;
+        case PNG_COLOR_GRAY_ALPHA: _channels = 2; break;
+        case PNG_COLOR_RGBA: _channels = 4; break;
+        default: _file.fail("Invalid PNG color type");
+        }
+
+        const bool valid_depth = _color_type == PNG_COLOR_GRAY
+            ? (_bit_depth == 1 || _bit_depth == 2 || _bit_depth == 4 || _bit_depth == 8 || _bit_depth == 16)
+            : _color_type == PNG_COLOR_PALETTE
+                ? (_bit_depth == 1 || _bit_depth == 2 || _bit_depth == 4 || _bit_depth == 8)
+                : (_bit_depth == 8 || _bit_depth == 16);
+        if(!valid_depth)
+        {
+            _file.fail("Invalid PNG bit depth");
+        }
+
+        init(w, h);
+
+        const size_t pixel_bits = _channels * _bit_depth;
+        _row_bytes = (safe_mul<size_t>(w, pixel_bits) + 7) / 8;
+        _filter_bpp = std::max<size_t>(1, pixel_bits / 8);
+        if(_row_bytes >= UINT_MAX)
+        {
+            _file.fail("PNG rows are too large");
+        }
+
+        _in = fixed_vector<uint8_t>(PNG_IO_BUFFER_SIZE);
+        _cur = fixed_vector<uint8_t>(_row_bytes + 1);
+        _prev = fixed_vector<uint8_t>(_row_bytes + 1);
+        std::memset(_prev.data(), 0, _prev.size());
+
+        if(inflateInit(&_zs) != Z_OK)
+        {
+            _file.fail("Unable to initialize zlib");
+        }
+        _zs_ready = true;
+    }
+
+    png_stream_reader::~png_stream_reader()
+    {
+        if(_zs_ready)
+        {
+            inflateEnd(&_zs);
+        }
+    }
+
+    void png_stream_reader::read_chunk_header(uint32_t& len, char* type)
+    {
+        uint8_t header[8];
+        _file.read(header, sizeof(header));
+        len = read_be32(header);
+        std::memcpy(type, header + 4, 4);
+        _chunk_crc = crc32(0L, header + 4, 4);
+    }
+
+    void png_stream_reader::read_chunk_data(uint8_t* dst, size_t len)
+    {
+        _file.read(dst, len);
+        _chunk_crc = crc32(_chunk_crc, dst, static_cast<uInt>(len));
+    }
+
+    // Skipped data is still read, the CRC covers it
+    void png_stream_reader::skip_chunk_data(size_t len)
+    {
+        uint8_t buffer[4096];
+        while(len > 0)
+        {
+            const size_t n = std::min(len, sizeof(buffer));
+            read_chunk_data(buffer, n);
+            len -= n;
+        }
+    }
+
+    void png_stream_reader::check_chunk_crc()
+    {
+        uint8_t crc[4];
+        _file.read(crc, sizeof(crc));
+        if(read_be32(crc) != static_cast<uint32_t>(_chunk_crc))
+        {
+            _file.fail("PNG chunk CRC mismatch");
+        }
+    }
+
+    void png_stream_reader::refill_input()
+    {
+        // Image data may be split across any number of consecutive IDAT chunks
+        while(_idat_remaining == 0 && !_idat_done)
+        {
+            check_chunk_crc();
+
+            uint32_t len;
+            char type[4];
+            read_chunk_header(len, type);
+            if(std::memcmp(type, "IDAT", 4) != 0)
+            {
+                _idat_done = true;
+                return;
+            }
+            _idat_remaining = len;
+        }
+
+        const size_t len = std::min<size_t>(_idat_remaining, _in.size());
+        read_chunk_data(_in.data(), len);
+        _idat_remaining -= static_cast<uint32_t>(len);
+
+        _zs.next_in = _in.data();
+        _zs.avail_in = static_cast<uInt>(len);
+    }
+
+    void png_stream_reader::decode_row(uint8_t* rgba)
+    {
+        _zs.next_out = _cur.data();
+        _zs.avail_out = static_cast<uInt>(_cur.size());
+
+        while(_zs.avail_out > 0)
+        {
+            if(_zs.avail_in == 0)
+            {
+                refill_input();
+                if(_zs.avail_in == 0 && _idat_done)
+                {
+                    _file.fail("Truncated PNG image data");
+                }
+            }
+
+            const int ret = inflate(&_zs, Z_NO_FLUSH);
+            if(ret == Z_STREAM_END && _zs.avail_out > 0)
+            {
+                _file.fail("Truncated PNG image data");
+            }
+            if(ret != Z_OK && ret != Z_STREAM_END && ret != Z_BUF_ERROR)
+            {
+                _file.fail("Corrupt PNG image data");
+            }
+        }
+
+        unfilter_row();
+        expand_row(rgba);
+        std::memcpy(_prev.data(), _cur.cdata(), _cur.size());
+
+        // The IDAT chunk holding the end of the image is read through, so its CRC is checked too
+        if(_next_row + 1 == _height && !_idat_done)
+        {
+            skip_chunk_data(_idat_remaining);
+            _idat_remaining = 0;
+            check_chunk_crc();
+            _idat_done = true;
+        }
+    }
+
+    void png_stream_reader::unfilter_row()
+    {
+        uint8_t* x = _cur.data() + 1;
+        const uint8_t* p = _prev.cdata() + 1;
+        const size_t bpp = _filter_bpp;
+        const size_t len = _row_bytes;
+
+        switch(_cur[0])
+        {
+        case PNG_FILTER_NONE:
+            break;
+        case PNG_FILTER_SUB:
+            for(size_t i = bpp; i < len; ++i) { x[i] = static_cast<uint8_t>(x[i] + x[i - bpp]); }
+            break;
+        case PNG_FILTER_UP:
+            for(size_t i = 0; i < len; ++i) { x[i] = static_cast<uint8_t>(x[i] + p[i]); }
+            break;
+        case PNG_FILTER_AVERAGE:
+            for(size_t i = 0; i < bpp; ++i) { x[i] = static_cast<uint8_t>(x[i] + (p[i] >> 1)); }
+            for(size_t i = bpp; i < len; ++i) { x[i] = static_cast<uint8_t>(x[i] + ((x[i - bpp] + p[i]) >> 1)); }
+            break;
+        case PNG_FILTER_PAETH:
+            for(size_t i = 0; i < bpp; ++i) { x[i] = static_cast<uint8_t>(x[i] + p[i]); }
+            for(size_t i = bpp; i < len; ++i)
+            {
+                x[i] = static_cast<uint8_t>(x[i] + paeth_predictor(x[i - bpp], p[i], p[i - bpp]));
+            }
+            break;
+        default:
+            _file.fail("Invalid PNG filter type");
+        }
+    }
+
+    void png_stream_reader::expand_row(uint8_t* rgba) const
+    {
+        const uint8_t* src = _cur.cdata() + 1;
+
+        if(_bit_depth == 8 && _color_type == PNG_COLOR_RGBA)
+        {
+            std::memcpy(rgba, src, _width * 4);
+            return;
+        }
+
+        const unsigned int depth = _bit_depth;
+        const unsigned int max_value = (1u << depth) - 1;
+        auto sample = [src, depth, max_value](size_t s) -> unsigned int
+        {
+            if(depth == 8) { return src[s]; }
+            if(depth == 16) { return (static_cast<unsigned int>(src[s * 2]) << 8) | src[(s * 2) + 1]; }
+            const size_t bit = s * depth;
+            return (src[bit / 8] >> (8 - depth - (bit % 8))) & max_value;
+        };
+        auto to_u8 = [depth, max_value](unsigned int v) -> uint8_t
+        {
+            if(depth == 16) { return static_cast<uint8_t>(v >> 8); }
+            return static_cast<uint8_t>(depth == 8 ? v : (v * 255) / max_value);
+        };
+
+        for(size_t i = 0; i < _width; ++i)
+        {
+            uint8_t* dst = rgba + (i * 4);
+            const size_t s = i * _channels;
+
+            switch(_color_type)
+            {
+            case PNG_COLOR_GRAY:
+            {
+                const unsigned int v = sample(s);
+                dst[0] = dst[1] = dst[2] = to_u8(v);
+                dst[3] = (_has_color_key && v == _color_key[0]) ? 0 : 255;
+                break;
+            }
+            case PNG_COLOR_RGB:
+            {
+                const unsigned int r = sample(s), g = sample(s + 1), b = sample(s + 2);
+                dst[0] = to_u8(r);
+                dst[1] = to_u8(g);
+                dst[2] = to_u8(b);
+                dst[3] = (_has_color_key && r == _color_key[0] && g == _color_key[1] && b == _color_key[2]) ? 0 : 255;
+                break;
+            }
+            case PNG_COLOR_PALETTE:
+                std::memcpy(dst, &_palette[sample(s) * 4], 4);
+                break;
+            case PNG_COLOR_GRAY_ALPHA:
+                dst[0] = dst[1] = dst[2] = to_u8(sample(s));
+                dst[3] = to_u8(sample(s + 1));
+                break;
+            default:
+                dst[0] = to_u8(sample(s));
+                dst[1] = to_u8(sample(s + 1));
+                dst[2] = to_u8(sample(s + 2));
+                dst[3] = to_u8(sample(s + 3));
+                break;
+            }
+        }
+    }
+
+    png_stream_writer::png_stream_writer(encode_sink& sink, size_t width, size_t height, int compression_level)
+        : _adaptive_filter(compression_level != 0)
+    {
+        if(width > 0x7FFFFFFF || height > 0x7FFFFFFF)
+        {
+            throw std::invalid_argument("PNG dimensions are limited to 2^31 - 1 pixels");
+        }
+        init(sink, width, height);
+
+        const size_t row_bytes = safe_mul<size_t>(width, 4);
+        if(row_bytes >= UINT_MAX)
+        {
+            throw std::invalid_argument("PNG rows are too large");
+        }
+        _prev = fixed_vector<uint8_t>(row_bytes);
+        _filtered = fixed_vector<uint8_t>(row_bytes + 1);
+        _best = fixed_vector<uint8_t>(row_bytes + 1);
+        _out = fixed_vector<uint8_t>(PNG_IO_BUFFER_SIZE);
+        std::memset(_prev.data(), 0, _prev.size());
+
+        if(deflateInit(&_zs, std::clamp(compression_level, 0, 9)) != Z_OK)
+        {
+            throw std::runtime_error("Unable to initialize zlib");
+        }
+        _zs_ready = true;
+        _zs.next_out = _out.data();
+        _zs.avail_out = static_cast<uInt>(_out.size());
+
+        _sink->write(PNG_SIGNATURE, sizeof(PNG_SIGNATURE));
+
+        // 8-bit RGBA, deflate, adaptive filtering, not interlaced
+        uint8_t ihdr[13] = {};
+        write_be32(ihdr, static_cast<uint32_t>(width));
+        write_be32(ihdr + 4, static_cast<uint32_t>(height));
+        ihdr[8] = 8;
+        ihdr[9] = PNG_COLOR_RGBA;
+        write_chunk("IHDR", ihdr, sizeof(ihdr));
+    }
+
+    png_stream_writer::~png_stream_writer()
+    {
+        if(_zs_ready)
+        {
+            deflateEnd(&_zs);
+        }
+    }
+
+    void png_stream_writer::encode_row(const uint8_t* rgba)
+    {
+        const size_t len = _width * 4;
+        const size_t bpp = 4;
+        const uint8_t* p = _prev.cdata();
+
+        if(!_adaptive_filter)
+        {
+            _best[0] = PNG_FILTER_NONE;
+            std::memcpy(_best.data() + 1, rgba, len);
+        }
+        else
+        {
+            // Same heuristic as libpng and stb: keep the filter with the smallest sum of
+            // absolute signed residuals
+            uint64_t best_score = UINT64_MAX;
+            for(uint8_t filter = PNG_FILTER_NONE; filter <= PNG_FILTER_PAETH; ++filter)
+            {
+                uint8_t* out = _filtered.data() + 1;
+                _filtered[0] = filter;
+
+                for(size_t i = 0; i < len; ++i)
+                {
+                    const int a = i >= bpp ? rgba[i - bpp] : 0;
+                    const int b = p[i];
+                    const int c = i >= bpp ? p[i - bpp] : 0;
+                    int pred = 0;
+                    switch(filter)
+                    {
+                    case PNG_FILTER_SUB: pred = a; break;
+                    case PNG_FILTER_UP: pred = b; break;
+                    case PNG_FILTER_AVERAGE: pred = (a + b) >> 1; break;
+                    case PNG_FILTER_PAETH: pred = paeth_predictor(a, b, c); break;
+                    default: break;
+                    }
+                    out[i] = static_cast<uint8_t>(rgba[i] - pred);
+                }
+
+                uint64_t score = 0;
+                for(size_t i = 0; i < len; ++i)
+                {
+                    score += static_cast<uint64_t>(std::abs(static_cast<int8_t>(out[i])));
+                }
+                if(score < best_score)
+                {
+                    best_score = score;
+                    std::memcpy(_best.data(), _filtered.cdata(), len + 1);
+                }
+            }
+        }
+
+        deflate_input(_best.cdata(), len + 1, Z_NO_FLUSH);
+        std::memcpy(_prev.data(), rgba, len);
+    }
+
+    void png_stream_writer::encode_end()
+    {
+        deflate_input(nullptr, 0, Z_FINISH);
+
+        const size_t pending = _out.size() - _zs.avail_out;
+        if(pending > 0)
+        {
+            write_chunk("IDAT", _out.cdata(), pending);
+        }
+        write_chunk("IEND", nullptr, 0);
+        _sink->flush();
+    }
+
+    void png_stream_writer::deflate_input(const uint8_t* data, size_t len, int flush)
+    {
+        _zs.next_in = const_cast<Bytef*>(data);
+        _zs.avail_in = static_cast<uInt>(len);
+
+        for(;;)
+        {
+            const int ret = deflate(&_zs, flush);
+            if(ret == Z_STREAM_ERROR)
+            {
+                throw std::runtime_error("zlib deflate failed");
+            }
+
+            // Every full output buffer becomes one IDAT chunk
+            if(_zs.avail_out == 0)
+            {
+                write_chunk("IDAT", _out.cdata(), _out.size());
+                _zs.next_out = _out.data();
+                _zs.avail_out = static_cast<uInt>(_out.size());
+                continue;
+            }
+
+            if(flush == Z_FINISH ? ret == Z_STREAM_END : _zs.avail_in == 0)
+            {
+                break;
+            }
+        }
+    }
+
+    void png_stream_writer::write_chunk(const char* type, const uint8_t* data, size_t len)
+    {
+        uint8_t header[8];
+        write_be32(header, static_cast<uint32_t>(len));
+        std::memcpy(header + 4, type, 4);
+
+        uLong crc = crc32(0L, header + 4, 4);
+        if(len > 0)
+        {
+            crc = crc32(crc, data, static_cast<uInt>(len));
+        }
+
+        uint8_t footer[4];
+        write_be32(footer, static_cast<uint32_t>(crc));
+
+        _sink->write(header, sizeof(header));
+        if(len > 0)
+        {
+            _sink->write(data, len);
+        }
+        _sink->write(footer, sizeof(footer));
+    }
+}
+
+#endif
\ No newline at end of file
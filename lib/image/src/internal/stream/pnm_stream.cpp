@@ -0,0 +1,167 @@
+#include <ien/internal/image_stream_formats.hpp>
+
+#include <ien/arithmetic.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <string>
+
+namespace ien::_internal
+{
+    pnm_stream_reader::pnm_stream_reader(const std::string& path)
+        : _file(path, "rb")
+    {
+        uint8_t magic[2];
+        _file.read(magic, 2);
+
+        size_t w = 0, h = 0;
+        if(magic[0] == 'P' && magic[1] == '6')
+        {
+            w = read_header_value();
+            h = read_header_value();
+            _maxval = static_cast<unsigned int>(read_header_value());
+            _channels = 3;
+        }
+        else if(magic[0] == 'P' && magic[1] == '7')
+        {
+            for(std::string token = read_token(); token != "ENDHDR"; token = read_token())
+            {
+                if(token == "WIDTH") { w = read_header_value(); }
+                else if(token == "HEIGHT") { h = read_header_value(); }
+                else if(token == "DEPTH") { _channels = read_header_value(); }
+                else if(token == "MAXVAL") { _maxval = static_cast<unsigned int>(read_header_value()); }
+                else if(token == "TUPLTYPE") { read_token(); }
+                else { _file.fail("Invalid PAM header field '" + token + "'"); }
+            }
+        }
+        else
+        {
+            _file.fail("Not a binary PPM or PAM file");
+        }
+
+        if(_channels < 1 || _channels > 4)
+        {
+            _file.fail("Unsupported PAM depth");
+        }
+        if(_maxval == 0 || _maxval > 65535)
+        {
+            _file.fail("Invalid PNM maxval");
+        }
+        _sample_bytes = _maxval > 255 ? 2 : 1;
+
+        init(w, h);
+        _raw = fixed_vector<uint8_t>(safe_mul<size_t>(w, _channels, _sample_bytes));
+    }
+
+    std::string pnm_stream_reader::read_token()
+    {
+        uint8_t c = _file.read_u8();
+        while(std::isspace(c) || c == '#')
+        {
+            if(c == '#')
+            {
+                while(c != '\n') { c = _file.read_u8(); }
+            }
+            c = _file.read_u8();
+        }
+
+        std::string token;
+        while(!std::isspace(c))
+        {
+            token.push_back(static_cast<char>(c));
+            c = _file.read_u8();
+        }
+        return token;
+    }
+
+    size_t pnm_stream_reader::read_header_value()
+    {
+        std::string token = read_token();
+        char* end = nullptr;
+        unsigned long long value = std::strtoull(token.c_str(), &end, 10);
+        if(token.empty() || *end != '\0')
+        {
+            _file.fail("Invalid PNM header value '" + token + "'");
+        }
+        return static_cast<size_t>(value);
+    }
+
+    void pnm_stream_reader::decode_row(uint8_t* rgba)
+    {
+        _file.read(_raw.data(), _raw.size());
+
+        const uint8_t* src = _raw.cdata();
+        uint8_t tmp[4] = { 0, 0, 0, 255 };
+
+        for(size_t i = 0, s = 0; i < _width; ++i)
+        {
+            for(size_t c = 0; c < _channels; ++c, ++s)
+            {
+                unsigned int v = _sample_bytes == 2
+                    ? (static_cast<unsigned int>(src[s * 2]) << 8) | src[(s * 2) + 1]
+                    : src[s];
+                tmp[c] = _maxval == 255
+                    ? static_cast<uint8_t>(v)
+                    : static_cast<uint8_t>(((std::min(v, _maxval) * 255) + (_maxval / 2)) / _maxval);
+            }
+
+            uint8_t* dst = rgba + (i * 4);
+            switch(_channels)
+            {
+            case 1: // GRAYSCALE
+            case 2: // GRAYSCALE_ALPHA
+                dst[0] = dst[1] = dst[2] = tmp[0];
+                dst[3] = _channels == 2 ? tmp[1] : 255;
+                break;
+            default:
+                dst[0] = tmp[0];
+                dst[1] = tmp[1];
+                dst[2] = tmp[2];
+                dst[3] = _channels == 4 ? tmp[3] : 255;
+                break;
+            }
+        }
+    }
+
+    pnm_stream_writer::pnm_stream_writer(encode_sink& sink, size_t width, size_t height, bool alpha)
+        : _alpha(alpha)
+    {
+        init(sink, width, height);
+
+        std::string header = alpha
+            ? "P7\nWIDTH " + std::to_string(width)
+                + "\nHEIGHT " + std::to_string(height)
+                + "\nDEPTH 4\nMAXVAL 255\nTUPLTYPE RGB_ALPHA\nENDHDR\n"
+            : "P6\n" + std::to_string(width) + " " + std::to_string(height) + "\n255\n";
+        _sink->write(reinterpret_cast<const uint8_t*>(header.data()), header.size());
+
+        if(!alpha)
+        {
+            _raw = fixed_vector<uint8_t>(safe_mul<size_t>(width, 3));
+        }
+    }
+
+    void pnm_stream_writer::encode_row(const uint8_t* rgba)
+    {
+        if(_alpha)
+        {
+            _sink->write(rgba, _width * 4);
+            return;
+        }
+
+        uint8_t* dst = _raw.data();
+        for(size_t i = 0; i < _width; ++i)
+        {
+            dst[(i * 3) + 0] = rgba[(i * 4) + 0];
+            dst[(i * 3) + 1] = rgba[(i * 4) + 1];
+            dst[(i * 3) + 2] = rgba[(i * 4) + 2];
+        }
+        _sink->write(_raw.cdata(), _raw.size());
+    }
+
+    void pnm_stream_writer::encode_end()
+    {
+        _sink->flush();
+    }
+}
\ No newline at end of file
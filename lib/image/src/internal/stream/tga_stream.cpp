@@ -0,0 +1,236 @@
+#include <ien/internal/image_stream_formats.hpp>
+
+#include <ien/arithmetic.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace ien::_internal
+{
+    constexpr uint8_t TGA_TYPE_TRUECOLOR = 2;
+    constexpr uint8_t TGA_TYPE_GRAYSCALE = 3;
+    constexpr uint8_t TGA_TYPE_RLE_TRUECOLOR = 10;
+    constexpr uint8_t TGA_TYPE_RLE_GRAYSCALE = 11;
+
+    constexpr uint8_t TGA_DESC_RIGHT_TO_LEFT = 0x10;
+    constexpr uint8_t TGA_DESC_TOP_DOWN = 0x20;
+
+    constexpr size_t TGA_MAX_PACKET = 128;
+
+    inline uint16_t read_le16(const uint8_t* p)
+    {
+        return static_cast<uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    tga_stream_reader::tga_stream_reader(const std::string& path)
+        : _file(path, "rb")
+    {
+        uint8_t header[18];
+        _file.read(header, sizeof(header));
+
+        const uint8_t id_len = header[0];
+        const uint8_t colormap_type = header[1];
+        const uint8_t type = header[2];
+        const uint8_t depth = header[16];
+        const uint8_t descriptor = header[17];
+
+        const bool gray = type == TGA_TYPE_GRAYSCALE || type == TGA_TYPE_RLE_GRAYSCALE;
+        const bool truecolor = type == TGA_TYPE_TRUECOLOR || type == TGA_TYPE_RLE_TRUECOLOR;
+        if((!gray && !truecolor) || colormap_type > 1)
+        {
+            _file.unsupported("Unsupported TGA image type");
+        }
+        if((gray && depth != 8) || (truecolor && depth != 24 && depth != 32))
+        {
+            _file.unsupported("Unsupported TGA pixel depth");
+        }
+
+        _pixel_bytes = depth / 8;
+        _alpha = depth == 32;
+        _rle = type == TGA_TYPE_RLE_TRUECOLOR || type == TGA_TYPE_RLE_GRAYSCALE;
+        _right_to_left = (descriptor & TGA_DESC_RIGHT_TO_LEFT) != 0;
+        _bottom_up = (descriptor & TGA_DESC_TOP_DOWN) == 0;
+
+        // An unused color map may still be present
+        const size_t colormap_bytes = colormap_type == 1
+            ? read_le16(header + 5) * ((header[7] + 7u) / 8u)
+            : 0;
+        _data_offset = static_cast<long>(sizeof(header) + id_len + colormap_bytes);
+
+        init(read_le16(header + 12), read_le16(header + 14));
+        _file.seek(_data_offset);
+
+        // Rows are stored bottom-up and RLE packets have no fixed size, so the decoder
+        // state at every row start is recorded once and rows are then visited in reverse
+        if(_bottom_up && _rle)
+        {
+            _row_states.resize(_height);
+            for(size_t y = 0; y < _height; ++y)
+            {
+                _state.offset = _file.tell();
+                _row_states[y] = _state;
+                decode_pixels(_row.data(), _width);
+            }
+        }
+    }
+
+    void tga_stream_reader::read_pixel(uint8_t* rgba)
+    {
+        uint8_t px[4];
+        _file.read(px, _pixel_bytes);
+
+        if(_pixel_bytes == 1)
+        {
+            rgba[0] = rgba[1] = rgba[2] = px[0];
+            rgba[3] = 255;
+            return;
+        }
+        rgba[0] = px[2];
+        rgba[1] = px[1];
+        rgba[2] = px[0];
+        rgba[3] = _alpha ? px[3] : 255;
+    }
+
+    void tga_stream_reader::decode_pixels(uint8_t* rgba, size_t count)
+    {
+        if(!_rle)
+        {
+            for(size_t i = 0; i < count; ++i)
+            {
+                read_pixel(rgba + (i * 4));
+            }
+            return;
+        }
+
+        for(size_t i = 0; i < count; ++i)
+        {
+            if(_state.remaining == 0)
+            {
+                const uint8_t packet = _file.read_u8();
+                _state.repeat = (packet & 0x80) != 0;
+                _state.remaining = (packet & 0x7F) + 1u;
+                if(_state.repeat)
+                {
+                    read_pixel(_state.pixel.data());
+                }
+            }
+
+            if(_state.repeat)
+            {
+                std::memcpy(rgba + (i * 4), _state.pixel.data(), 4);
+            }
+            else
+            {
+                read_pixel(rgba + (i * 4));
+            }
+            --_state.remaining;
+        }
+    }
+
+    void tga_stream_reader::decode_row(uint8_t* rgba)
+    {
+        if(_bottom_up)
+        {
+            const size_t stored_row = _height - 1 - _next_row;
+            if(_rle)
+            {
+                _state = _row_states[stored_row];
+                _file.seek(_state.offset);
+            }
+            else
+            {
+                _file.seek(_data_offset + static_cast<long>(stored_row * _width * _pixel_bytes));
+            }
+        }
+
+        decode_pixels(rgba, _width);
+
+        if(_right_to_left)
+        {
+            for(size_t i = 0, j = _width - 1; i < j; ++i, --j)
+            {
+                std::swap_ranges(rgba + (i * 4), rgba + (i * 4) + 4, rgba + (j * 4));
+            }
+        }
+    }
+
+    tga_stream_writer::tga_stream_writer(encode_sink& sink, size_t width, size_t height)
+    {
+        if(width > 0xFFFF || height > 0xFFFF)
+        {
+            throw std::invalid_argument("TGA dimensions are limited to 65535 pixels");
+        }
+        init(sink, width, height);
+        _raw = fixed_vector<uint8_t>(safe_mul<size_t>(width, 4));
+
+        // Worst case, raw packets: one header byte per TGA_MAX_PACKET pixels
+        _packets = fixed_vector<uint8_t>(_raw.size() + ((width + TGA_MAX_PACKET - 1) / TGA_MAX_PACKET));
+
+        // RLE, 32-bit BGRA with 8 alpha bits, top-down so rows can be written as they come
+        uint8_t header[18] = {};
+        header[2] = TGA_TYPE_RLE_TRUECOLOR;
+        header[12] = static_cast<uint8_t>(width & 0xFF);
+        header[13] = static_cast<uint8_t>(width >> 8);
+        header[14] = static_cast<uint8_t>(height & 0xFF);
+        header[15] = static_cast<uint8_t>(height >> 8);
+        header[16] = 32;
+        header[17] = TGA_DESC_TOP_DOWN | 8;
+        _sink->write(header, sizeof(header));
+    }
+
+    void tga_stream_writer::encode_row(const uint8_t* rgba)
+    {
+        uint8_t* bgra = _raw.data();
+        for(size_t i = 0; i < _width; ++i)
+        {
+            bgra[(i * 4) + 0] = rgba[(i * 4) + 2];
+            bgra[(i * 4) + 1] = rgba[(i * 4) + 1];
+            bgra[(i * 4) + 2] = rgba[(i * 4) + 0];
+            bgra[(i * 4) + 3] = rgba[(i * 4) + 3];
+        }
+
+        auto same = [bgra](size_t a, size_t b)
+        {
+            return std::memcmp(bgra + (a * 4), bgra + (b * 4), 4) == 0;
+        };
+
+        // Packets never cross rows, as TGA 2.0 requires. A row goes to the sink in one write
+        uint8_t* out = _packets.data();
+        for(size_t i = 0; i < _width;)
+        {
+            size_t run = 1;
+            while(i + run < _width && run < TGA_MAX_PACKET && same(i, i + run))
+            {
+                ++run;
+            }
+
+            if(run > 1)
+            {
+                *out++ = static_cast<uint8_t>(0x80 | (run - 1));
+                std::memcpy(out, bgra + (i * 4), 4);
+                out += 4;
+                i += run;
+                continue;
+            }
+
+            // Raw packet up to the start of the next run
+            size_t len = 1;
+            while(i + len < _width && len < TGA_MAX_PACKET
+                && !(i + len + 1 < _width && same(i + len, i + len + 1)))
+            {
+                ++len;
+            }
+            *out++ = static_cast<uint8_t>(len - 1);
+            std::memcpy(out, bgra + (i * 4), len * 4);
+            out += len * 4;
+            i += len;
+        }
+        _sink->write(_packets.cdata(), static_cast<size_t>(out - _packets.cdata()));
+    }
+
+    void tga_stream_writer::encode_end()
+    {
+        _sink->flush();
+    }
+}
\ No newline at end of file
@@ -5,23 +5,22 @@
 #if defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)
 #include <ien/internal/std/image_ops_std.hpp>
 #include <ien/internal/image_ops_args.hpp>
+#include <ien/internal/x86/tier_scalar.hpp>
 
-#include <ien/arithmetic.hpp>
-#include <algorithm>
 #include <immintrin.h>
 
 #define AVX_ALIGNMENT 32
 
 #define DEBUG_ASSERT_RGBA_ALIGNED(r, g, b, a) \
-    LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(r, AVX_ALIGNMENT)); \
-    LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(g, AVX_ALIGNMENT)); \
-    LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(b, AVX_ALIGNMENT)); \
-    LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(a, AVX_ALIGNMENT))
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(r, AVX_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(g, AVX_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(b, AVX_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(a, AVX_ALIGNMENT))
 
 #define DEBUG_ASSERT_RGB_ALIGNED(r, g, b) \
-    LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(r, AVX_ALIGNMENT)); \
-    LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(g, AVX_ALIGNMENT)); \
-    LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(b, AVX_ALIGNMENT))    
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(r, AVX_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(g, AVX_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(b, AVX_ALIGNMENT))    
 
 #define BIND_CHANNELS(args, r, g, b, a) \
     uint8_t* r = args.ch_r; \
@@ -55,6 +54,9 @@
 #define LOAD_SI256_CONST(addr) \
     _mm256_load_si256(reinterpret_cast<const __m256i*>(addr));
 
+#define LOADU_SI256_CONST(addr) \
+    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(addr));
+
 namespace ien::image_ops::_internal
 {
     const uint32_t trunc_and_table[8] = {
@@ -129,23 +131,58 @@ namespace ien::image_ops::_internal
         }
     }
 
-    fixed_vector<uint8_t> rgba_average_avx2(const channel_info_extract_args_rgba& args)
+    void rgba_average_avx2(const channel_info_extract_args_rgba& args, uint8_t* out)
     {
-        return rgba_average_sse2(args);
-        // Not implemented...
+        const size_t img_sz = args.len;
+
+        if (img_sz < AVX_ALIGNMENT)
+        {
+            return rgba_average_sse2(args, out);
+        }
+
+        BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
+
+        const __m256i vzero = _mm256_setzero_si256();
+
+        size_t last_v_idx = img_sz - (img_sz % AVX_ALIGNMENT);
+        for (size_t i = 0; i < last_v_idx; i += AVX_ALIGNMENT)
+        {
+            __m256i vseg_r = LOAD_SI256_CONST(r + i);
+            __m256i vseg_g = LOAD_SI256_CONST(g + i);
+            __m256i vseg_b = LOAD_SI256_CONST(b + i);
+            __m256i vseg_a = LOAD_SI256_CONST(a + i);
+
+            // Exact floor((r + g + b + a) / 4) on 16 bit sums.
+            // Unpack and pack both work per 128 bit lane, so the byte order is kept
+            __m256i vsum_lo = _mm256_add_epi16(
+                _mm256_add_epi16(_mm256_unpacklo_epi8(vseg_r, vzero), _mm256_unpacklo_epi8(vseg_g, vzero)),
+                _mm256_add_epi16(_mm256_unpacklo_epi8(vseg_b, vzero), _mm256_unpacklo_epi8(vseg_a, vzero))
+            );
+            __m256i vsum_hi = _mm256_add_epi16(
+                _mm256_add_epi16(_mm256_unpackhi_epi8(vseg_r, vzero), _mm256_unpackhi_epi8(vseg_g, vzero)),
+                _mm256_add_epi16(_mm256_unpackhi_epi8(vseg_b, vzero), _mm256_unpackhi_epi8(vseg_a, vzero))
+            );
+
+            __m256i vavg_rgba = _mm256_packus_epi16(_mm256_srli_epi16(vsum_lo, 2), _mm256_srli_epi16(vsum_hi, 2));
+
+            STOREU_SI256((out + i), vavg_rgba);
+        }
+
+        for (size_t i = last_v_idx; i < img_sz; ++i)
+        {
+            out[i] = tier_average(r[i], g[i], b[i], a[i]);
+        }
     }
 
-    fixed_vector<uint8_t> rgba_max_avx2(const channel_info_extract_args_rgba& args)
+    void rgba_max_avx2(const channel_info_extract_args_rgba& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
 
         if (img_sz < AVX_ALIGNMENT)
         {
-            return rgba_max_std(args);
+            return rgba_max_std(args, out);
         }
 
-        fixed_vector<uint8_t> result(args.len, AVX_ALIGNMENT);
-
         BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
 
         size_t last_v_idx = img_sz - (img_sz % AVX_ALIGNMENT);
@@ -160,27 +197,24 @@ namespace ien::image_ops::_internal
             __m256i vmax_ba = _mm256_max_epu8(vseg_b, vseg_a);
             __m256i vmax_rgba = _mm256_max_epu8(vmax_rg, vmax_ba);
 
-            STOREU_SI256((result.data() + i), vmax_rgba);
+            STOREU_SI256((out + i), vmax_rgba);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            result[i] = std::max({ r[i], g[i], b[i], a[i] });
+            out[i] = tier_max(r[i], g[i], b[i], a[i]);
         }
-        return result;
     }
 
-    fixed_vector<uint8_t> rgba_min_avx2(const channel_info_extract_args_rgba& args)
+    void rgba_min_avx2(const channel_info_extract_args_rgba& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
 
         if (img_sz < AVX_ALIGNMENT)
         {
-            return rgba_min_std(args);
+            return rgba_min_std(args, out);
         }
 
-        fixed_vector<uint8_t> result(args.len, AVX_ALIGNMENT);
-
         BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
 
         size_t last_v_idx = img_sz - (img_sz % AVX_ALIGNMENT);
@@ -195,27 +229,24 @@ namespace ien::image_ops::_internal
             __m256i vmax_ba = _mm256_min_epu8(vseg_b, vseg_a);
             __m256i vmax_rgba = _mm256_min_epu8(vmax_rg, vmax_ba);
 
-            STOREU_SI256((result.data() + i), vmax_rgba);
+            STOREU_SI256((out + i), vmax_rgba);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            result[i] = std::min({ r[i], g[i], b[i], a[i] });
+            out[i] = tier_min(r[i], g[i], b[i], a[i]);
         }
-        return result;
     }
 
-    fixed_vector<float> rgb_average_avx2(const channel_info_extract_args_rgb& args)
+    void rgb_average_avx2(const channel_info_extract_args_rgb& args, float* out)
     {        
         const size_t img_sz = args.len;
         
         if (img_sz < AVX_ALIGNMENT)
         {
-            return rgb_average_std(args);
+            return rgb_average_std(args, out);
         }
         
-        fixed_vector<float> result(args.len, AVX_ALIGNMENT);
-        
         BIND_CHANNELS_RGB_CONST(args, r, g, b);        
         
         const __m256 vmul_div3 = _mm256_set1_ps(0.333334F);
@@ -240,28 +271,25 @@ namespace ien::image_ops::_internal
                 __m256 sum = _mm256_add_ps(_mm256_add_ps(vrf, vgf), vbf);
                 __m256 avg = _mm256_mul_ps(sum, vmul_div3);
         
-                _mm256_store_ps(result.data() + i + (vidx * 8), avg);
+                _mm256_storeu_ps(out + i + (vidx * 8), avg);
             }
         }
         
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            result[i] = ien::safe_add<float>(r[i], g[i], b[i]) / 3;
+            out[i] = tier_average(r[i], g[i], b[i]);
         }
-        return result;
     }
 
-    fixed_vector<uint8_t> rgb_max_avx2(const channel_info_extract_args_rgb& args)
+    void rgb_max_avx2(const channel_info_extract_args_rgb& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
 
         if (img_sz < AVX_ALIGNMENT)
         {
-            return rgb_max_std(args);
+            return rgb_max_std(args, out);
         }
 
-        fixed_vector<uint8_t> result(args.len, AVX_ALIGNMENT);
-
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
         size_t last_v_idx = img_sz - (img_sz % AVX_ALIGNMENT);
@@ -274,27 +302,24 @@ namespace ien::image_ops::_internal
             __m256i vmax_rg = _mm256_max_epu8(vseg_r, vseg_g);
             __m256i vmax_rgb = _mm256_max_epu8(vmax_rg, vseg_b);
 
-            STOREU_SI256((result.data() + i), vmax_rgb);
+            STOREU_SI256((out + i), vmax_rgb);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            result[i] = std::max({ r[i], g[i], b[i] });
+            out[i] = tier_max(r[i], g[i], b[i]);
         }
-        return result;
     }
 
-    fixed_vector<uint8_t> rgb_min_avx2(const channel_info_extract_args_rgb& args)
+    void rgb_min_avx2(const channel_info_extract_args_rgb& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
 
         if (img_sz < AVX_ALIGNMENT)
         {
-            return rgb_min_std(args);
+            return rgb_min_std(args, out);
         }
 
-        fixed_vector<uint8_t> result(args.len, AVX_ALIGNMENT);
-
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
         size_t last_v_idx = img_sz - (img_sz % AVX_ALIGNMENT);
@@ -307,27 +332,24 @@ namespace ien::image_ops::_internal
             __m256i vmax_rg = _mm256_min_epu8(vseg_r, vseg_g);
             __m256i vmax_rgb = _mm256_min_epu8(vmax_rg, vseg_b);
 
-            STOREU_SI256((result.data() + i), vmax_rgb);
+            STOREU_SI256((out + i), vmax_rgb);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            result[i] = std::min({ r[i], g[i], b[i] });
+            out[i] = tier_min(r[i], g[i], b[i]);
         }
-        return result;
     }
 
-    fixed_vector<uint8_t> rgba_sum_saturated_avx2(const channel_info_extract_args_rgba& args)
+    void rgba_sum_saturated_avx2(const channel_info_extract_args_rgba& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
 
         if (img_sz < AVX_ALIGNMENT)
         {
-            return rgba_sum_saturated_std(args);
+            return rgba_sum_saturated_std(args, out);
         }
 
-        fixed_vector<uint8_t> result(args.len, AVX_ALIGNMENT);
-
         BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
 
         size_t last_v_idx = img_sz - (img_sz % AVX_ALIGNMENT);
@@ -342,29 +364,26 @@ namespace ien::image_ops::_internal
             __m256i vsum_ba = _mm256_adds_epu8(vseg_b, vseg_a);
             __m256i vsum_rgba = _mm256_adds_epu8(vsum_rg, vsum_ba);
 
-            STOREU_SI256((result.data() + i), vsum_rgba);
+            STOREU_SI256((out + i), vsum_rgba);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
             uint16_t aux = static_cast<uint16_t>(r[i]) + g[i] + b[i] + a[i];
-            aux = std::min(static_cast<uint16_t>(0x00FFu), aux);
-            result[i] = static_cast<uint8_t>(aux);
+            aux = (aux < 0x00FFu) ? aux : static_cast<uint16_t>(0x00FFu);
+            out[i] = static_cast<uint8_t>(aux);
         }
-        return result;
     }
 
-    fixed_vector<float> rgb_saturation_avx2(const channel_info_extract_args_rgb& args)
+    void rgb_saturation_avx2(const channel_info_extract_args_rgb& args, float* out)
     {
         const size_t img_sz = args.len;
 
         if (img_sz < AVX_ALIGNMENT)
         {
-            return rgb_saturation_std(args);
+            return rgb_saturation_std(args, out);
         }
 
-        fixed_vector<float> result(args.len, AVX_ALIGNMENT);
-
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
         __m256i fpcast_mask = _mm256_set1_epi32(0x000000FF);
@@ -416,34 +435,30 @@ namespace ien::image_ops::_internal
 
             for (size_t k = 0; k < 8; ++k)
             {
-                result[0 + i + (k * 4)] = aux_result[0 + k];
-                result[1 + i + (k * 4)] = aux_result[8 + k];
-                result[2 + i + (k * 4)] = aux_result[16 + k];
-                result[3 + i + (k * 4)] = aux_result[24 + k];
+                out[0 + i + (k * 4)] = aux_result[0 + k];
+                out[1 + i + (k * 4)] = aux_result[8 + k];
+                out[2 + i + (k * 4)] = aux_result[16 + k];
+                out[3 + i + (k * 4)] = aux_result[24 + k];
             }
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            float vmax = static_cast<float>(std::max({ r[i], g[i], b[i] })) / 255.0F;
-            float vmin = static_cast<float>(std::min({ r[i], g[i], b[i] })) / 255.0F;
-            result[i] = (vmax - vmin) / vmax;
+            float vmax = static_cast<float>(tier_max(r[i], g[i], b[i])) / 255.0F;
+            float vmin = static_cast<float>(tier_min(r[i], g[i], b[i])) / 255.0F;
+            out[i] = (vmax - vmin) / vmax;
         }
-
-        return result;
     }
 
-    fixed_vector<float> rgb_luminance_avx2(const channel_info_extract_args_rgb& args)
+    void rgb_luminance_avx2(const channel_info_extract_args_rgb& args, float* out)
     {
         const size_t img_sz = args.len;
 
         if (img_sz < AVX_ALIGNMENT)
         {
-            return rgb_luminance_std(args);
+            return rgb_luminance_std(args, out);
         }
 
-        fixed_vector<float> result(args.len, AVX_ALIGNMENT);
-
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
         size_t last_v_idx = img_sz - (img_sz % AVX_ALIGNMENT);
@@ -489,53 +504,120 @@ namespace ien::image_ops::_internal
             vlum.data[2] = _mm256_mul_ps(vlum.data[2], vlum_div_255);
             vlum.data[3] = _mm256_mul_ps(vlum.data[3], vlum_div_255);
 
-            _mm256_store_ps(result.data() + i + 0, vlum.data[0]);
-            _mm256_store_ps(result.data() + i + 8, vlum.data[1]);
-            _mm256_store_ps(result.data() + i + 16, vlum.data[2]);
-            _mm256_store_ps(result.data() + i + 24, vlum.data[3]);
+            _mm256_storeu_ps(out + i + 0, vlum.data[0]);
+            _mm256_storeu_ps(out + i + 8, vlum.data[1]);
+            _mm256_storeu_ps(out + i + 16, vlum.data[2]);
+            _mm256_storeu_ps(out + i + 24, vlum.data[3]);
 
             continue;
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {            
-            result[i] = (r[i] * 0.2126F / 255) + (g[i] * 0.7152F / 255) + (b[i] * 0.0722F / 255);
+            out[i] = (r[i] * 0.2126F / 255) + (g[i] * 0.7152F / 255) + (b[i] * 0.0722F / 255);
         }
+    }
+
+    void rgb_metrics_avx2(const rgb_metrics_args& args)
+    {
+        const size_t img_sz = args.len;
 
-        return result;
+        if (img_sz < AVX_ALIGNMENT)
+        {
+            return rgb_metrics_sse2(args);
+        }
+
+        BIND_CHANNELS_RGB_CONST(args, r, g, b);
+
+        const __m256 vlum_mul_r = _mm256_set1_ps(0.2126F);
+        const __m256 vlum_mul_g = _mm256_set1_ps(0.7152F);
+        const __m256 vlum_mul_b = _mm256_set1_ps(0.0722F);
+        const __m256 vlum_div_255 = _mm256_set1_ps(1.0F / 255);
+        const __m256 vmul_div3 = _mm256_set1_ps(0.333334F);
+
+        const bool need_channels_f32 = args.luminance || args.average;
+
+        size_t last_v_idx = img_sz - (img_sz % AVX_ALIGNMENT);
+        for (size_t i = 0; i < last_v_idx; i += AVX_ALIGNMENT)
+        {
+            __m256i vseg_r = LOAD_SI256_CONST(r + i);
+            __m256i vseg_g = LOAD_SI256_CONST(g + i);
+            __m256i vseg_b = LOAD_SI256_CONST(b + i);
+
+            __m256i vmax_rgb = _mm256_max_epu8(_mm256_max_epu8(vseg_r, vseg_g), vseg_b);
+            __m256i vmin_rgb = _mm256_min_epu8(_mm256_min_epu8(vseg_r, vseg_g), vseg_b);
+
+            if (args.max) { STOREU_SI256(args.max + i, vmax_rgb); }
+            if (args.min) { STOREU_SI256(args.min + i, vmin_rgb); }
+
+            if (need_channels_f32)
+            {
+                vec4x8xf32 vfr = extract_4x8xf32_from_16xu8(vseg_r);
+                vec4x8xf32 vfg = extract_4x8xf32_from_16xu8(vseg_g);
+                vec4x8xf32 vfb = extract_4x8xf32_from_16xu8(vseg_b);
+
+                for (size_t vidx = 0; vidx < 4; ++vidx)
+                {
+                    if (args.luminance)
+                    {
+                        __m256 vlum = _mm256_add_ps(
+                            _mm256_add_ps(_mm256_mul_ps(vfr.data[vidx], vlum_mul_r), _mm256_mul_ps(vfg.data[vidx], vlum_mul_g)),
+                            _mm256_mul_ps(vfb.data[vidx], vlum_mul_b)
+                        );
+                        _mm256_storeu_ps(args.luminance + i + (vidx * 8), _mm256_mul_ps(vlum, vlum_div_255));
+                    }
+                    if (args.average)
+                    {
+                        __m256 vsum = _mm256_add_ps(_mm256_add_ps(vfr.data[vidx], vfg.data[vidx]), vfb.data[vidx]);
+                        _mm256_storeu_ps(args.average + i + (vidx * 8), _mm256_mul_ps(vsum, vmul_div3));
+                    }
+                }
+            }
+
+            if (args.saturation)
+            {
+                vec4x8xf32 vfmax = extract_4x8xf32_from_16xu8(vmax_rgb);
+                vec4x8xf32 vfmin = extract_4x8xf32_from_16xu8(vmin_rgb);
+
+                for (size_t vidx = 0; vidx < 4; ++vidx)
+                {
+                    __m256 vsat = _mm256_div_ps(_mm256_sub_ps(vfmax.data[vidx], vfmin.data[vidx]), vfmax.data[vidx]);
+                    _mm256_storeu_ps(args.saturation + i + (vidx * 8), vsat);
+                }
+            }
+        }
+
+        rgb_metrics_std(args.subrange(last_v_idx, img_sz - last_v_idx));
     }
 
-    image_planar_data unpack_image_data_avx2(const uint8_t* data, size_t len)
+    void unpack_image_data_avx2(const uint8_t* data, size_t len, image_planar_data& out)
     {
         if (len < (AVX_ALIGNMENT * 4))
         {
-            return unpack_image_data_ssse3(data, len);
+            return unpack_image_data_ssse3(data, len, out);
         }
 
-        image_planar_data result(len / 4);
-        uint8_t* r = result.data_r();
-        uint8_t* g = result.data_g();
-        uint8_t* b = result.data_b();
-        uint8_t* a = result.data_a();
+        uint8_t* r = out.data_r();
+        uint8_t* g = out.data_g();
+        uint8_t* b = out.data_b();
+        uint8_t* a = out.data_a();
 
-        const __m256i vshufmask = _mm256_set_epi8(
-            19, 15, 11, 7,
-            18, 14, 10, 6,
-            17, 13, 9, 5,
-            16, 12, 8, 4,
-            15, 11, 7, 3,
-            14, 10, 6, 2, 
-            13, 9, 5, 1,
-            12, 8, 4, 0
+        // Per 128-bit lane: rgba x4 -> rrrr gggg bbbb aaaa
+        const __m256i vshufmask = _mm256_setr_epi8(
+            0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+            0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15
         );
 
+        // The unpacks below work per lane, leaving 4-pixel groups ordered 0 2 4 6 | 1 3 5 7
+        const __m256i vgroupmask = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
         size_t last_v_idx = len - (len % (AVX_ALIGNMENT * 4));
         for (size_t i = 0; i < last_v_idx; i += AVX_ALIGNMENT * 4)
         {
-            __m256i vdata0 = LOAD_SI256_CONST(data + i + (AVX_ALIGNMENT * 0));
-            __m256i vdata1 = LOAD_SI256_CONST(data + i + (AVX_ALIGNMENT * 1));
-            __m256i vdata2 = LOAD_SI256_CONST(data + i + (AVX_ALIGNMENT * 2));
-            __m256i vdata3 = LOAD_SI256_CONST(data + i + (AVX_ALIGNMENT * 3));
+            __m256i vdata0 = LOADU_SI256_CONST(data + i + (AVX_ALIGNMENT * 0));
+            __m256i vdata1 = LOADU_SI256_CONST(data + i + (AVX_ALIGNMENT * 1));
+            __m256i vdata2 = LOADU_SI256_CONST(data + i + (AVX_ALIGNMENT * 2));
+            __m256i vdata3 = LOADU_SI256_CONST(data + i + (AVX_ALIGNMENT * 3));
 
             __m256i v_di_data0 = _mm256_shuffle_epi8(vdata0, vshufmask);
             __m256i v_di_data1 = _mm256_shuffle_epi8(vdata1, vshufmask);
@@ -552,32 +634,73 @@ namespace ien::image_ops::_internal
             __m256i v_b0b1b2b3 = _mm256_unpacklo_epi64(v_b0b1a0a1, v_b2b3a2a3);
             __m256i v_a0a1a2a3 = _mm256_unpackhi_epi64(v_b0b1a0a1, v_b2b3a2a3);
 
-            STORE_SI256(r + (i / 4), v_r0r1r2r3);
-            STORE_SI256(g + (i / 4), v_g0g1g2g3);
-            STORE_SI256(b + (i / 4), v_b0b1b2b3);
-            STORE_SI256(a + (i / 4), v_a0a1a2a3);
+            STORE_SI256(r + (i / 4), _mm256_permutevar8x32_epi32(v_r0r1r2r3, vgroupmask));
+            STORE_SI256(g + (i / 4), _mm256_permutevar8x32_epi32(v_g0g1g2g3, vgroupmask));
+            STORE_SI256(b + (i / 4), _mm256_permutevar8x32_epi32(v_b0b1b2b3, vgroupmask));
+            STORE_SI256(a + (i / 4), _mm256_permutevar8x32_epi32(v_a0a1a2a3, vgroupmask));
         }
 
-        for (size_t i = last_v_idx; i < len; ++i)
+        for (size_t i = last_v_idx; i < len; i += 4)
         {
             r[i / 4] = data[i + 0];
             g[i / 4] = data[i + 1];
             b[i / 4] = data[i + 2];
             a[i / 4] = data[i + 3];
         }
-
-        return result;
     }
 
-    fixed_vector<uint8_t> channel_compare_avx2(const channel_compare_args& args)
+    void pack_image_data_avx2(const channel_info_extract_args_rgba& args, uint8_t* out)
     {
         const size_t len = args.len;
         if (len < AVX_ALIGNMENT)
         {
-            return channel_compare_std(args);
+            return pack_image_data_sse2(args, out);
+        }
+
+        BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
+
+        size_t last_v_idx = len - (len % AVX_ALIGNMENT);
+        for (size_t i = 0; i < last_v_idx; i += AVX_ALIGNMENT)
+        {
+            __m256i vr = LOAD_SI256_CONST(r + i);
+            __m256i vg = LOAD_SI256_CONST(g + i);
+            __m256i vb = LOAD_SI256_CONST(b + i);
+            __m256i va = LOAD_SI256_CONST(a + i);
+
+            // Unpacks work per 128-bit lane: lane 0 holds pixels 0-15, lane 1 holds pixels 16-31
+            __m256i v_rg_lo = _mm256_unpacklo_epi8(vr, vg);
+            __m256i v_rg_hi = _mm256_unpackhi_epi8(vr, vg);
+            __m256i v_ba_lo = _mm256_unpacklo_epi8(vb, va);
+            __m256i v_ba_hi = _mm256_unpackhi_epi8(vb, va);
+
+            __m256i v_px0_3 = _mm256_unpacklo_epi16(v_rg_lo, v_ba_lo);
+            __m256i v_px4_7 = _mm256_unpackhi_epi16(v_rg_lo, v_ba_lo);
+            __m256i v_px8_11 = _mm256_unpacklo_epi16(v_rg_hi, v_ba_hi);
+            __m256i v_px12_15 = _mm256_unpackhi_epi16(v_rg_hi, v_ba_hi);
+
+            uint8_t* dst = out + (i * 4);
+            STOREU_SI256(dst + (AVX_ALIGNMENT * 0), _mm256_permute2x128_si256(v_px0_3, v_px4_7, 0x20));
+            STOREU_SI256(dst + (AVX_ALIGNMENT * 1), _mm256_permute2x128_si256(v_px8_11, v_px12_15, 0x20));
+            STOREU_SI256(dst + (AVX_ALIGNMENT * 2), _mm256_permute2x128_si256(v_px0_3, v_px4_7, 0x31));
+            STOREU_SI256(dst + (AVX_ALIGNMENT * 3), _mm256_permute2x128_si256(v_px8_11, v_px12_15, 0x31));
         }
 
-        fixed_vector<uint8_t> result(len, AVX_ALIGNMENT);
+        for (size_t i = last_v_idx; i < len; ++i)
+        {
+            out[(i * 4) + 0] = r[i];
+            out[(i * 4) + 1] = g[i];
+            out[(i * 4) + 2] = b[i];
+            out[(i * 4) + 3] = a[i];
+        }
+    }
+
+    void channel_compare_avx2(const channel_compare_args& args, uint8_t* out)
+    {
+        const size_t len = args.len;
+        if (len < AVX_ALIGNMENT)
+        {
+            return channel_compare_std(args, out);
+        }
 
         const __m256i vthreshold = _mm256_set1_epi8(args.threshold);
 
@@ -586,15 +709,240 @@ namespace ien::image_ops::_internal
         {
             __m256i vseg = LOAD_SI256_CONST(args.ch + i);
             __m256i vcmp = _mm256_cmpeq_epi8(vseg, _mm256_max_epu8(vseg, vthreshold));
-            STORE_SI256(result.data() + i, vcmp);
+            STOREU_SI256(out + i, vcmp);
+        }
+
+        for (size_t i = last_v_idx; i < len; ++i)
+        {
+            out[i] = args.ch[i] >= args.threshold;
+        }
+    }
+
+    // The 32-bit square accumulators grow by at most 4 * 255^2 per iteration,
+    // they are widened to 64 bits well before they could overflow
+    const size_t REDUCE_FLUSH_INTERVAL = 8192;
+
+    // Byte wise horizontal min/max by folding halves
+    static inline uint8_t horizontal_min_epu8(__m256i vw)
+    {
+        __m128i v = _mm_min_epu8(_mm256_castsi256_si128(vw), _mm256_extracti128_si256(vw, 1));
+        v = _mm_min_epu8(v, _mm_srli_si128(v, 8));
+        v = _mm_min_epu8(v, _mm_srli_si128(v, 4));
+        v = _mm_min_epu8(v, _mm_srli_si128(v, 2));
+        v = _mm_min_epu8(v, _mm_srli_si128(v, 1));
+        return static_cast<uint8_t>(_mm_cvtsi128_si32(v));
+    }
+
+    static inline uint8_t horizontal_max_epu8(__m256i vw)
+    {
+        __m128i v = _mm_max_epu8(_mm256_castsi256_si128(vw), _mm256_extracti128_si256(vw, 1));
+        v = _mm_max_epu8(v, _mm_srli_si128(v, 8));
+        v = _mm_max_epu8(v, _mm_srli_si128(v, 4));
+        v = _mm_max_epu8(v, _mm_srli_si128(v, 2));
+        v = _mm_max_epu8(v, _mm_srli_si128(v, 1));
+        return static_cast<uint8_t>(_mm_cvtsi128_si32(v));
+    }
+
+    static void reduce_channel_avx2(const uint8_t* data, size_t len, rgba_reduction& out, size_t ch)
+    {
+        const __m256i vzero = _mm256_setzero_si256();
+        __m256i vsum = vzero;
+        __m256i vsum_sq = vzero;
+        __m256i vsum_sq32 = vzero;
+        __m256i vmin = _mm256_set1_epi8(static_cast<char>(0xFF));
+        __m256i vmax = vzero;
+
+        size_t last_v_idx = len - (len % AVX_ALIGNMENT);
+        size_t flush_count = 0;
+        for (size_t i = 0; i < last_v_idx; i += AVX_ALIGNMENT)
+        {
+            __m256i vseg = LOAD_SI256_CONST(data + i);
+            vsum = _mm256_add_epi64(vsum, _mm256_sad_epu8(vseg, vzero));
+
+            __m256i vlo = _mm256_unpacklo_epi8(vseg, vzero);
+            __m256i vhi = _mm256_unpackhi_epi8(vseg, vzero);
+            vsum_sq32 = _mm256_add_epi32(vsum_sq32, _mm256_add_epi32(_mm256_madd_epi16(vlo, vlo), _mm256_madd_epi16(vhi, vhi)));
+
+            vmin = _mm256_min_epu8(vmin, vseg);
+            vmax = _mm256_max_epu8(vmax, vseg);
+
+            if (++flush_count == REDUCE_FLUSH_INTERVAL)
+            {
+                vsum_sq = _mm256_add_epi64(vsum_sq, _mm256_unpacklo_epi32(vsum_sq32, vzero));
+                vsum_sq = _mm256_add_epi64(vsum_sq, _mm256_unpackhi_epi32(vsum_sq32, vzero));
+                vsum_sq32 = vzero;
+                flush_count = 0;
+            }
         }
+        vsum_sq = _mm256_add_epi64(vsum_sq, _mm256_unpacklo_epi32(vsum_sq32, vzero));
+        vsum_sq = _mm256_add_epi64(vsum_sq, _mm256_unpackhi_epi32(vsum_sq32, vzero));
+
+        alignas(AVX_ALIGNMENT) uint64_t sums[4];
+        alignas(AVX_ALIGNMENT) uint64_t sums_sq[4];
+        STORE_SI256(sums, vsum);
+        STORE_SI256(sums_sq, vsum_sq);
+
+        uint64_t sum = sums[0] + sums[1] + sums[2] + sums[3];
+        uint64_t sum_sq = sums_sq[0] + sums_sq[1] + sums_sq[2] + sums_sq[3];
+        uint8_t min = horizontal_min_epu8(vmin);
+        uint8_t max = horizontal_max_epu8(vmax);
 
         for (size_t i = last_v_idx; i < len; ++i)
         {
-            result[i] = args.ch[i] >= args.threshold;
+            const uint32_t v = data[i];
+            sum += v;
+            sum_sq += v * v;
+            min = (data[i] < min) ? data[i] : min;
+            max = (data[i] > max) ? data[i] : max;
         }
 
-        return result;
+        out.sum[ch] = sum;
+        out.sum_sq[ch] = sum_sq;
+        out.min[ch] = min;
+        out.max[ch] = max;
+    }
+
+    void rgba_reduce_avx2(const channel_info_extract_args_rgba& args, rgba_reduction& out)
+    {
+        BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
+
+        reduce_channel_avx2(r, args.len, out, 0);
+        reduce_channel_avx2(g, args.len, out, 1);
+        reduce_channel_avx2(b, args.len, out, 2);
+        reduce_channel_avx2(a, args.len, out, 3);
+    }
+
+    static inline uint8_t resample_round(int32_t accum)
+    {
+        const int32_t v = (accum + (1 << (resample_coeffs::PRECISION_BITS - 1))) >> resample_coeffs::PRECISION_BITS;
+        return static_cast<uint8_t>((v < 0) ? 0 : ((v > 255) ? 255 : v));
+    }
+
+    static inline uint8_t resample_pixel(const uint8_t* px, const int16_t* weights, size_t taps)
+    {
+        int32_t accum = 0;
+        for (size_t t = 0; t < taps; ++t)
+        {
+            accum += px[t] * weights[t];
+        }
+        return resample_round(accum);
+    }
+
+    void resample_horizontal_avx2(const resample_args& args)
+    {
+        const resample_coeffs& coeffs = *args.coeffs;
+        const size_t* first = coeffs.first_data();
+        const int16_t* coeff_weights = coeffs.weights_data();
+        const size_t out_len = coeffs.out_len;
+
+        for (size_t row = args.row_begin; row < args.row_end; ++row)
+        {
+            const uint8_t* src = args.src + (row * coeffs.in_len);
+            uint8_t* dst = args.dst + (row * out_len);
+
+            // Two output pixels per iteration, one in each 128-bit lane
+            size_t i = 0;
+            for (; i + 1 < out_len; i += 2)
+            {
+                const uint8_t* px0 = src + first[i];
+                const uint8_t* px1 = src + first[i + 1];
+                const int16_t* weights0 = coeff_weights + (i * coeffs.weight_stride);
+                const int16_t* weights1 = weights0 + coeffs.weight_stride;
+
+                // Whole 8 tap chunks would read past the end of the row near the right edge
+                if (first[i + 1] + coeffs.weight_stride > coeffs.in_len)
+                {
+                    break;
+                }
+
+                __m256i vaccum = _mm256_setzero_si256();
+                for (size_t t = 0; t < coeffs.weight_stride; t += 8)
+                {
+                    __m128i vpx = _mm_unpacklo_epi64(
+                        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(px0 + t)),
+                        _mm_loadl_epi64(reinterpret_cast<const __m128i*>(px1 + t))
+                    );
+                    __m256i vweights = _mm256_inserti128_si256(
+                        _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(weights0 + t))),
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(weights1 + t)),
+                        1
+                    );
+                    vaccum = _mm256_add_epi32(vaccum, _mm256_madd_epi16(_mm256_cvtepu8_epi16(vpx), vweights));
+                }
+                vaccum = _mm256_hadd_epi32(vaccum, vaccum);
+                vaccum = _mm256_hadd_epi32(vaccum, vaccum);
+
+                dst[i] = resample_round(_mm256_extract_epi32(vaccum, 0));
+                dst[i + 1] = resample_round(_mm256_extract_epi32(vaccum, 4));
+            }
+
+            for (; i < out_len; ++i)
+            {
+                dst[i] = resample_pixel(src + first[i], coeff_weights + (i * coeffs.weight_stride), coeffs.taps);
+            }
+        }
+    }
+
+    void resample_vertical_avx2(const resample_args& args)
+    {
+        const resample_coeffs& coeffs = *args.coeffs;
+        const size_t* first = coeffs.first_data();
+        const int16_t* coeff_weights = coeffs.weights_data();
+        const size_t width = args.width;
+        if (width < AVX_ALIGNMENT)
+        {
+            return resample_vertical_sse2(args);
+        }
+
+        const __m256i vzero = _mm256_setzero_si256();
+        const __m256i vround = _mm256_set1_epi32(1 << (resample_coeffs::PRECISION_BITS - 1));
+
+        for (size_t row = args.row_begin; row < args.row_end; ++row)
+        {
+            const uint8_t* src = args.src + (first[row] * width);
+            const int16_t* weights = coeff_weights + (row * coeffs.weight_stride);
+            uint8_t* dst = args.dst + (row * width);
+
+            for (size_t x = 0; x < width; x += AVX_ALIGNMENT)
+            {
+                // The last chunk overlaps the previous one instead of running a scalar tail
+                x = (x < width - AVX_ALIGNMENT) ? x : (width - AVX_ALIGNMENT);
+
+                __m256i vaccum0 = vround;
+                __m256i vaccum1 = vround;
+                __m256i vaccum2 = vround;
+                __m256i vaccum3 = vround;
+
+                // Taps go in pairs through madd, an odd last tap is paired with itself and a zero padding weight
+                for (size_t t = 0; t < coeffs.taps; t += 2)
+                {
+                    const size_t t_next = (t + 1 < coeffs.taps) ? (t + 1) : t;
+                    __m256i va = LOADU_SI256_CONST(src + (t * width) + x);
+                    __m256i vb = LOADU_SI256_CONST(src + (t_next * width) + x);
+                    const uint32_t wpair = static_cast<uint16_t>(weights[t]) | (static_cast<uint32_t>(static_cast<uint16_t>(weights[t + 1])) << 16);
+                    __m256i vweights = _mm256_set1_epi32(static_cast<int>(wpair));
+
+                    // In-lane unpacks here and in-lane packs below cancel out, pixel order is preserved
+                    __m256i va_lo = _mm256_unpacklo_epi8(va, vzero);
+                    __m256i va_hi = _mm256_unpackhi_epi8(va, vzero);
+                    __m256i vb_lo = _mm256_unpacklo_epi8(vb, vzero);
+                    __m256i vb_hi = _mm256_unpackhi_epi8(vb, vzero);
+
+                    vaccum0 = _mm256_add_epi32(vaccum0, _mm256_madd_epi16(_mm256_unpacklo_epi16(va_lo, vb_lo), vweights));
+                    vaccum1 = _mm256_add_epi32(vaccum1, _mm256_madd_epi16(_mm256_unpackhi_epi16(va_lo, vb_lo), vweights));
+                    vaccum2 = _mm256_add_epi32(vaccum2, _mm256_madd_epi16(_mm256_unpacklo_epi16(va_hi, vb_hi), vweights));
+                    vaccum3 = _mm256_add_epi32(vaccum3, _mm256_madd_epi16(_mm256_unpackhi_epi16(va_hi, vb_hi), vweights));
+                }
+
+                vaccum0 = _mm256_srai_epi32(vaccum0, resample_coeffs::PRECISION_BITS);
+                vaccum1 = _mm256_srai_epi32(vaccum1, resample_coeffs::PRECISION_BITS);
+                vaccum2 = _mm256_srai_epi32(vaccum2, resample_coeffs::PRECISION_BITS);
+                vaccum3 = _mm256_srai_epi32(vaccum3, resample_coeffs::PRECISION_BITS);
+
+                __m256i vres = _mm256_packus_epi16(_mm256_packs_epi32(vaccum0, vaccum1), _mm256_packs_epi32(vaccum2, vaccum3));
+                STOREU_SI256(dst + x, vres);
+            }
+        }
     }
 }
 #endif
\ No newline at end of file
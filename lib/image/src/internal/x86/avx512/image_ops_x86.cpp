@@ -0,0 +1,671 @@
+#include <ien/internal/x86/image_ops_x86.hpp>
+
+#include <ien/platform.hpp>
+
+#if defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)
+#include <ien/internal/std/image_ops_std.hpp>
+#include <ien/internal/image_ops_args.hpp>
+#include <ien/internal/x86/tier_scalar.hpp>
+
+#include <immintrin.h>
+
+#define AVX512_ALIGNMENT 64
+
+#define DEBUG_ASSERT_RGBA_ALIGNED(r, g, b, a) \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(r, AVX512_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(g, AVX512_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(b, AVX512_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(a, AVX512_ALIGNMENT))
+
+#define DEBUG_ASSERT_RGB_ALIGNED(r, g, b) \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(r, AVX512_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(g, AVX512_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(b, AVX512_ALIGNMENT))
+
+#define BIND_CHANNELS(args, r, g, b, a) \
+    uint8_t* r = args.ch_r; \
+    uint8_t* g = args.ch_g; \
+    uint8_t* b = args.ch_b; \
+    uint8_t* a = args.ch_a; \
+    DEBUG_ASSERT_RGBA_ALIGNED(r, g, b, a)
+
+#define BIND_CHANNELS_RGBA_CONST(args, r, g, b, a) \
+    const uint8_t* r = args.ch_r; \
+    const uint8_t* g = args.ch_g; \
+    const uint8_t* b = args.ch_b; \
+    const uint8_t* a = args.ch_a; \
+    DEBUG_ASSERT_RGBA_ALIGNED(r, g, b, a)
+
+#define BIND_CHANNELS_RGB_CONST(args, r, g, b) \
+    const uint8_t* r = args.ch_r; \
+    const uint8_t* g = args.ch_g; \
+    const uint8_t* b = args.ch_b; \
+    DEBUG_ASSERT_RGB_ALIGNED(r, g, b)
+
+// Planes are cache line aligned, interleaved buffers only guarantee LIEN_DEFAULT_ALIGNMENT
+#define LOAD_SI512_CONST(addr) \
+    _mm512_load_si512(reinterpret_cast<const void*>(addr));
+
+#define LOADU_SI512_CONST(addr) \
+    _mm512_loadu_si512(reinterpret_cast<const void*>(addr));
+
+#define STORE_SI512(addr, v) \
+    _mm512_store_si512(reinterpret_cast<void*>(addr), v);
+
+#define STOREU_SI512(addr, v) \
+    _mm512_storeu_si512(reinterpret_cast<void*>(addr), v);
+
+// Byte ops handle the tail with masked loads/stores instead of a scalar loop
+#define TAIL_MASK_U8(count) \
+    ((__mmask64(1) << (count)) - 1)
+
+#define MASKZ_LOAD_U8(mask, addr) \
+    _mm512_maskz_loadu_epi8(mask, reinterpret_cast<const void*>(addr));
+
+#define MASK_STORE_U8(addr, mask, v) \
+    _mm512_mask_storeu_epi8(reinterpret_cast<void*>(addr), mask, v);
+
+namespace ien::image_ops::_internal
+{
+    const uint32_t trunc_and_table[8] = {
+        0xFFFFFFFF, 0xFEFEFEFE, 0xFCFCFCFC, 0xF8F8F8F8,
+        0xF0F0F0F0, 0xE0E0E0E0, 0xC0C0C0C0, 0x80808080
+    };
+
+    struct vec4x16xf32
+    {
+        __m512 data[4];
+    };
+
+    vec4x16xf32 extract_4x16xf32_from_64xu8(__m512i v)
+    {
+        return {{
+            _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(v, 0))),
+            _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(v, 1))),
+            _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(v, 2))),
+            _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(v, 3)))
+        }};
+    }
+
+    void truncate_channel_data_avx512(const truncate_channel_args& args)
+    {
+        const size_t img_sz = args.len;
+
+        BIND_CHANNELS(args, r, g, b, a);
+
+        const __m512i vmask_r = _mm512_set1_epi8(static_cast<char>(trunc_and_table[args.bits_r]));
+        const __m512i vmask_g = _mm512_set1_epi8(static_cast<char>(trunc_and_table[args.bits_g]));
+        const __m512i vmask_b = _mm512_set1_epi8(static_cast<char>(trunc_and_table[args.bits_b]));
+        const __m512i vmask_a = _mm512_set1_epi8(static_cast<char>(trunc_and_table[args.bits_a]));
+
+        size_t last_v_idx = img_sz - (img_sz % AVX512_ALIGNMENT);
+        for (size_t i = 0; i < last_v_idx; i += AVX512_ALIGNMENT)
+        {
+            __m512i seg_r = LOAD_SI512_CONST(r + i);
+            __m512i seg_g = LOAD_SI512_CONST(g + i);
+            __m512i seg_b = LOAD_SI512_CONST(b + i);
+            __m512i seg_a = LOAD_SI512_CONST(a + i);
+
+            STORE_SI512(r + i, _mm512_and_si512(seg_r, vmask_r));
+            STORE_SI512(g + i, _mm512_and_si512(seg_g, vmask_g));
+            STORE_SI512(b + i, _mm512_and_si512(seg_b, vmask_b));
+            STORE_SI512(a + i, _mm512_and_si512(seg_a, vmask_a));
+        }
+
+        if (last_v_idx < img_sz)
+        {
+            const __mmask64 tail = TAIL_MASK_U8(img_sz - last_v_idx);
+            const size_t i = last_v_idx;
+
+            __m512i seg_r = MASKZ_LOAD_U8(tail, r + i);
+            __m512i seg_g = MASKZ_LOAD_U8(tail, g + i);
+            __m512i seg_b = MASKZ_LOAD_U8(tail, b + i);
+            __m512i seg_a = MASKZ_LOAD_U8(tail, a + i);
+
+            MASK_STORE_U8(r + i, tail, _mm512_and_si512(seg_r, vmask_r));
+            MASK_STORE_U8(g + i, tail, _mm512_and_si512(seg_g, vmask_g));
+            MASK_STORE_U8(b + i, tail, _mm512_and_si512(seg_b, vmask_b));
+            MASK_STORE_U8(a + i, tail, _mm512_and_si512(seg_a, vmask_a));
+        }
+    }
+
+    // Shared loop for the 4-channel byte ops, 'op' maps four channel vectors to the result vector
+    template<typename TOp>
+    void rgba_u8_op_avx512(const channel_info_extract_args_rgba& args, uint8_t* out, TOp op)
+    {
+        const size_t img_sz = args.len;
+
+        BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
+
+        size_t last_v_idx = img_sz - (img_sz % AVX512_ALIGNMENT);
+        for (size_t i = 0; i < last_v_idx; i += AVX512_ALIGNMENT)
+        {
+            __m512i vseg_r = LOAD_SI512_CONST(r + i);
+            __m512i vseg_g = LOAD_SI512_CONST(g + i);
+            __m512i vseg_b = LOAD_SI512_CONST(b + i);
+            __m512i vseg_a = LOAD_SI512_CONST(a + i);
+
+            STOREU_SI512(out + i, op(vseg_r, vseg_g, vseg_b, vseg_a));
+        }
+
+        if (last_v_idx < img_sz)
+        {
+            const __mmask64 tail = TAIL_MASK_U8(img_sz - last_v_idx);
+            const size_t i = last_v_idx;
+
+            __m512i vseg_r = MASKZ_LOAD_U8(tail, r + i);
+            __m512i vseg_g = MASKZ_LOAD_U8(tail, g + i);
+            __m512i vseg_b = MASKZ_LOAD_U8(tail, b + i);
+            __m512i vseg_a = MASKZ_LOAD_U8(tail, a + i);
+
+            MASK_STORE_U8(out + i, tail, op(vseg_r, vseg_g, vseg_b, vseg_a));
+        }
+    }
+
+    template<typename TOp>
+    void rgb_u8_op_avx512(const channel_info_extract_args_rgb& args, uint8_t* out, TOp op)
+    {
+        const size_t img_sz = args.len;
+
+        BIND_CHANNELS_RGB_CONST(args, r, g, b);
+
+        size_t last_v_idx = img_sz - (img_sz % AVX512_ALIGNMENT);
+        for (size_t i = 0; i < last_v_idx; i += AVX512_ALIGNMENT)
+        {
+            __m512i vseg_r = LOAD_SI512_CONST(r + i);
+            __m512i vseg_g = LOAD_SI512_CONST(g + i);
+            __m512i vseg_b = LOAD_SI512_CONST(b + i);
+
+            STOREU_SI512(out + i, op(vseg_r, vseg_g, vseg_b));
+        }
+
+        if (last_v_idx < img_sz)
+        {
+            const __mmask64 tail = TAIL_MASK_U8(img_sz - last_v_idx);
+            const size_t i = last_v_idx;
+
+            __m512i vseg_r = MASKZ_LOAD_U8(tail, r + i);
+            __m512i vseg_g = MASKZ_LOAD_U8(tail, g + i);
+            __m512i vseg_b = MASKZ_LOAD_U8(tail, b + i);
+
+            MASK_STORE_U8(out + i, tail, op(vseg_r, vseg_g, vseg_b));
+        }
+    }
+
+    void rgba_average_avx512(const channel_info_extract_args_rgba& args, uint8_t* out)
+    {
+        const __m512i vzero = _mm512_setzero_si512();
+
+        return rgba_u8_op_avx512(args, out, [&](__m512i vr, __m512i vg, __m512i vb, __m512i va)
+        {
+            // Exact floor((r + g + b + a) / 4) on 16 bit sums, unpack and pack are per 128 bit lane
+            __m512i vsum_lo = _mm512_add_epi16(
+                _mm512_add_epi16(_mm512_unpacklo_epi8(vr, vzero), _mm512_unpacklo_epi8(vg, vzero)),
+                _mm512_add_epi16(_mm512_unpacklo_epi8(vb, vzero), _mm512_unpacklo_epi8(va, vzero))
+            );
+            __m512i vsum_hi = _mm512_add_epi16(
+                _mm512_add_epi16(_mm512_unpackhi_epi8(vr, vzero), _mm512_unpackhi_epi8(vg, vzero)),
+                _mm512_add_epi16(_mm512_unpackhi_epi8(vb, vzero), _mm512_unpackhi_epi8(va, vzero))
+            );
+
+            return _mm512_packus_epi16(_mm512_srli_epi16(vsum_lo, 2), _mm512_srli_epi16(vsum_hi, 2));
+        });
+    }
+
+    void rgba_max_avx512(const channel_info_extract_args_rgba& args, uint8_t* out)
+    {
+        return rgba_u8_op_avx512(args, out, [](__m512i vr, __m512i vg, __m512i vb, __m512i va)
+        {
+            return _mm512_max_epu8(_mm512_max_epu8(vr, vg), _mm512_max_epu8(vb, va));
+        });
+    }
+
+    void rgba_min_avx512(const channel_info_extract_args_rgba& args, uint8_t* out)
+    {
+        return rgba_u8_op_avx512(args, out, [](__m512i vr, __m512i vg, __m512i vb, __m512i va)
+        {
+            return _mm512_min_epu8(_mm512_min_epu8(vr, vg), _mm512_min_epu8(vb, va));
+        });
+    }
+
+    void rgb_average_avx512(const channel_info_extract_args_rgb& args, float* out)
+    {
+        const size_t img_sz = args.len;
+
+        if (img_sz < AVX512_ALIGNMENT)
+        {
+            return rgb_average_std(args, out);
+        }
+
+        BIND_CHANNELS_RGB_CONST(args, r, g, b);
+
+        const __m512 vmul_div3 = _mm512_set1_ps(0.333334F);
+
+        size_t last_v_idx = img_sz - (img_sz % AVX512_ALIGNMENT);
+        for (size_t i = 0; i < last_v_idx; i += AVX512_ALIGNMENT)
+        {
+            __m512i vseg_r = LOAD_SI512_CONST(r + i);
+            __m512i vseg_g = LOAD_SI512_CONST(g + i);
+            __m512i vseg_b = LOAD_SI512_CONST(b + i);
+
+            vec4x16xf32 vlr = extract_4x16xf32_from_64xu8(vseg_r);
+            vec4x16xf32 vlg = extract_4x16xf32_from_64xu8(vseg_g);
+            vec4x16xf32 vlb = extract_4x16xf32_from_64xu8(vseg_b);
+
+            for (size_t vidx = 0; vidx < 4; ++vidx)
+            {
+                __m512 sum = _mm512_add_ps(_mm512_add_ps(vlr.data[vidx], vlg.data[vidx]), vlb.data[vidx]);
+                _mm512_storeu_ps(out + i + (vidx * 16), _mm512_mul_ps(sum, vmul_div3));
+            }
+        }
+
+        for (size_t i = last_v_idx; i < img_sz; ++i)
+        {
+            out[i] = tier_average(r[i], g[i], b[i]);
+        }
+    }
+
+    void rgb_max_avx512(const channel_info_extract_args_rgb& args, uint8_t* out)
+    {
+        return rgb_u8_op_avx512(args, out, [](__m512i vr, __m512i vg, __m512i vb)
+        {
+            return _mm512_max_epu8(_mm512_max_epu8(vr, vg), vb);
+        });
+    }
+
+    void rgb_min_avx512(const channel_info_extract_args_rgb& args, uint8_t* out)
+    {
+        return rgb_u8_op_avx512(args, out, [](__m512i vr, __m512i vg, __m512i vb)
+        {
+            return _mm512_min_epu8(_mm512_min_epu8(vr, vg), vb);
+        });
+    }
+
+    void rgba_sum_saturated_avx512(const channel_info_extract_args_rgba& args, uint8_t* out)
+    {
+        return rgba_u8_op_avx512(args, out, [](__m512i vr, __m512i vg, __m512i vb, __m512i va)
+        {
+            return _mm512_adds_epu8(_mm512_adds_epu8(vr, vg), _mm512_adds_epu8(vb, va));
+        });
+    }
+
+    void rgb_saturation_avx512(const channel_info_extract_args_rgb& args, float* out)
+    {
+        const size_t img_sz = args.len;
+
+        if (img_sz < AVX512_ALIGNMENT)
+        {
+            return rgb_saturation_std(args, out);
+        }
+
+        BIND_CHANNELS_RGB_CONST(args, r, g, b);
+
+        size_t last_v_idx = img_sz - (img_sz % AVX512_ALIGNMENT);
+        for (size_t i = 0; i < last_v_idx; i += AVX512_ALIGNMENT)
+        {
+            __m512i vseg_r = LOAD_SI512_CONST(r + i);
+            __m512i vseg_g = LOAD_SI512_CONST(g + i);
+            __m512i vseg_b = LOAD_SI512_CONST(b + i);
+
+            __m512i vmax_rgb = _mm512_max_epu8(_mm512_max_epu8(vseg_r, vseg_g), vseg_b);
+            __m512i vmin_rgb = _mm512_min_epu8(_mm512_min_epu8(vseg_r, vseg_g), vseg_b);
+
+            vec4x16xf32 vfmax = extract_4x16xf32_from_64xu8(vmax_rgb);
+            vec4x16xf32 vfmin = extract_4x16xf32_from_64xu8(vmin_rgb);
+
+            for (size_t vidx = 0; vidx < 4; ++vidx)
+            {
+                __m512 vsat = _mm512_div_ps(_mm512_sub_ps(vfmax.data[vidx], vfmin.data[vidx]), vfmax.data[vidx]);
+                _mm512_storeu_ps(out + i + (vidx * 16), vsat);
+            }
+        }
+
+        for (size_t i = last_v_idx; i < img_sz; ++i)
+        {
+            float vmax = static_cast<float>(tier_max(r[i], g[i], b[i])) / 255.0F;
+            float vmin = static_cast<float>(tier_min(r[i], g[i], b[i])) / 255.0F;
+            out[i] = (vmax - vmin) / vmax;
+        }
+    }
+
+    void rgb_luminance_avx512(const channel_info_extract_args_rgb& args, float* out)
+    {
+        const size_t img_sz = args.len;
+
+        if (img_sz < AVX512_ALIGNMENT)
+        {
+            return rgb_luminance_std(args, out);
+        }
+
+        BIND_CHANNELS_RGB_CONST(args, r, g, b);
+
+        const __m512 vlum_mul_r = _mm512_set1_ps(0.2126F / 255);
+        const __m512 vlum_mul_g = _mm512_set1_ps(0.7152F / 255);
+        const __m512 vlum_mul_b = _mm512_set1_ps(0.0722F / 255);
+
+        size_t last_v_idx = img_sz - (img_sz % AVX512_ALIGNMENT);
+        for (size_t i = 0; i < last_v_idx; i += AVX512_ALIGNMENT)
+        {
+            __m512i vseg_r = LOAD_SI512_CONST(r + i);
+            __m512i vseg_g = LOAD_SI512_CONST(g + i);
+            __m512i vseg_b = LOAD_SI512_CONST(b + i);
+
+            vec4x16xf32 vfr = extract_4x16xf32_from_64xu8(vseg_r);
+            vec4x16xf32 vfg = extract_4x16xf32_from_64xu8(vseg_g);
+            vec4x16xf32 vfb = extract_4x16xf32_from_64xu8(vseg_b);
+
+            for (size_t vidx = 0; vidx < 4; ++vidx)
+            {
+                __m512 vlum = _mm512_mul_ps(vfr.data[vidx], vlum_mul_r);
+                vlum = _mm512_fmadd_ps(vfg.data[vidx], vlum_mul_g, vlum);
+                vlum = _mm512_fmadd_ps(vfb.data[vidx], vlum_mul_b, vlum);
+                _mm512_storeu_ps(out + i + (vidx * 16), vlum);
+            }
+        }
+
+        for (size_t i = last_v_idx; i < img_sz; ++i)
+        {
+            out[i] = (r[i] * 0.2126F / 255) + (g[i] * 0.7152F / 255) + (b[i] * 0.0722F / 255);
+        }
+    }
+
+    void rgb_metrics_avx512(const rgb_metrics_args& args)
+    {
+        const size_t img_sz = args.len;
+
+        if (img_sz < AVX512_ALIGNMENT)
+        {
+            return rgb_metrics_avx2(args);
+        }
+
+        BIND_CHANNELS_RGB_CONST(args, r, g, b);
+
+        const __m512 vlum_mul_r = _mm512_set1_ps(0.2126F / 255);
+        const __m512 vlum_mul_g = _mm512_set1_ps(0.7152F / 255);
+        const __m512 vlum_mul_b = _mm512_set1_ps(0.0722F / 255);
+        const __m512 vmul_div3 = _mm512_set1_ps(0.333334F);
+
+        const bool need_channels_f32 = args.luminance || args.average;
+
+        size_t last_v_idx = img_sz - (img_sz % AVX512_ALIGNMENT);
+        for (size_t i = 0; i < last_v_idx; i += AVX512_ALIGNMENT)
+        {
+            __m512i vseg_r = LOAD_SI512_CONST(r + i);
+            __m512i vseg_g = LOAD_SI512_CONST(g + i);
+            __m512i vseg_b = LOAD_SI512_CONST(b + i);
+
+            __m512i vmax_rgb = _mm512_max_epu8(_mm512_max_epu8(vseg_r, vseg_g), vseg_b);
+            __m512i vmin_rgb = _mm512_min_epu8(_mm512_min_epu8(vseg_r, vseg_g), vseg_b);
+
+            if (args.max) { STOREU_SI512(args.max + i, vmax_rgb); }
+            if (args.min) { STOREU_SI512(args.min + i, vmin_rgb); }
+
+            if (need_channels_f32)
+            {
+                vec4x16xf32 vfr = extract_4x16xf32_from_64xu8(vseg_r);
+                vec4x16xf32 vfg = extract_4x16xf32_from_64xu8(vseg_g);
+                vec4x16xf32 vfb = extract_4x16xf32_from_64xu8(vseg_b);
+
+                for (size_t vidx = 0; vidx < 4; ++vidx)
+                {
+                    if (args.luminance)
+                    {
+                        __m512 vlum = _mm512_mul_ps(vfr.data[vidx], vlum_mul_r);
+                        vlum = _mm512_fmadd_ps(vfg.data[vidx], vlum_mul_g, vlum);
+                        vlum = _mm512_fmadd_ps(vfb.data[vidx], vlum_mul_b, vlum);
+                        _mm512_storeu_ps(args.luminance + i + (vidx * 16), vlum);
+                    }
+                    if (args.average)
+                    {
+                        __m512 vsum = _mm512_add_ps(_mm512_add_ps(vfr.data[vidx], vfg.data[vidx]), vfb.data[vidx]);
+                        _mm512_storeu_ps(args.average + i + (vidx * 16), _mm512_mul_ps(vsum, vmul_div3));
+                    }
+                }
+            }
+
+            if (args.saturation)
+            {
+                vec4x16xf32 vfmax = extract_4x16xf32_from_64xu8(vmax_rgb);
+                vec4x16xf32 vfmin = extract_4x16xf32_from_64xu8(vmin_rgb);
+
+                for (size_t vidx = 0; vidx < 4; ++vidx)
+                {
+                    __m512 vsat = _mm512_div_ps(_mm512_sub_ps(vfmax.data[vidx], vfmin.data[vidx]), vfmax.data[vidx]);
+                    _mm512_storeu_ps(args.saturation + i + (vidx * 16), vsat);
+                }
+            }
+        }
+
+        rgb_metrics_std(args.subrange(last_v_idx, img_sz - last_v_idx));
+    }
+
+    void unpack_image_data_avx512(const uint8_t* data, size_t len, image_planar_data& out)
+    {
+        if (len < (AVX512_ALIGNMENT * 4))
+        {
+            return unpack_image_data_avx2(data, len, out);
+        }
+
+        uint8_t* r = out.data_r();
+        uint8_t* g = out.data_g();
+        uint8_t* b = out.data_b();
+        uint8_t* a = out.data_a();
+
+        // Per 128-bit lane: rgba x4 -> rrrr gggg bbbb aaaa
+        const __m512i vshufmask = _mm512_broadcast_i32x4(_mm_setr_epi8(
+            0, 4, 8, 12,
+            1, 5, 9, 13,
+            2, 6, 10, 14,
+            3, 7, 11, 15
+        ));
+
+        // Gathers every lane's channel dwords, so lane 0 holds R, lane 1 G, lane 2 B, lane 3 A
+        const __m512i vlanemask = _mm512_setr_epi32(
+            0, 4, 8, 12,
+            1, 5, 9, 13,
+            2, 6, 10, 14,
+            3, 7, 11, 15
+        );
+
+        size_t last_v_idx = len - (len % (AVX512_ALIGNMENT * 4));
+        for (size_t i = 0; i < last_v_idx; i += AVX512_ALIGNMENT * 4)
+        {
+            __m512i v0 = LOADU_SI512_CONST(data + i + (AVX512_ALIGNMENT * 0));
+            __m512i v1 = LOADU_SI512_CONST(data + i + (AVX512_ALIGNMENT * 1));
+            __m512i v2 = LOADU_SI512_CONST(data + i + (AVX512_ALIGNMENT * 2));
+            __m512i v3 = LOADU_SI512_CONST(data + i + (AVX512_ALIGNMENT * 3));
+
+            v0 = _mm512_permutexvar_epi32(vlanemask, _mm512_shuffle_epi8(v0, vshufmask));
+            v1 = _mm512_permutexvar_epi32(vlanemask, _mm512_shuffle_epi8(v1, vshufmask));
+            v2 = _mm512_permutexvar_epi32(vlanemask, _mm512_shuffle_epi8(v2, vshufmask));
+            v3 = _mm512_permutexvar_epi32(vlanemask, _mm512_shuffle_epi8(v3, vshufmask));
+
+            __m512i v_r0g0r1g1 = _mm512_shuffle_i32x4(v0, v1, _MM_SHUFFLE(1, 0, 1, 0));
+            __m512i v_r2g2r3g3 = _mm512_shuffle_i32x4(v2, v3, _MM_SHUFFLE(1, 0, 1, 0));
+            __m512i v_b0a0b1a1 = _mm512_shuffle_i32x4(v0, v1, _MM_SHUFFLE(3, 2, 3, 2));
+            __m512i v_b2a2b3a3 = _mm512_shuffle_i32x4(v2, v3, _MM_SHUFFLE(3, 2, 3, 2));
+
+            STORE_SI512(r + (i / 4), _mm512_shuffle_i32x4(v_r0g0r1g1, v_r2g2r3g3, _MM_SHUFFLE(2, 0, 2, 0)));
+            STORE_SI512(g + (i / 4), _mm512_shuffle_i32x4(v_r0g0r1g1, v_r2g2r3g3, _MM_SHUFFLE(3, 1, 3, 1)));
+            STORE_SI512(b + (i / 4), _mm512_shuffle_i32x4(v_b0a0b1a1, v_b2a2b3a3, _MM_SHUFFLE(2, 0, 2, 0)));
+            STORE_SI512(a + (i / 4), _mm512_shuffle_i32x4(v_b0a0b1a1, v_b2a2b3a3, _MM_SHUFFLE(3, 1, 3, 1)));
+        }
+
+        for (size_t i = last_v_idx; i < len; i += 4)
+        {
+            r[i / 4] = data[i + 0];
+            g[i / 4] = data[i + 1];
+            b[i / 4] = data[i + 2];
+            a[i / 4] = data[i + 3];
+        }
+    }
+
+    void pack_image_data_avx512(const channel_info_extract_args_rgba& args, uint8_t* out)
+    {
+        const size_t len = args.len;
+        if (len < AVX512_ALIGNMENT)
+        {
+            return pack_image_data_avx2(args, out);
+        }
+
+        BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
+
+        size_t last_v_idx = len - (len % AVX512_ALIGNMENT);
+        for (size_t i = 0; i < last_v_idx; i += AVX512_ALIGNMENT)
+        {
+            __m512i vr = LOAD_SI512_CONST(r + i);
+            __m512i vg = LOAD_SI512_CONST(g + i);
+            __m512i vb = LOAD_SI512_CONST(b + i);
+            __m512i va = LOAD_SI512_CONST(a + i);
+
+            __m512i v_rg_lo = _mm512_unpacklo_epi8(vr, vg);
+            __m512i v_rg_hi = _mm512_unpackhi_epi8(vr, vg);
+            __m512i v_ba_lo = _mm512_unpacklo_epi8(vb, va);
+            __m512i v_ba_hi = _mm512_unpackhi_epi8(vb, va);
+
+            // Lane n of pN holds pixels (16 * n) + (4 * N) to (16 * n) + (4 * N) + 3
+            __m512i p0 = _mm512_unpacklo_epi16(v_rg_lo, v_ba_lo);
+            __m512i p1 = _mm512_unpackhi_epi16(v_rg_lo, v_ba_lo);
+            __m512i p2 = _mm512_unpacklo_epi16(v_rg_hi, v_ba_hi);
+            __m512i p3 = _mm512_unpackhi_epi16(v_rg_hi, v_ba_hi);
+
+            __m512i t0 = _mm512_shuffle_i32x4(p0, p1, _MM_SHUFFLE(1, 0, 1, 0));
+            __m512i t1 = _mm512_shuffle_i32x4(p2, p3, _MM_SHUFFLE(1, 0, 1, 0));
+            __m512i t2 = _mm512_shuffle_i32x4(p0, p1, _MM_SHUFFLE(3, 2, 3, 2));
+            __m512i t3 = _mm512_shuffle_i32x4(p2, p3, _MM_SHUFFLE(3, 2, 3, 2));
+
+            uint8_t* dst = out + (i * 4);
+            STOREU_SI512(dst + (AVX512_ALIGNMENT * 0), _mm512_shuffle_i32x4(t0, t1, _MM_SHUFFLE(2, 0, 2, 0)));
+            STOREU_SI512(dst + (AVX512_ALIGNMENT * 1), _mm512_shuffle_i32x4(t0, t1, _MM_SHUFFLE(3, 1, 3, 1)));
+            STOREU_SI512(dst + (AVX512_ALIGNMENT * 2), _mm512_shuffle_i32x4(t2, t3, _MM_SHUFFLE(2, 0, 2, 0)));
+            STOREU_SI512(dst + (AVX512_ALIGNMENT * 3), _mm512_shuffle_i32x4(t2, t3, _MM_SHUFFLE(3, 1, 3, 1)));
+        }
+
+        for (size_t i = last_v_idx; i < len; ++i)
+        {
+            out[(i * 4) + 0] = r[i];
+            out[(i * 4) + 1] = g[i];
+            out[(i * 4) + 2] = b[i];
+            out[(i * 4) + 3] = a[i];
+        }
+    }
+
+    void channel_compare_avx512(const channel_compare_args& args, uint8_t* out)
+    {
+        const size_t len = args.len;
+
+        const __m512i vthreshold = _mm512_set1_epi8(static_cast<char>(args.threshold));
+
+        size_t last_v_idx = len - (len % AVX512_ALIGNMENT);
+        for (size_t i = 0; i < last_v_idx; i += AVX512_ALIGNMENT)
+        {
+            __m512i vseg = LOAD_SI512_CONST(args.ch + i);
+            __mmask64 vcmp = _mm512_cmpge_epu8_mask(vseg, vthreshold);
+            STOREU_SI512(out + i, _mm512_movm_epi8(vcmp));
+        }
+
+        if (last_v_idx < len)
+        {
+            const __mmask64 tail = TAIL_MASK_U8(len - last_v_idx);
+            __m512i vseg = MASKZ_LOAD_U8(tail, args.ch + last_v_idx);
+            __mmask64 vcmp = _mm512_cmpge_epu8_mask(vseg, vthreshold);
+            MASK_STORE_U8(out + last_v_idx, tail, _mm512_movm_epi8(vcmp));
+        }
+    }
+
+    // The 32-bit square accumulators grow by at most 4 * 255^2 per iteration,
+    // they are widened to 64 bits well before they could overflow
+    const size_t REDUCE_FLUSH_INTERVAL = 8192;
+
+    // Byte wise horizontal min/max by folding halves
+    static inline uint8_t horizontal_min_epu8(__m512i vz)
+    {
+        __m256i vw = _mm256_min_epu8(_mm512_castsi512_si256(vz), _mm512_extracti64x4_epi64(vz, 1));
+        __m128i v = _mm_min_epu8(_mm256_castsi256_si128(vw), _mm256_extracti128_si256(vw, 1));
+        v = _mm_min_epu8(v, _mm_srli_si128(v, 8));
+        v = _mm_min_epu8(v, _mm_srli_si128(v, 4));
+        v = _mm_min_epu8(v, _mm_srli_si128(v, 2));
+        v = _mm_min_epu8(v, _mm_srli_si128(v, 1));
+        return static_cast<uint8_t>(_mm_cvtsi128_si32(v));
+    }
+
+    static inline uint8_t horizontal_max_epu8(__m512i vz)
+    {
+        __m256i vw = _mm256_max_epu8(_mm512_castsi512_si256(vz), _mm512_extracti64x4_epi64(vz, 1));
+        __m128i v = _mm_max_epu8(_mm256_castsi256_si128(vw), _mm256_extracti128_si256(vw, 1));
+        v = _mm_max_epu8(v, _mm_srli_si128(v, 8));
+        v = _mm_max_epu8(v, _mm_srli_si128(v, 4));
+        v = _mm_max_epu8(v, _mm_srli_si128(v, 2));
+        v = _mm_max_epu8(v, _mm_srli_si128(v, 1));
+        return static_cast<uint8_t>(_mm_cvtsi128_si32(v));
+    }
+
+    static void reduce_channel_avx512(const uint8_t* data, size_t len, rgba_reduction& out, size_t ch)
+    {
+        const __m512i vzero = _mm512_setzero_si512();
+        __m512i vsum = vzero;
+        __m512i vsum_sq = vzero;
+        __m512i vsum_sq32 = vzero;
+        __m512i vmin = _mm512_set1_epi8(static_cast<char>(0xFF));
+        __m512i vmax = vzero;
+
+        auto accumulate = [&](__m512i vseg)
+        {
+            vsum = _mm512_add_epi64(vsum, _mm512_sad_epu8(vseg, vzero));
+
+            __m512i vlo = _mm512_unpacklo_epi8(vseg, vzero);
+            __m512i vhi = _mm512_unpackhi_epi8(vseg, vzero);
+            vsum_sq32 = _mm512_add_epi32(vsum_sq32, _mm512_add_epi32(_mm512_madd_epi16(vlo, vlo), _mm512_madd_epi16(vhi, vhi)));
+        };
+
+        auto flush = [&]()
+        {
+            vsum_sq = _mm512_add_epi64(vsum_sq, _mm512_unpacklo_epi32(vsum_sq32, vzero));
+            vsum_sq = _mm512_add_epi64(vsum_sq, _mm512_unpackhi_epi32(vsum_sq32, vzero));
+            vsum_sq32 = vzero;
+        };
+
+        size_t last_v_idx = len - (len % AVX512_ALIGNMENT);
+        size_t flush_count = 0;
+        for (size_t i = 0; i < last_v_idx; i += AVX512_ALIGNMENT)
+        {
+            __m512i vseg = LOAD_SI512_CONST(data + i);
+            accumulate(vseg);
+            vmin = _mm512_min_epu8(vmin, vseg);
+            vmax = _mm512_max_epu8(vmax, vseg);
+
+            if (++flush_count == REDUCE_FLUSH_INTERVAL)
+            {
+                flush();
+                flush_count = 0;
+            }
+        }
+
+        // Zeroed tail lanes don't change the sums, min/max only look at the valid ones
+        if (last_v_idx < len)
+        {
+            const __mmask64 tail = TAIL_MASK_U8(len - last_v_idx);
+            __m512i vseg = MASKZ_LOAD_U8(tail, data + last_v_idx);
+            accumulate(vseg);
+            vmin = _mm512_mask_min_epu8(vmin, tail, vmin, vseg);
+            vmax = _mm512_mask_max_epu8(vmax, tail, vmax, vseg);
+        }
+        flush();
+
+        out.sum[ch] = static_cast<uint64_t>(_mm512_reduce_add_epi64(vsum));
+        out.sum_sq[ch] = static_cast<uint64_t>(_mm512_reduce_add_epi64(vsum_sq));
+        out.min[ch] = horizontal_min_epu8(vmin);
+        out.max[ch] = horizontal_max_epu8(vmax);
+    }
+
+    void rgba_reduce_avx512(const channel_info_extract_args_rgba& args, rgba_reduction& out)
+    {
+        BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
+
+        reduce_channel_avx512(r, args.len, out, 0);
+        reduce_channel_avx512(g, args.len, out, 1);
+        reduce_channel_avx512(b, args.len, out, 2);
+        reduce_channel_avx512(a, args.len, out, 3);
+    }
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,171 @@
+#include <ien/internal/x86/image_ops_x86.hpp>
+
+#include <ien/platform.hpp>
+
+#if defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)
+#include <ien/internal/image_ops_args.hpp>
+#include <ien/internal/x86/tier_scalar.hpp>
+
+#include <cstring>
+#include <immintrin.h>
+
+#define AVX_ALIGNMENT 32
+
+#define DEBUG_ASSERT_RGBA_ALIGNED(r, g, b, a) \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(r, AVX_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(g, AVX_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(b, AVX_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(a, AVX_ALIGNMENT))
+
+#define LOAD_SI256_CONST(addr) \
+    _mm256_load_si256(reinterpret_cast<const __m256i*>(addr))
+
+#define STORE_SI256(addr, v) \
+    _mm256_store_si256(reinterpret_cast<__m256i*>(addr), v)
+
+namespace ien::image_ops::_internal
+{
+    // Pixels per block, one AVX2 register per plane
+    const size_t LSB_BLOCK = 32;
+
+    // (plane & ~mask) | bits
+    static inline __m256i merge_low_bits(__m256i plane, __m256i bits, uint8_t mask)
+    {
+        return _mm256_or_si256(_mm256_andnot_si256(_mm256_set1_epi8(static_cast<char>(mask)), plane), bits);
+    }
+
+    // PDEP spreads the bits of every pixel over its packed RGBA low bits, which are then
+    // deinterleaved into planes 32 pixels at a time
+    size_t lsb_embed_blocks_avx2_bmi2(const lsb_embed_args& args, size_t pixel_bits, uint32_t mask)
+    {
+        // Every pixel loads 8 payload bytes from its first bit, those loads must stay within the payload
+        size_t vec_len = 0;
+        if (args.payload_len >= 8)
+        {
+            vec_len = ((((args.payload_len - 8) * 8) + 7) / pixel_bits) + 1;
+            vec_len = (vec_len < args.len) ? vec_len : args.len;
+            vec_len -= vec_len % LSB_BLOCK;
+        }
+
+        uint8_t* r = args.ch_r;
+        uint8_t* g = args.ch_g;
+        uint8_t* b = args.ch_b;
+        uint8_t* a = args.ch_a;
+        DEBUG_ASSERT_RGBA_ALIGNED(r, g, b, a);
+
+        // Groups the bytes of every channel within each 128-bit lane
+        const __m256i vshufmask = _mm256_setr_epi8(
+            0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+            0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15
+        );
+        const __m256i vgroupmask = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+        alignas(AVX_ALIGNMENT) uint32_t block[LSB_BLOCK];
+        size_t bit_pos = 0;
+        for (size_t i = 0; i < vec_len; i += LSB_BLOCK)
+        {
+            for (size_t j = 0; j < LSB_BLOCK; ++j, bit_pos += pixel_bits)
+            {
+                uint64_t word;
+                std::memcpy(&word, args.payload + (bit_pos / 8), sizeof(word));
+                block[j] = _pdep_u32(static_cast<uint32_t>(word >> (bit_pos % 8)), mask);
+            }
+
+            // Each vector becomes [R x8, G x8, B x8, A x8] for its 8 pixels
+            __m256i v0 = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(LOAD_SI256_CONST(block + 0), vshufmask), vgroupmask);
+            __m256i v1 = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(LOAD_SI256_CONST(block + 8), vshufmask), vgroupmask);
+            __m256i v2 = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(LOAD_SI256_CONST(block + 16), vshufmask), vgroupmask);
+            __m256i v3 = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(LOAD_SI256_CONST(block + 24), vshufmask), vgroupmask);
+
+            // Lane 0: R/G, lane 1: B/A
+            __m256i rb01 = _mm256_unpacklo_epi64(v0, v1);
+            __m256i ga01 = _mm256_unpackhi_epi64(v0, v1);
+            __m256i rb23 = _mm256_unpacklo_epi64(v2, v3);
+            __m256i ga23 = _mm256_unpackhi_epi64(v2, v3);
+
+            __m256i bits_r = _mm256_permute2x128_si256(rb01, rb23, 0x20);
+            __m256i bits_b = _mm256_permute2x128_si256(rb01, rb23, 0x31);
+            __m256i bits_g = _mm256_permute2x128_si256(ga01, ga23, 0x20);
+            __m256i bits_a = _mm256_permute2x128_si256(ga01, ga23, 0x31);
+
+            STORE_SI256(r + i, merge_low_bits(LOAD_SI256_CONST(r + i), bits_r, static_cast<uint8_t>(mask)));
+            STORE_SI256(g + i, merge_low_bits(LOAD_SI256_CONST(g + i), bits_g, static_cast<uint8_t>(mask >> 8)));
+            STORE_SI256(b + i, merge_low_bits(LOAD_SI256_CONST(b + i), bits_b, static_cast<uint8_t>(mask >> 16)));
+            STORE_SI256(a + i, merge_low_bits(LOAD_SI256_CONST(a + i), bits_a, static_cast<uint8_t>(mask >> 24)));
+        }
+
+        return vec_len;
+    }
+
+    // Planes are interleaved into packed RGBA low bits 32 pixels at a time, PEXT then gathers the bits of every pixel
+    size_t lsb_extract_blocks_avx2_bmi2(const lsb_extract_args& args, size_t pixel_bits, uint32_t mask)
+    {
+        // Whole blocks whose bits fit in the payload
+        size_t vec_len = (args.payload_len * 8) / pixel_bits;
+        vec_len = (vec_len < args.len) ? vec_len : args.len;
+        vec_len -= vec_len % LSB_BLOCK;
+
+        const uint8_t* r = args.ch_r;
+        const uint8_t* g = args.ch_g;
+        const uint8_t* b = args.ch_b;
+        const uint8_t* a = args.ch_a;
+        DEBUG_ASSERT_RGBA_ALIGNED(r, g, b, a);
+
+        const __m256i vmask_r = _mm256_set1_epi8(static_cast<char>(mask));
+        const __m256i vmask_g = _mm256_set1_epi8(static_cast<char>(mask >> 8));
+        const __m256i vmask_b = _mm256_set1_epi8(static_cast<char>(mask >> 16));
+        const __m256i vmask_a = _mm256_set1_epi8(static_cast<char>(mask >> 24));
+
+        alignas(AVX_ALIGNMENT) uint32_t block[LSB_BLOCK];
+        uint8_t* out = args.payload;
+        uint64_t acc = 0;
+        size_t acc_bits = 0;
+        for (size_t i = 0; i < vec_len; i += LSB_BLOCK)
+        {
+            __m256i seg_r = _mm256_and_si256(LOAD_SI256_CONST(r + i), vmask_r);
+            __m256i seg_g = _mm256_and_si256(LOAD_SI256_CONST(g + i), vmask_g);
+            __m256i seg_b = _mm256_and_si256(LOAD_SI256_CONST(b + i), vmask_b);
+            __m256i seg_a = _mm256_and_si256(LOAD_SI256_CONST(a + i), vmask_a);
+
+            __m256i rg_lo = _mm256_unpacklo_epi8(seg_r, seg_g);
+            __m256i rg_hi = _mm256_unpackhi_epi8(seg_r, seg_g);
+            __m256i ba_lo = _mm256_unpacklo_epi8(seg_b, seg_a);
+            __m256i ba_hi = _mm256_unpackhi_epi8(seg_b, seg_a);
+
+            // Lane 0 holds pixels 0-15, lane 1 pixels 16-31
+            __m256i rgba0 = _mm256_unpacklo_epi16(rg_lo, ba_lo);
+            __m256i rgba1 = _mm256_unpackhi_epi16(rg_lo, ba_lo);
+            __m256i rgba2 = _mm256_unpacklo_epi16(rg_hi, ba_hi);
+            __m256i rgba3 = _mm256_unpackhi_epi16(rg_hi, ba_hi);
+
+            STORE_SI256(block + 0, _mm256_permute2x128_si256(rgba0, rgba1, 0x20));
+            STORE_SI256(block + 8, _mm256_permute2x128_si256(rgba2, rgba3, 0x20));
+            STORE_SI256(block + 16, _mm256_permute2x128_si256(rgba0, rgba1, 0x31));
+            STORE_SI256(block + 24, _mm256_permute2x128_si256(rgba2, rgba3, 0x31));
+
+            for (size_t j = 0; j < LSB_BLOCK; ++j)
+            {
+                acc |= static_cast<uint64_t>(_pext_u32(block[j], mask)) << acc_bits;
+                acc_bits += pixel_bits;
+                if (acc_bits >= 32)
+                {
+                    const uint32_t word = static_cast<uint32_t>(acc);
+                    std::memcpy(out, &word, sizeof(word));
+                    out += sizeof(word);
+                    acc >>= 32;
+                    acc_bits -= 32;
+                }
+            }
+        }
+
+        // Blocks end on byte boundaries, so only whole bytes are left
+        for (; acc_bits > 0; acc_bits -= 8)
+        {
+            *out++ = static_cast<uint8_t>(acc);
+            acc >>= 8;
+        }
+
+        return vec_len;
+    }
+}
+#endif
\ No newline at end of file
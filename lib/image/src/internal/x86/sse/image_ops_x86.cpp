@@ -5,23 +5,22 @@
 #if defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)
 #include <ien/internal/std/image_ops_std.hpp>
 #include <ien/internal/image_ops_args.hpp>
+#include <ien/internal/x86/tier_scalar.hpp>
 
-#include <ien/arithmetic.hpp>
-#include <algorithm>
 #include <immintrin.h>
 
 #define SSE_ALIGNMENT 16
 
 #define DEBUG_ASSERT_RGBA_ALIGNED(r, g, b, a) \
-    LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(r, SSE_ALIGNMENT)); \
-    LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(g, SSE_ALIGNMENT)); \
-    LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(b, SSE_ALIGNMENT)); \
-    LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(a, SSE_ALIGNMENT))
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(r, SSE_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(g, SSE_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(b, SSE_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(a, SSE_ALIGNMENT))
 
 #define DEBUG_ASSERT_RGB_ALIGNED(r, g, b) \
-    LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(r, SSE_ALIGNMENT)); \
-    LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(g, SSE_ALIGNMENT)); \
-    LIEN_DEBUG_ASSERT(ien::is_ptr_aligned(b, SSE_ALIGNMENT))    
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(r, SSE_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(g, SSE_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(b, SSE_ALIGNMENT))    
 
 #define BIND_CHANNELS(args, r, g, b, a) \
     uint8_t* r = args.ch_r; \
@@ -55,6 +54,9 @@
 #define LOAD_SI128_CONST(addr) \
     _mm_load_si128(reinterpret_cast<const __m128i*>(addr));
 
+#define LOADU_SI128_CONST(addr) \
+    _mm_loadu_si128(reinterpret_cast<const __m128i*>(addr));
+
 namespace ien::image_ops::_internal
 {
     const uint32_t trunc_and_table[8] = {
@@ -67,22 +69,21 @@ namespace ien::image_ops::_internal
         __m128 data[4];
     };
 
-    inline vec4x4xf32 extract_4x4xf32_from_8xu8(__m128i v)
+    // Widens 16 u8 lanes to f32 keeping the pixel order: data[n] holds pixels 4n to 4n + 3
+    static inline vec4x4xf32 widen_4x4xf32_from_16xu8(__m128i v)
     {
-        const __m128i vand_mask = _mm_set1_epi32(0x000000FF);
+        const __m128i vzero = _mm_setzero_si128();
 
-        __m128i vi32_0 = _mm_and_si128(v, vand_mask);
-        __m128i vi32_1 = _mm_and_si128(_mm_srli_si128(v, 1), vand_mask);
-        __m128i vi32_2 = _mm_and_si128(_mm_srli_si128(v, 2), vand_mask);
-        __m128i vi32_3 = _mm_and_si128(_mm_srli_si128(v, 3), vand_mask);
+        __m128i vlo16 = _mm_unpacklo_epi8(v, vzero);
+        __m128i vhi16 = _mm_unpackhi_epi8(v, vzero);
 
         return {{
-            _mm_cvtepi32_ps(vi32_0),
-            _mm_cvtepi32_ps(vi32_1),
-            _mm_cvtepi32_ps(vi32_2),
-            _mm_cvtepi32_ps(vi32_3)
+            _mm_cvtepi32_ps(_mm_unpacklo_epi16(vlo16, vzero)),
+            _mm_cvtepi32_ps(_mm_unpackhi_epi16(vlo16, vzero)),
+            _mm_cvtepi32_ps(_mm_unpacklo_epi16(vhi16, vzero)),
+            _mm_cvtepi32_ps(_mm_unpackhi_epi16(vhi16, vzero))
         }};
-    };
+    }
 
     void truncate_channel_data_sse2(const truncate_channel_args& args)
     {
@@ -128,26 +129,24 @@ namespace ien::image_ops::_internal
         }
     }
 
-    inline __m128i emulate_mm_srli_epi8(__m128i v, int bits)
+    static inline __m128i emulate_mm_srli_epi8(__m128i v, int bits)
     {
         const __m128i mask = _mm_set1_epi8(0xFFu >> bits);
         return _mm_and_si128(_mm_srli_epi16(v, bits), mask);
     }
 
-    fixed_vector<uint8_t> rgba_average_sse2(const channel_info_extract_args_rgba& args)
+    void rgba_average_sse2(const channel_info_extract_args_rgba& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
 
         if (img_sz < SSE_ALIGNMENT)
         {
-            return rgba_average_std(args);
+            return rgba_average_std(args, out);
         }
 
-        fixed_vector<uint8_t> result(args.len, SSE_ALIGNMENT);
-
         BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
 
-        const __m128i vchk_odd = _mm_set1_epi8(0x01);
+        const __m128i vzero = _mm_setzero_si128();
 
         size_t last_v_idx = img_sz - (img_sz % SSE_ALIGNMENT);
         for (size_t i = 0; i < last_v_idx; i += SSE_ALIGNMENT)
@@ -157,38 +156,36 @@ namespace ien::image_ops::_internal
             __m128i vseg_b = LOAD_SI128_CONST(b + i);
             __m128i vseg_a = LOAD_SI128_CONST(a + i);
 
-            __m128i vavg_rg = _mm_avg_epu8(vseg_r, vseg_g);
-            __m128i vavg_ba = _mm_avg_epu8(vseg_b, vseg_a);
-            __m128i vavg_rgba = _mm_avg_epu8(vavg_rg, vavg_ba);
-
-            // Compensate upwards rounding
-            __m128i vcar_rg = _mm_and_si128(_mm_sub_epi8(vseg_r, vseg_g), vchk_odd);
-            __m128i vcar_ba = _mm_and_si128(_mm_sub_epi8(vseg_b, vseg_a), vchk_odd);
-            __m128i vcar_rgba = _mm_avg_epu8(vcar_rg, vcar_ba);
+            // Exact floor((r + g + b + a) / 4) on 16 bit sums
+            __m128i vsum_lo = _mm_add_epi16(
+                _mm_add_epi16(_mm_unpacklo_epi8(vseg_r, vzero), _mm_unpacklo_epi8(vseg_g, vzero)),
+                _mm_add_epi16(_mm_unpacklo_epi8(vseg_b, vzero), _mm_unpacklo_epi8(vseg_a, vzero))
+            );
+            __m128i vsum_hi = _mm_add_epi16(
+                _mm_add_epi16(_mm_unpackhi_epi8(vseg_r, vzero), _mm_unpackhi_epi8(vseg_g, vzero)),
+                _mm_add_epi16(_mm_unpackhi_epi8(vseg_b, vzero), _mm_unpackhi_epi8(vseg_a, vzero))
+            );
 
-            vavg_rgba = _mm_sub_epi8(vavg_rgba, vcar_rgba);
+            __m128i vavg_rgba = _mm_packus_epi16(_mm_srli_epi16(vsum_lo, 2), _mm_srli_epi16(vsum_hi, 2));
 
-            STOREU_SI128((result.data() + i), vavg_rgba);
+            STOREU_SI128((out + i), vavg_rgba);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            result[i] = average<uint8_t>(r[i], g[i], b[i], a[i]);
+            out[i] = tier_average(r[i], g[i], b[i], a[i]);
         }
-        return result;
     }
 
-    fixed_vector<uint8_t> rgba_max_sse2(const channel_info_extract_args_rgba& args)
+    void rgba_max_sse2(const channel_info_extract_args_rgba& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
 
         if (img_sz < SSE_ALIGNMENT)
         {
-            return rgba_max_std(args);
+            return rgba_max_std(args, out);
         }
 
-        fixed_vector<uint8_t> result(args.len, SSE_ALIGNMENT);
-
         BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
 
         size_t last_v_idx = img_sz - (img_sz % SSE_ALIGNMENT);
@@ -203,27 +200,24 @@ namespace ien::image_ops::_internal
             __m128i vmax_ba = _mm_max_epu8(vseg_b, vseg_a);
             __m128i vmax_rgba = _mm_max_epu8(vmax_rg, vmax_ba);
 
-            STOREU_SI128((result.data() + i), vmax_rgba);
+            STOREU_SI128((out + i), vmax_rgba);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            result[i] = std::max({ r[i], g[i], b[i], a[i] });
+            out[i] = tier_max(r[i], g[i], b[i], a[i]);
         }
-        return result;
     }
 
-    fixed_vector<uint8_t> rgba_min_sse2(const channel_info_extract_args_rgba& args)
+    void rgba_min_sse2(const channel_info_extract_args_rgba& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
 
         if (img_sz < SSE_ALIGNMENT)
         {
-            return rgba_min_std(args);
+            return rgba_min_std(args, out);
         }
 
-        fixed_vector<uint8_t> result(args.len, SSE_ALIGNMENT);
-
         BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
 
         size_t last_v_idx = img_sz - (img_sz % SSE_ALIGNMENT);
@@ -238,27 +232,24 @@ namespace ien::image_ops::_internal
             __m128i vmax_ba = _mm_min_epu8(vseg_b, vseg_a);
             __m128i vmax_rgba = _mm_min_epu8(vmax_rg, vmax_ba);
 
-            STOREU_SI128((result.data() + i), vmax_rgba);
+            STOREU_SI128((out + i), vmax_rgba);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            result[i] = std::min({ r[i], g[i], b[i], a[i] });
+            out[i] = tier_min(r[i], g[i], b[i], a[i]);
         }
-        return result;
     }
 
-    fixed_vector<float> rgb_average_sse2(const channel_info_extract_args_rgb& args)
+    void rgb_average_sse2(const channel_info_extract_args_rgb& args, float* out)
     {
         const size_t img_sz = args.len;
 
         if (img_sz < SSE_ALIGNMENT)
         {
-            return rgb_average_std(args);
+            return rgb_average_std(args, out);
         }
 
-        fixed_vector<float> result(args.len, SSE_ALIGNMENT);
-
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
         const __m128i lo_4i_mask_0 = _mm_set1_epi32(0x000000FF);
@@ -272,9 +263,9 @@ namespace ien::image_ops::_internal
             __m128i vseg_g = LOAD_SI128_CONST(g + i);
             __m128i vseg_b = LOAD_SI128_CONST(b + i);
 
-            vec4x4xf32 vlr = extract_4x4xf32_from_8xu8(vseg_r);
-            vec4x4xf32 vlg = extract_4x4xf32_from_8xu8(vseg_g);
-            vec4x4xf32 vlb = extract_4x4xf32_from_8xu8(vseg_b);
+            vec4x4xf32 vlr = widen_4x4xf32_from_16xu8(vseg_r);
+            vec4x4xf32 vlg = widen_4x4xf32_from_16xu8(vseg_g);
+            vec4x4xf32 vlb = widen_4x4xf32_from_16xu8(vseg_b);
 
             vlr.data[0] = _mm_add_ps(_mm_add_ps(vlr.data[0], vlg.data[0]), vlb.data[0]);
             vlr.data[1] = _mm_add_ps(_mm_add_ps(vlr.data[1], vlg.data[1]), vlb.data[1]);
@@ -286,96 +277,27 @@ namespace ien::image_ops::_internal
             vlr.data[2] = _mm_mul_ps(vlr.data[2], vmul_div3);
             vlr.data[3] = _mm_mul_ps(vlr.data[3], vmul_div3);
 
-            _mm_store_ps(result.data() + i + (0 * 4), vlr.data[0]);
-            _mm_store_ps(result.data() + i + (1 * 4), vlr.data[1]);
-            _mm_store_ps(result.data() + i + (2 * 4), vlr.data[2]);
-            _mm_store_ps(result.data() + i + (3 * 4), vlr.data[3]);
+            _mm_storeu_ps(out + i + (0 * 4), vlr.data[0]);
+            _mm_storeu_ps(out + i + (1 * 4), vlr.data[1]);
+            _mm_storeu_ps(out + i + (2 * 4), vlr.data[2]);
+            _mm_storeu_ps(out + i + (3 * 4), vlr.data[3]);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            result[i] = ien::safe_add<float>(r[i], g[i], b[i]) / 3;
+            out[i] = tier_average(r[i], g[i], b[i]);
         }
-        return result;
     }
 
-    fixed_vector<float> rgb_average_sse41(const channel_info_extract_args_rgb& args)
+    void rgb_max_sse2(const channel_info_extract_args_rgb& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
 
         if (img_sz < SSE_ALIGNMENT)
         {
-            return rgb_average_std(args);
+            return rgb_max_std(args, out);
         }
 
-        fixed_vector<float> result(args.len, SSE_ALIGNMENT);
-
-        BIND_CHANNELS_RGB_CONST(args, r, g, b);
-
-        struct vec4x4xf32
-        {
-            __m128 data[4];
-        };
-
-        auto extract_4x4xf32_from_16xu8 = [](__m128i v) -> vec4x4xf32
-        {
-            __m128i vi0 = _mm_cvtepu8_epi32(v);
-            __m128i vi1 = _mm_cvtepu8_epi32(_mm_srli_si128(v, 4));
-            __m128i vi2 = _mm_cvtepu8_epi32(_mm_srli_si128(v, 8));
-            __m128i vi3 = _mm_cvtepu8_epi32(_mm_srli_si128(v, 12));
-
-            return {
-                _mm_cvtepi32_ps(vi0),
-                _mm_cvtepi32_ps(vi1),
-                _mm_cvtepi32_ps(vi2),
-                _mm_cvtepi32_ps(vi3)
-            };
-        };
-
-        const __m128 vmul_div3 = _mm_set1_ps(0.333334F);
-
-        size_t last_v_idx = img_sz - (img_sz % SSE_ALIGNMENT);
-        for (size_t i = 0; i < last_v_idx; i += SSE_ALIGNMENT)
-        {
-            __m128i vseg_r = LOAD_SI128_CONST(r + i);
-            __m128i vseg_g = LOAD_SI128_CONST(g + i);
-            __m128i vseg_b = LOAD_SI128_CONST(b + i);
-
-            vec4x4xf32 vlr = extract_4x4xf32_from_16xu8(vseg_r);
-            vec4x4xf32 vlg = extract_4x4xf32_from_16xu8(vseg_g);
-            vec4x4xf32 vlb = extract_4x4xf32_from_16xu8(vseg_b);
-
-            for (size_t vidx = 0; vidx < 4; ++vidx)
-            {
-                __m128 vrf = vlr.data[vidx];
-                __m128 vgf = vlg.data[vidx];
-                __m128 vbf = vlb.data[vidx];
-
-                __m128 sum = _mm_add_ps(_mm_add_ps(vrf, vgf), vbf);
-                __m128 avg = _mm_mul_ps(sum, vmul_div3);
-
-                _mm_store_ps(result.data() + i + (vidx * 4), avg);
-            }
-        }
-
-        for (size_t i = last_v_idx; i < img_sz; ++i)
-        {
-            result[i] = ien::safe_add<float>(r[i], g[i], b[i]) / 3;
-        }
-        return result;
-    }
-
-    fixed_vector<uint8_t> rgb_max_sse2(const channel_info_extract_args_rgb& args)
-    {
-        const size_t img_sz = args.len;
-
-        if (img_sz < SSE_ALIGNMENT)
-        {
-            return rgb_max_std(args);
-        }
-
-        fixed_vector<uint8_t> result(args.len, SSE_ALIGNMENT);
-
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
         size_t last_v_idx = img_sz - (img_sz % SSE_ALIGNMENT);
@@ -388,27 +310,24 @@ namespace ien::image_ops::_internal
             __m128i vmax_rg = _mm_max_epu8(vseg_r, vseg_g);
             __m128i vmax_rgb = _mm_max_epu8(vmax_rg, vseg_b);
 
-            STOREU_SI128((result.data() + i), vmax_rgb);
+            STOREU_SI128((out + i), vmax_rgb);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            result[i] = std::max({ r[i], g[i], b[i] });
+            out[i] = tier_max(r[i], g[i], b[i]);
         }
-        return result;
     }
 
-    fixed_vector<uint8_t> rgb_min_sse2(const channel_info_extract_args_rgb& args)
+    void rgb_min_sse2(const channel_info_extract_args_rgb& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
 
         if (img_sz < SSE_ALIGNMENT)
         {
-            return rgb_min_std(args);
+            return rgb_min_std(args, out);
         }
 
-        fixed_vector<uint8_t> result(args.len, SSE_ALIGNMENT);
-
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
         size_t last_v_idx = img_sz - (img_sz % SSE_ALIGNMENT);
@@ -421,27 +340,24 @@ namespace ien::image_ops::_internal
             __m128i vmax_rg = _mm_min_epu8(vseg_r, vseg_g);
             __m128i vmax_rgb = _mm_min_epu8(vmax_rg, vseg_b);
 
-            STOREU_SI128((result.data() + i), vmax_rgb);
+            STOREU_SI128((out + i), vmax_rgb);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            result[i] = std::min({ r[i], g[i], b[i] });
+            out[i] = tier_min(r[i], g[i], b[i]);
         }
-        return result;
     }
 
-    fixed_vector<uint8_t> rgba_sum_saturated_sse2(const channel_info_extract_args_rgba& args)
+    void rgba_sum_saturated_sse2(const channel_info_extract_args_rgba& args, uint8_t* out)
     {
         const size_t img_sz = args.len;
 
         if (img_sz < SSE_ALIGNMENT)
         {
-            return rgba_sum_saturated_std(args);
+            return rgba_sum_saturated_std(args, out);
         }
 
-        fixed_vector<uint8_t> result(args.len, SSE_ALIGNMENT);
-
         BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
 
         size_t last_v_idx = img_sz - (img_sz % SSE_ALIGNMENT);
@@ -456,28 +372,25 @@ namespace ien::image_ops::_internal
             __m128i vsum_ba = _mm_adds_epu8(vseg_b, vseg_a);
             __m128i vsum_rgba = _mm_adds_epu8(vsum_rg, vsum_ba);
 
-            STOREU_SI128((result.data() + i), vsum_rgba);
+            STOREU_SI128((out + i), vsum_rgba);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
             uint16_t sum = static_cast<uint16_t>(r[i]) + g[i] + b[i] + a[i];
-            result[i] = static_cast<uint8_t>(std::min(static_cast<uint16_t>(0x00FFu), sum));
+            out[i] = static_cast<uint8_t>((sum < 0x00FFu) ? sum : 0x00FFu);
         }
-        return result;
     }
 
-    fixed_vector<float> rgb_saturation_sse2(const channel_info_extract_args_rgb& args)
+    void rgb_saturation_sse2(const channel_info_extract_args_rgb& args, float* out)
     {
         const size_t img_sz = args.len;
 
         if (img_sz < SSE_ALIGNMENT)
         {
-            return rgb_saturation_std(args);
+            return rgb_saturation_std(args, out);
         }
 
-        fixed_vector<float> result(args.len, SSE_ALIGNMENT);
-
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
         __m128i fpcast_mask = _mm_set1_epi32(0x000000FF);
@@ -530,34 +443,30 @@ namespace ien::image_ops::_internal
             for (size_t k = 0; k < 4u; ++k)
             {
                 size_t offset = i + (k * 4u);
-                result[offset + 0] = aux_result[0 + k];
-                result[offset + 1] = aux_result[4 + k];
-                result[offset + 2] = aux_result[8 + k];
-                result[offset + 3] = aux_result[12 + k];
+                out[offset + 0] = aux_result[0 + k];
+                out[offset + 1] = aux_result[4 + k];
+                out[offset + 2] = aux_result[8 + k];
+                out[offset + 3] = aux_result[12 + k];
             }
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            float vmax = static_cast<float>(std::max({ r[i], g[i], b[i] })) / 255.0F;
-            float vmin = static_cast<float>(std::min({ r[i], g[i], b[i] })) / 255.0F;
-            result[i] = (vmax - vmin) / vmax;
+            float vmax = static_cast<float>(tier_max(r[i], g[i], b[i])) / 255.0F;
+            float vmin = static_cast<float>(tier_min(r[i], g[i], b[i])) / 255.0F;
+            out[i] = (vmax - vmin) / vmax;
         }
-
-        return result;
     }
 
-    fixed_vector<float> rgb_luminance_sse2(const channel_info_extract_args_rgb& args)
+    void rgb_luminance_sse2(const channel_info_extract_args_rgb& args, float* out)
     {
         const size_t img_sz = args.len;
 
         if (img_sz < SSE_ALIGNMENT)
         {
-            return rgb_luminance_std(args);
+            return rgb_luminance_std(args, out);
         }
 
-        fixed_vector<float> result(args.len, SSE_ALIGNMENT);
-
         BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
         const __m128 vlum_mul_r = _mm_set1_ps(0.2126F);
@@ -572,9 +481,9 @@ namespace ien::image_ops::_internal
             __m128i vseg_g = LOAD_SI128_CONST(g + i);
             __m128i vseg_b = LOAD_SI128_CONST(b + i);
 
-            vec4x4xf32 vfr = extract_4x4xf32_from_8xu8(vseg_r);
-            vec4x4xf32 vfg = extract_4x4xf32_from_8xu8(vseg_g);
-            vec4x4xf32 vfb = extract_4x4xf32_from_8xu8(vseg_b);
+            vec4x4xf32 vfr = widen_4x4xf32_from_16xu8(vseg_r);
+            vec4x4xf32 vfg = widen_4x4xf32_from_16xu8(vseg_g);
+            vec4x4xf32 vfb = widen_4x4xf32_from_16xu8(vseg_b);
 
             vfr.data[0] = _mm_mul_ps(vfr.data[0], vlum_mul_r);
             vfr.data[1] = _mm_mul_ps(vfr.data[1], vlum_mul_r);
@@ -602,90 +511,137 @@ namespace ien::image_ops::_internal
             vlum.data[2] = _mm_mul_ps(vlum.data[2], vlum_div_255);
             vlum.data[3] = _mm_mul_ps(vlum.data[3], vlum_div_255);
 
-            _mm_store_ps(result.data() + i + 0, vlum.data[0]);
-            _mm_store_ps(result.data() + i + 4, vlum.data[1]);
-            _mm_store_ps(result.data() + i + 8, vlum.data[2]);
-            _mm_store_ps(result.data() + i + 12, vlum.data[3]);
+            _mm_storeu_ps(out + i + 0, vlum.data[0]);
+            _mm_storeu_ps(out + i + 4, vlum.data[1]);
+            _mm_storeu_ps(out + i + 8, vlum.data[2]);
+            _mm_storeu_ps(out + i + 12, vlum.data[3]);
         }
 
         for (size_t i = last_v_idx; i < img_sz; ++i)
         {
-            result[i] = (r[i] * 0.2126F / 255) + (g[i] * 0.7152F / 255) + (b[i] * 0.0722F / 255);
+            out[i] = (r[i] * 0.2126F / 255) + (g[i] * 0.7152F / 255) + (b[i] * 0.0722F / 255);
         }
-
-        return result;
     }
 
-    image_planar_data unpack_image_data_ssse3(const uint8_t* data, size_t len)
+    void rgb_metrics_sse2(const rgb_metrics_args& args)
     {
-        if (len < (SSE_ALIGNMENT * 4))
+        const size_t img_sz = args.len;
+
+        if (img_sz < SSE_ALIGNMENT)
         {
-            return unpack_image_data_std(data, len);
+            return rgb_metrics_std(args);
         }
 
-        image_planar_data result(len / 4);
-        uint8_t* r = result.data_r();
-        uint8_t* g = result.data_g();
-        uint8_t* b = result.data_b();
-        uint8_t* a = result.data_a();
+        BIND_CHANNELS_RGB_CONST(args, r, g, b);
 
-        const __m128i vshufmask = _mm_set_epi8(
-            15, 11, 7, 3,
-            14, 10, 6, 2,
-            13, 9, 5, 1,
-            12, 8, 4, 0
-        );
+        const __m128 vlum_mul_r = _mm_set1_ps(0.2126F);
+        const __m128 vlum_mul_g = _mm_set1_ps(0.7152F);
+        const __m128 vlum_mul_b = _mm_set1_ps(0.0722F);
+        const __m128 vlum_div_255 = _mm_set1_ps(1.0F / 255);
+        const __m128 vmul_div3 = _mm_set1_ps(0.333334F);
+
+        const bool need_channels_f32 = args.luminance || args.average;
 
-        size_t last_v_idx = len - (len % (SSE_ALIGNMENT * 4));
-        for (size_t i = 0; i < last_v_idx; i += SSE_ALIGNMENT * 4)
+        size_t last_v_idx = img_sz - (img_sz % SSE_ALIGNMENT);
+        for (size_t i = 0; i < last_v_idx; i += SSE_ALIGNMENT)
         {
-            __m128i vdata0 = LOAD_SI128_CONST(data + i + (SSE_ALIGNMENT * 0));
-            __m128i vdata1 = LOAD_SI128_CONST(data + i + (SSE_ALIGNMENT * 1));
-            __m128i vdata2 = LOAD_SI128_CONST(data + i + (SSE_ALIGNMENT * 2));
-            __m128i vdata3 = LOAD_SI128_CONST(data + i + (SSE_ALIGNMENT * 3));
+            __m128i vseg_r = LOAD_SI128_CONST(r + i);
+            __m128i vseg_g = LOAD_SI128_CONST(g + i);
+            __m128i vseg_b = LOAD_SI128_CONST(b + i);
 
-            __m128i v_di_data0 = _mm_shuffle_epi8(vdata0, vshufmask);
-            __m128i v_di_data1 = _mm_shuffle_epi8(vdata1, vshufmask);
-            __m128i v_di_data2 = _mm_shuffle_epi8(vdata2, vshufmask);
-            __m128i v_di_data3 = _mm_shuffle_epi8(vdata3, vshufmask);
+            __m128i vmax_rgb = _mm_max_epu8(_mm_max_epu8(vseg_r, vseg_g), vseg_b);
+            __m128i vmin_rgb = _mm_min_epu8(_mm_min_epu8(vseg_r, vseg_g), vseg_b);
 
-            __m128i v_r0r1g0g1 = _mm_unpacklo_epi32(v_di_data0, v_di_data1);
-            __m128i v_r2r3g2g3 = _mm_unpacklo_epi32(v_di_data2, v_di_data3);
-            __m128i v_r0r1r2r3 = _mm_unpacklo_epi64(v_r0r1g0g1, v_r2r3g2g3);
-            __m128i v_g0g1g2g3 = _mm_unpackhi_epi64(v_r0r1g0g1, v_r2r3g2g3);
+            if (args.max) { STOREU_SI128(args.max + i, vmax_rgb); }
+            if (args.min) { STOREU_SI128(args.min + i, vmin_rgb); }
 
-            __m128i v_b0b1a0a1 = _mm_unpackhi_epi32(v_di_data0, v_di_data1);
-            __m128i v_b2b3a2a3 = _mm_unpackhi_epi32(v_di_data2, v_di_data3);
-            __m128i v_b0b1b2b3 = _mm_unpacklo_epi64(v_b0b1a0a1, v_b2b3a2a3);
-            __m128i v_a0a1a2a3 = _mm_unpackhi_epi64(v_b0b1a0a1, v_b2b3a2a3);
+            if (need_channels_f32)
+            {
+                vec4x4xf32 vfr = widen_4x4xf32_from_16xu8(vseg_r);
+                vec4x4xf32 vfg = widen_4x4xf32_from_16xu8(vseg_g);
+                vec4x4xf32 vfb = widen_4x4xf32_from_16xu8(vseg_b);
+
+                for (size_t vidx = 0; vidx < 4; ++vidx)
+                {
+                    if (args.luminance)
+                    {
+                        __m128 vlum = _mm_add_ps(
+                            _mm_add_ps(_mm_mul_ps(vfr.data[vidx], vlum_mul_r), _mm_mul_ps(vfg.data[vidx], vlum_mul_g)),
+                            _mm_mul_ps(vfb.data[vidx], vlum_mul_b)
+                        );
+                        _mm_storeu_ps(args.luminance + i + (vidx * 4), _mm_mul_ps(vlum, vlum_div_255));
+                    }
+                    if (args.average)
+                    {
+                        __m128 vsum = _mm_add_ps(_mm_add_ps(vfr.data[vidx], vfg.data[vidx]), vfb.data[vidx]);
+                        _mm_storeu_ps(args.average + i + (vidx * 4), _mm_mul_ps(vsum, vmul_div3));
+                    }
+                }
+            }
 
-            STORE_SI128(r + (i / 4), v_r0r1r2r3);
-            STORE_SI128(g + (i / 4), v_g0g1g2g3);
-            STORE_SI128(b + (i / 4), v_b0b1b2b3);
-            STORE_SI128(a + (i / 4), v_a0a1a2a3);
+            if (args.saturation)
+            {
+                vec4x4xf32 vfmax = widen_4x4xf32_from_16xu8(vmax_rgb);
+                vec4x4xf32 vfmin = widen_4x4xf32_from_16xu8(vmin_rgb);
+
+                for (size_t vidx = 0; vidx < 4; ++vidx)
+                {
+                    __m128 vsat = _mm_div_ps(_mm_sub_ps(vfmax.data[vidx], vfmin.data[vidx]), vfmax.data[vidx]);
+                    _mm_storeu_ps(args.saturation + i + (vidx * 4), vsat);
+                }
+            }
         }
 
-        for (size_t i = last_v_idx; i < len; ++i)
+        rgb_metrics_std(args.subrange(last_v_idx, img_sz - last_v_idx));
+    }
+
+    void pack_image_data_sse2(const channel_info_extract_args_rgba& args, uint8_t* out)
+    {
+        const size_t len = args.len;
+        if (len < SSE_ALIGNMENT)
+        {
+            return pack_image_data_std(args, out);
+        }
+
+        BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
+
+        size_t last_v_idx = len - (len % SSE_ALIGNMENT);
+        for (size_t i = 0; i < last_v_idx; i += SSE_ALIGNMENT)
         {
-            r[i / 4] = data[i + 0];
-            g[i / 4] = data[i + 1];
-            b[i / 4] = data[i + 2];
-            a[i / 4] = data[i + 3];
+            __m128i vr = LOAD_SI128_CONST(r + i);
+            __m128i vg = LOAD_SI128_CONST(g + i);
+            __m128i vb = LOAD_SI128_CONST(b + i);
+            __m128i va = LOAD_SI128_CONST(a + i);
+
+            __m128i v_rg_lo = _mm_unpacklo_epi8(vr, vg);
+            __m128i v_rg_hi = _mm_unpackhi_epi8(vr, vg);
+            __m128i v_ba_lo = _mm_unpacklo_epi8(vb, va);
+            __m128i v_ba_hi = _mm_unpackhi_epi8(vb, va);
+
+            uint8_t* dst = out + (i * 4);
+            STOREU_SI128(dst + (SSE_ALIGNMENT * 0), _mm_unpacklo_epi16(v_rg_lo, v_ba_lo));
+            STOREU_SI128(dst + (SSE_ALIGNMENT * 1), _mm_unpackhi_epi16(v_rg_lo, v_ba_lo));
+            STOREU_SI128(dst + (SSE_ALIGNMENT * 2), _mm_unpacklo_epi16(v_rg_hi, v_ba_hi));
+            STOREU_SI128(dst + (SSE_ALIGNMENT * 3), _mm_unpackhi_epi16(v_rg_hi, v_ba_hi));
         }
 
-        return result;
+        for (size_t i = last_v_idx; i < len; ++i)
+        {
+            out[(i * 4) + 0] = r[i];
+            out[(i * 4) + 1] = g[i];
+            out[(i * 4) + 2] = b[i];
+            out[(i * 4) + 3] = a[i];
+        }
     }
 
-    fixed_vector<uint8_t> channel_compare_sse2(const channel_compare_args& args)
+    void channel_compare_sse2(const channel_compare_args& args, uint8_t* out)
     {
         const size_t len = args.len;
         if (len < SSE_ALIGNMENT)
         {
-            return channel_compare_std(args);
+            return channel_compare_std(args, out);
         }
 
-        fixed_vector<uint8_t> result(len, SSE_ALIGNMENT);
-
         const __m128i vthreshold = _mm_set1_epi8(args.threshold);
 
         size_t last_v_idx = len - (len % (SSE_ALIGNMENT));
@@ -693,15 +649,215 @@ namespace ien::image_ops::_internal
         {
             __m128i vseg = LOAD_SI128_CONST(args.ch + i);
             __m128i vcmp = _mm_cmpeq_epi8(vseg, _mm_max_epu8(vseg, vthreshold));
-            STORE_SI128(result.data() + i, vcmp);
+            STOREU_SI128(out + i, vcmp);
+        }
+
+        for (size_t i = last_v_idx; i < len; ++i)
+        {
+            out[i] = args.ch[i] >= args.threshold;
+        }
+    }
+
+    // The 32-bit square accumulators grow by at most 4 * 255^2 per iteration,
+    // they are widened to 64 bits well before they could overflow
+    const size_t REDUCE_FLUSH_INTERVAL = 8192;
+
+    // Byte wise horizontal min/max by folding halves
+    static inline uint8_t horizontal_min_epu8(__m128i v)
+    {
+        v = _mm_min_epu8(v, _mm_srli_si128(v, 8));
+        v = _mm_min_epu8(v, _mm_srli_si128(v, 4));
+        v = _mm_min_epu8(v, _mm_srli_si128(v, 2));
+        v = _mm_min_epu8(v, _mm_srli_si128(v, 1));
+        return static_cast<uint8_t>(_mm_cvtsi128_si32(v));
+    }
+
+    static inline uint8_t horizontal_max_epu8(__m128i v)
+    {
+        v = _mm_max_epu8(v, _mm_srli_si128(v, 8));
+        v = _mm_max_epu8(v, _mm_srli_si128(v, 4));
+        v = _mm_max_epu8(v, _mm_srli_si128(v, 2));
+        v = _mm_max_epu8(v, _mm_srli_si128(v, 1));
+        return static_cast<uint8_t>(_mm_cvtsi128_si32(v));
+    }
+
+    static void reduce_channel_sse2(const uint8_t* data, size_t len, rgba_reduction& out, size_t ch)
+    {
+        const __m128i vzero = _mm_setzero_si128();
+        __m128i vsum = vzero;
+        __m128i vsum_sq = vzero;
+        __m128i vsum_sq32 = vzero;
+        __m128i vmin = _mm_set1_epi8(static_cast<char>(0xFF));
+        __m128i vmax = vzero;
+
+        size_t last_v_idx = len - (len % SSE_ALIGNMENT);
+        size_t flush_count = 0;
+        for (size_t i = 0; i < last_v_idx; i += SSE_ALIGNMENT)
+        {
+            __m128i vseg = LOAD_SI128_CONST(data + i);
+            vsum = _mm_add_epi64(vsum, _mm_sad_epu8(vseg, vzero));
+
+            __m128i vlo = _mm_unpacklo_epi8(vseg, vzero);
+            __m128i vhi = _mm_unpackhi_epi8(vseg, vzero);
+            vsum_sq32 = _mm_add_epi32(vsum_sq32, _mm_add_epi32(_mm_madd_epi16(vlo, vlo), _mm_madd_epi16(vhi, vhi)));
+
+            vmin = _mm_min_epu8(vmin, vseg);
+            vmax = _mm_max_epu8(vmax, vseg);
+
+            if (++flush_count == REDUCE_FLUSH_INTERVAL)
+            {
+                vsum_sq = _mm_add_epi64(vsum_sq, _mm_unpacklo_epi32(vsum_sq32, vzero));
+                vsum_sq = _mm_add_epi64(vsum_sq, _mm_unpackhi_epi32(vsum_sq32, vzero));
+                vsum_sq32 = vzero;
+                flush_count = 0;
+            }
         }
+        vsum_sq = _mm_add_epi64(vsum_sq, _mm_unpacklo_epi32(vsum_sq32, vzero));
+        vsum_sq = _mm_add_epi64(vsum_sq, _mm_unpackhi_epi32(vsum_sq32, vzero));
+
+        alignas(SSE_ALIGNMENT) uint64_t sums[2];
+        alignas(SSE_ALIGNMENT) uint64_t sums_sq[2];
+        STORE_SI128(sums, vsum);
+        STORE_SI128(sums_sq, vsum_sq);
+
+        uint64_t sum = sums[0] + sums[1];
+        uint64_t sum_sq = sums_sq[0] + sums_sq[1];
+        uint8_t min = horizontal_min_epu8(vmin);
+        uint8_t max = horizontal_max_epu8(vmax);
 
         for (size_t i = last_v_idx; i < len; ++i)
         {
-            result[i] = args.ch[i] >= args.threshold;
+            const uint32_t v = data[i];
+            sum += v;
+            sum_sq += v * v;
+            min = (data[i] < min) ? data[i] : min;
+            max = (data[i] > max) ? data[i] : max;
         }
 
-        return result;
+        out.sum[ch] = sum;
+        out.sum_sq[ch] = sum_sq;
+        out.min[ch] = min;
+        out.max[ch] = max;
+    }
+
+    void rgba_reduce_sse2(const channel_info_extract_args_rgba& args, rgba_reduction& out)
+    {
+        BIND_CHANNELS_RGBA_CONST(args, r, g, b, a);
+
+        reduce_channel_sse2(r, args.len, out, 0);
+        reduce_channel_sse2(g, args.len, out, 1);
+        reduce_channel_sse2(b, args.len, out, 2);
+        reduce_channel_sse2(a, args.len, out, 3);
+    }
+
+    static inline uint8_t resample_round(int32_t accum)
+    {
+        const int32_t v = (accum + (1 << (resample_coeffs::PRECISION_BITS - 1))) >> resample_coeffs::PRECISION_BITS;
+        return static_cast<uint8_t>((v < 0) ? 0 : ((v > 255) ? 255 : v));
+    }
+
+    void resample_horizontal_sse2(const resample_args& args)
+    {
+        const resample_coeffs& coeffs = *args.coeffs;
+        const size_t* first = coeffs.first_data();
+        const int16_t* coeff_weights = coeffs.weights_data();
+        const __m128i vzero = _mm_setzero_si128();
+
+        for (size_t row = args.row_begin; row < args.row_end; ++row)
+        {
+            const uint8_t* src = args.src + (row * coeffs.in_len);
+            uint8_t* dst = args.dst + (row * coeffs.out_len);
+
+            for (size_t i = 0; i < coeffs.out_len; ++i)
+            {
+                const uint8_t* px = src + first[i];
+                const int16_t* weights = coeff_weights + (i * coeffs.weight_stride);
+
+                // Whole 8 tap chunks would read past the end of the row near the right edge
+                if (first[i] + coeffs.weight_stride > coeffs.in_len)
+                {
+                    int32_t accum = 0;
+                    for (size_t t = 0; t < coeffs.taps; ++t)
+                    {
+                        accum += px[t] * weights[t];
+                    }
+                    dst[i] = resample_round(accum);
+                    continue;
+                }
+
+                __m128i vaccum = vzero;
+                for (size_t t = 0; t < coeffs.weight_stride; t += 8)
+                {
+                    __m128i vpx = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(px + t)), vzero);
+                    __m128i vweights = LOADU_SI128_CONST(weights + t);
+                    vaccum = _mm_add_epi32(vaccum, _mm_madd_epi16(vpx, vweights));
+                }
+                vaccum = _mm_add_epi32(vaccum, _mm_shuffle_epi32(vaccum, _MM_SHUFFLE(1, 0, 3, 2)));
+                vaccum = _mm_add_epi32(vaccum, _mm_shuffle_epi32(vaccum, _MM_SHUFFLE(2, 3, 0, 1)));
+                dst[i] = resample_round(_mm_cvtsi128_si32(vaccum));
+            }
+        }
+    }
+
+    void resample_vertical_sse2(const resample_args& args)
+    {
+        const resample_coeffs& coeffs = *args.coeffs;
+        const size_t* first = coeffs.first_data();
+        const int16_t* coeff_weights = coeffs.weights_data();
+        const size_t width = args.width;
+        if (width < SSE_ALIGNMENT)
+        {
+            return resample_vertical_std(args);
+        }
+
+        const __m128i vzero = _mm_setzero_si128();
+        const __m128i vround = _mm_set1_epi32(1 << (resample_coeffs::PRECISION_BITS - 1));
+
+        for (size_t row = args.row_begin; row < args.row_end; ++row)
+        {
+            const uint8_t* src = args.src + (first[row] * width);
+            const int16_t* weights = coeff_weights + (row * coeffs.weight_stride);
+            uint8_t* dst = args.dst + (row * width);
+
+            for (size_t x = 0; x < width; x += SSE_ALIGNMENT)
+            {
+                // The last chunk overlaps the previous one instead of running a scalar tail
+                x = (x < width - SSE_ALIGNMENT) ? x : (width - SSE_ALIGNMENT);
+
+                __m128i vaccum0 = vround;
+                __m128i vaccum1 = vround;
+                __m128i vaccum2 = vround;
+                __m128i vaccum3 = vround;
+
+                // Taps go in pairs through madd, an odd last tap is paired with itself and a zero padding weight
+                for (size_t t = 0; t < coeffs.taps; t += 2)
+                {
+                    const size_t t_next = (t + 1 < coeffs.taps) ? (t + 1) : t;
+                    __m128i va = LOADU_SI128_CONST(src + (t * width) + x);
+                    __m128i vb = LOADU_SI128_CONST(src + (t_next * width) + x);
+                    const uint32_t wpair = static_cast<uint16_t>(weights[t]) | (static_cast<uint32_t>(static_cast<uint16_t>(weights[t + 1])) << 16);
+                    __m128i vweights = _mm_set1_epi32(static_cast<int>(wpair));
+
+                    __m128i va_lo = _mm_unpacklo_epi8(va, vzero);
+                    __m128i va_hi = _mm_unpackhi_epi8(va, vzero);
+                    __m128i vb_lo = _mm_unpacklo_epi8(vb, vzero);
+                    __m128i vb_hi = _mm_unpackhi_epi8(vb, vzero);
+
+                    vaccum0 = _mm_add_epi32(vaccum0, _mm_madd_epi16(_mm_unpacklo_epi16(va_lo, vb_lo), vweights));
+                    vaccum1 = _mm_add_epi32(vaccum1, _mm_madd_epi16(_mm_unpackhi_epi16(va_lo, vb_lo), vweights));
+                    vaccum2 = _mm_add_epi32(vaccum2, _mm_madd_epi16(_mm_unpacklo_epi16(va_hi, vb_hi), vweights));
+                    vaccum3 = _mm_add_epi32(vaccum3, _mm_madd_epi16(_mm_unpackhi_epi16(va_hi, vb_hi), vweights));
+                }
+
+                vaccum0 = _mm_srai_epi32(vaccum0, resample_coeffs::PRECISION_BITS);
+                vaccum1 = _mm_srai_epi32(vaccum1, resample_coeffs::PRECISION_BITS);
+                vaccum2 = _mm_srai_epi32(vaccum2, resample_coeffs::PRECISION_BITS);
+                vaccum3 = _mm_srai_epi32(vaccum3, resample_coeffs::PRECISION_BITS);
+
+                __m128i vres = _mm_packus_epi16(_mm_packs_epi32(vaccum0, vaccum1), _mm_packs_epi32(vaccum2, vaccum3));
+                STOREU_SI128(dst + x, vres);
+            }
+        }
     }
 }
 #endif
\ No newline at end of file
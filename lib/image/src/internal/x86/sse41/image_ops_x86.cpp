@@ -0,0 +1,93 @@
+#include <ien/internal/x86/image_ops_x86.hpp>
+
+#include <ien/platform.hpp>
+
+#if defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)
+#include <ien/internal/std/image_ops_std.hpp>
+#include <ien/internal/image_ops_args.hpp>
+#include <ien/internal/x86/tier_scalar.hpp>
+
+#include <immintrin.h>
+
+#define SSE_ALIGNMENT 16
+
+#define DEBUG_ASSERT_RGB_ALIGNED(r, g, b) \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(r, SSE_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(g, SSE_ALIGNMENT)); \
+    LIEN_DEBUG_ASSERT(tier_ptr_aligned(b, SSE_ALIGNMENT))    
+
+#define BIND_CHANNELS_RGB_CONST(args, r, g, b) \
+    const uint8_t* r = args.ch_r; \
+    const uint8_t* g = args.ch_g; \
+    const uint8_t* b = args.ch_b; \
+    DEBUG_ASSERT_RGB_ALIGNED(r, g, b)
+
+#define LOAD_SI128_CONST(addr) \
+    _mm_load_si128(reinterpret_cast<const __m128i*>(addr));
+
+namespace ien::image_ops::_internal
+{
+    void rgb_average_sse41(const channel_info_extract_args_rgb& args, float* out)
+    {
+        const size_t img_sz = args.len;
+
+        if (img_sz < SSE_ALIGNMENT)
+        {
+            return rgb_average_std(args, out);
+        }
+
+        BIND_CHANNELS_RGB_CONST(args, r, g, b);
+
+        struct vec4x4xf32
+        {
+            __m128 data[4];
+        };
+
+        auto extract_4x4xf32_from_16xu8 = [](__m128i v) -> vec4x4xf32
+        {
+            __m128i vi0 = _mm_cvtepu8_epi32(v);
+            __m128i vi1 = _mm_cvtepu8_epi32(_mm_srli_si128(v, 4));
+            __m128i vi2 = _mm_cvtepu8_epi32(_mm_srli_si128(v, 8));
+            __m128i vi3 = _mm_cvtepu8_epi32(_mm_srli_si128(v, 12));
+
+            return {
+                _mm_cvtepi32_ps(vi0),
+                _mm_cvtepi32_ps(vi1),
+                _mm_cvtepi32_ps(vi2),
+                _mm_cvtepi32_ps(vi3)
+            };
+        };
+
+        const __m128 vmul_div3 = _mm_set1_ps(0.333334F);
+
+        size_t last_v_idx = img_sz - (img_sz % SSE_ALIGNMENT);
+        for (size_t i = 0; i < last_v_idx; i += SSE_ALIGNMENT)
+        {
+            __m128i vseg_r = LOAD_SI128_CONST(r + i);
+            __m128i vseg_g = LOAD_SI128_CONST(g + i);
+            __m128i vseg_b = LOAD_SI128_CONST(b + i);
+
+            vec4x4xf32 vlr = extract_4x4xf32_from_16xu8(vseg_r);
+            vec4x4xf32 vlg = extract_4x4xf32_from_16xu8(vseg_g);
+            vec4x4xf32 vlb = extract_4x4xf32_from_16xu8(vseg_b);
+
+            for (size_t vidx = 0; vidx < 4; ++vidx)
+            {
+                __m128 vrf = vlr.data[vidx];
+                __m128 vgf = vlg.data[vidx];
+                __m128 vbf = vlb.data[vidx];
+
+                __m128 sum = _mm_add_ps(_mm_add_ps(vrf, vgf), vbf);
+                __m128 avg = _mm_mul_ps(sum, vmul_div3);
+
+                _mm_storeu_ps(out + i + (vidx * 4), avg);
+            }
+        }
+
+        for (size_t i = last_v_idx; i < img_sz; ++i)
+        {
+            out[i] = tier_average(r[i], g[i], b[i]);
+        }
+    }
+}
+#endif
\ No newline at end of file
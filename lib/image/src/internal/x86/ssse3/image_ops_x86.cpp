@@ -0,0 +1,78 @@
+#include <ien/internal/x86/image_ops_x86.hpp>
+
+#include <ien/platform.hpp>
+
+#if defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)
+#include <ien/internal/std/image_ops_std.hpp>
+#include <ien/internal/image_ops_args.hpp>
+
+#include <immintrin.h>
+
+#define SSE_ALIGNMENT 16
+
+#define STORE_SI128(addr, v) \
+    _mm_store_si128(reinterpret_cast<__m128i*>(addr), v);
+
+#define LOADU_SI128_CONST(addr) \
+    _mm_loadu_si128(reinterpret_cast<const __m128i*>(addr));
+
+namespace ien::image_ops::_internal
+{
+    void unpack_image_data_ssse3(const uint8_t* data, size_t len, image_planar_data& out)
+    {
+        if (len < (SSE_ALIGNMENT * 4))
+        {
+            return unpack_image_data_std(data, len, out);
+        }
+
+        uint8_t* r = out.data_r();
+        uint8_t* g = out.data_g();
+        uint8_t* b = out.data_b();
+        uint8_t* a = out.data_a();
+
+        const __m128i vshufmask = _mm_set_epi8(
+            15, 11, 7, 3,
+            14, 10, 6, 2,
+            13, 9, 5, 1,
+            12, 8, 4, 0
+        );
+
+        size_t last_v_idx = len - (len % (SSE_ALIGNMENT * 4));
+        for (size_t i = 0; i < last_v_idx; i += SSE_ALIGNMENT * 4)
+        {
+            __m128i vdata0 = LOADU_SI128_CONST(data + i + (SSE_ALIGNMENT * 0));
+            __m128i vdata1 = LOADU_SI128_CONST(data + i + (SSE_ALIGNMENT * 1));
+            __m128i vdata2 = LOADU_SI128_CONST(data + i + (SSE_ALIGNMENT * 2));
+            __m128i vdata3 = LOADU_SI128_CONST(data + i + (SSE_ALIGNMENT * 3));
+
+            __m128i v_di_data0 = _mm_shuffle_epi8(vdata0, vshufmask);
+            __m128i v_di_data1 = _mm_shuffle_epi8(vdata1, vshufmask);
+            __m128i v_di_data2 = _mm_shuffle_epi8(vdata2, vshufmask);
+            __m128i v_di_data3 = _mm_shuffle_epi8(vdata3, vshufmask);
+
+            __m128i v_r0r1g0g1 = _mm_unpacklo_epi32(v_di_data0, v_di_data1);
+            __m128i v_r2r3g2g3 = _mm_unpacklo_epi32(v_di_data2, v_di_data3);
+            __m128i v_r0r1r2r3 = _mm_unpacklo_epi64(v_r0r1g0g1, v_r2r3g2g3);
+            __m128i v_g0g1g2g3 = _mm_unpackhi_epi64(v_r0r1g0g1, v_r2r3g2g3);
+
+            __m128i v_b0b1a0a1 = _mm_unpackhi_epi32(v_di_data0, v_di_data1);
+            __m128i v_b2b3a2a3 = _mm_unpackhi_epi32(v_di_data2, v_di_data3);
+            __m128i v_b0b1b2b3 = _mm_unpacklo_epi64(v_b0b1a0a1, v_b2b3a2a3);
+            __m128i v_a0a1a2a3 = _mm_unpackhi_epi64(v_b0b1a0a1, v_b2b3a2a3);
+
+            STORE_SI128(r + (i / 4), v_r0r1r2r3);
+            STORE_SI128(g + (i / 4), v_g0g1g2g3);
+            STORE_SI128(b + (i / 4), v_b0b1b2b3);
+            STORE_SI128(a + (i / 4), v_a0a1a2a3);
+        }
+
+        for (size_t i = last_v_idx; i < len; i += 4)
+        {
+            r[i / 4] = data[i + 0];
+            g[i / 4] = data[i + 1];
+            b[i / 4] = data[i + 2];
+            a[i / 4] = data[i + 3];
+        }
+    }
+}
+#endif
\ No newline at end of file
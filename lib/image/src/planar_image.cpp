@@ -2,28 +2,56 @@
 
 #include <ien/arithmetic.hpp>
 #include <ien/assert.hpp>
-#include <ien/base64.hpp>
 #include <ien/platform.hpp>
 #include <ien/image_ops.hpp>
+#include <ien/image_stream.hpp>
+#include <ien/internal/encode_sink_adapter.hpp>
 #include <ien/interleaved_image.hpp>
 
 #include <stb_image.h>
-#include <stb_image_resize.h>
 #include <stb_image_write.h>
 
 #include <cstring>
 #include <stdexcept>
+#include <utility>
 
 namespace ien
 {
-    planar_image::planar_image(size_t width, size_t height)
+    planar_image::planar_image(size_t width, size_t height, allocators::alloc_policy policy)
         : image(width, height, image_type::PLANAR)
-        , _data(safe_mul<size_t>(width, height))
+        , _data(safe_mul<size_t>(width, height), policy)
     { }
 
     planar_image::planar_image(const std::string& path)
         : image(image_type::PLANAR)
     {
+        // Formats with a streaming reader are decoded row by row straight into the planes,
+        // skipping the full packed copy. Only files without one go through stb, errors are not retried
+        std::unique_ptr<image_stream_reader> reader;
+        try
+        {
+            reader = open_image_reader(path);
+        }
+        catch(const unsupported_image_format&) { }
+
+        if(reader != nullptr)
+        {
+            _width = reader->width();
+            _height = reader->height();
+            _data = image_planar_data(safe_mul<size_t>(_width, _height));
+            for(size_t y = 0; y < _height; ++y)
+            {
+                const size_t offset = y * _width;
+                reader->read_row(
+                    _data.data_r() + offset,
+                    _data.data_g() + offset,
+                    _data.data_b() + offset,
+                    _data.data_a() + offset
+                );
+            }
+            return;
+        }
+
         int channels_dummy = 0;
         int w, h;
         uint8_t* packed_data = stbi_load(
@@ -105,164 +133,108 @@ namespace ien
         return result;
     }
 
-    bool planar_image::save_to_file_png(const std::string& path, int compression_level) const
-    {
-        ien::fixed_vector<uint8_t> packed_data = _data.pack_data();
-
-        stbi_write_png_compression_level = compression_level;
-        return stbi_write_png(
-            path.c_str(), 
-            static_cast<int>(_width), 
-            static_cast<int>(_height), 
-            4, 
-            packed_data.data(), 
-            static_cast<int>(_width * 4)
-        );
-    }
-
-    bool planar_image::save_to_file_jpeg(const std::string& path, int quality) const
+    // Streams the planes through an image_stream_writer, only one packed row is held at a time
+    static void encode_streamed(
+        const image_planar_data& data,
+        size_t width,
+        size_t height,
+        encode_sink& sink,
+        image_stream_format format,
+        int compression_level = 4)
     {
-        ien::fixed_vector<uint8_t> packed_data = _data.pack_data();
-        return stbi_write_jpg(
-            path.c_str(), 
-            static_cast<int>(_width), 
-            static_cast<int>(_height), 
-            4, 
-            packed_data.data(), 
-            quality
-        );
-    }
-
-    bool planar_image::save_to_file_tga(const std::string& path) const
-    {
-        ien::fixed_vector<uint8_t> packed_data = _data.pack_data();
-        return stbi_write_tga(
-            path.c_str(), 
-            static_cast<int>(_width), 
-            static_cast<int>(_height), 
-            4, 
-            packed_data.data()
-        );
-    }
-
-    static void save_to_memory_func(void* ctx, void* data, int size)
-    {
-        printf("STBI REPORTED LEN: %d\n", size);
-        auto* vec = reinterpret_cast<ien::fixed_vector<uint8_t>*>(ctx);
-        
-        *vec = ien::fixed_vector<uint8_t>(size);
-        std::memcpy(vec->data(), data, size);
+        auto writer = open_image_writer(sink, format, width, height, compression_level);
+        for(size_t y = 0; y < height; ++y)
+        {
+            const size_t offset = y * width;
+            writer->write_row(
+                data.cdata_r() + offset,
+                data.cdata_g() + offset,
+                data.cdata_b() + offset,
+                data.cdata_a() + offset
+            );
+        }
+        writer->finish();
     }
 
-    ien::fixed_vector<uint8_t> planar_image::save_to_memory_png(int compression_level) const
+    void planar_image::encode_png(encode_sink& sink, int compression_level) const
     {
+#if defined(LIEN_IMAGE_ZLIB)
+        encode_streamed(_data, _width, _height, sink, image_stream_format::PNG, compression_level);
+#else
         ien::fixed_vector<uint8_t> packed_data = _data.pack_data();
 
-        ien::fixed_vector<uint8_t> result;
-
+        _internal::encode_sink_adapter adapter(sink);
         stbi_write_png_compression_level = compression_level;
         bool ok = stbi_write_png_to_func(
-            save_to_memory_func, 
-            reinterpret_cast<void*>(&result), 
+            &_internal::encode_sink_adapter::write_callback,
+            adapter.context(),
             static_cast<int>(_width), 
             static_cast<int>(_height), 
             4, 
             packed_data.data(), 
             static_cast<int>(_width * 4)
         );
-
-        if(!ok) { throw std::runtime_error("Failed to write png data to memory"); }
-
-        return result;
+        adapter.finish(ok, "png");
+#endif
     }
 
-    ien::fixed_vector<uint8_t> planar_image::save_to_memory_jpeg(int quality) const
+    void planar_image::encode_jpeg(encode_sink& sink, int quality) const
     {
         ien::fixed_vector<uint8_t> packed_data = _data.pack_data();
 
-        ien::fixed_vector<uint8_t> result;
-        stbi_write_jpg_to_func(
-            save_to_memory_func,
-            reinterpret_cast<void*>(&result), 
+        _internal::encode_sink_adapter adapter(sink);
+        bool ok = stbi_write_jpg_to_func(
+            &_internal::encode_sink_adapter::write_callback,
+            adapter.context(),
             static_cast<int>(_width), 
             static_cast<int>(_height),
             4,
             packed_data.data(),
             quality
         );
-        return result;
+        adapter.finish(ok, "jpeg");
     }
 
-    ien::fixed_vector<uint8_t> planar_image::save_to_memory_tga() const
+    void planar_image::encode_tga(encode_sink& sink) const
     {
-        ien::fixed_vector<uint8_t> packed_data = _data.pack_data();
-
-        ien::fixed_vector<uint8_t> result;
-        stbi_write_tga_to_func(
-            save_to_memory_func,
-            reinterpret_cast<void*>(&result), 
-            static_cast<int>(_width), 
-            static_cast<int>(_height),
-            4,
-            packed_data.data()
-        );
-        return result;
+        encode_streamed(_data, _width, _height, sink, image_stream_format::TGA);
     }
 
-    void planar_image::resize_absolute(size_t w, size_t h)
+    void planar_image::resize_absolute(size_t w, size_t h, resize_filter filter)
     {
-        const ien::fixed_vector<uint8_t> packed_data = _data.pack_data();
-        _data.resize(safe_mul<size_t>(w, h)); // realloc unpacked data buffers
-        
-        std::vector<uint8_t> resized_packed_data;
-        resized_packed_data.resize(safe_mul<size_t>(w, h, 4));
-
-        stbir_resize_uint8(
-            packed_data.cdata(), 
-            static_cast<int>(_width), 
-            static_cast<int>(_height), 
-            4, 
-            resized_packed_data.data(),
-            static_cast<int>(w), 
-            static_cast<int>(h), 
-            4, 
-            4
-        );
-        
-        uint8_t* r = _data.data_r();
-        uint8_t* g = _data.data_g();
-        uint8_t* b = _data.data_b();
-        uint8_t* a = _data.data_a();
-
-        for(size_t i = 0; i < (size_t(w) * h); ++i)
-        {
-            r[i] = resized_packed_data[(i * 4) + 0];
-            g[i] = resized_packed_data[(i * 4) + 1];
-            b[i] = resized_packed_data[(i * 4) + 2];
-            a[i] = resized_packed_data[(i * 4) + 3];
-        }
+        *this = image_ops::resize(*this, w, h, filter);
     }
 
-    void planar_image::resize_relative(float w, float h)
+    void planar_image::resize_relative(float w, float h, resize_filter filter)
     {
-        int real_w = static_cast<int>(safe_mul<float>(_width, w));
-        int real_h = static_cast<int>(safe_mul<float>(_height, h));
+        size_t real_w = static_cast<size_t>(safe_mul<float>(_width, w));
+        size_t real_h = static_cast<size_t>(safe_mul<float>(_height, h));
 
-        resize_absolute(real_w, real_h);
+        resize_absolute(real_w, real_h, filter);
     }
 
     interleaved_image planar_image::to_interleaved_image()
     {
-        auto packed_data = _data.pack_data();
-        interleaved_image result(_width, _height);
-        std::copy(packed_data.begin(), packed_data.end(), result.data());
-        return result;
+        return interleaved_image(_data.pack_data(), _width, _height);
     }
 
     std::string planar_image::to_png_base64(int comp_level)
     {
-        ien::fixed_vector<uint8_t> data = save_to_memory_png(comp_level);
-        return ien::base64::encode(data.cdata(), data.size());
+        class string_sink : public encode_sink
+        {
+        public:
+            std::string text;
+
+            void write(const uint8_t* data, size_t len) override
+            {
+                text.append(reinterpret_cast<const char*>(data), len);
+            }
+        };
+
+        // The PNG is base64 encoded as it is produced, only the resulting text is held whole
+        string_sink sink;
+        encode_png_base64(sink, comp_level);
+        return std::move(sink.text);
     }
 
     planar_image& planar_image::operator=(const planar_image& cp_src)
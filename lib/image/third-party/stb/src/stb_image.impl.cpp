@@ -10,4 +10,23 @@
 #define STBI_FREE(ptr) ien::aligned_free(ptr)
 #define STBI_REALLOC(ptr, sz) ien::aligned_realloc(ptr, sz, LIEN_DEFAULT_ALIGNMENT)
 
+#include <algorithm>
+#include <cstring>
+
+// aligned_realloc does not preserve contents, the decoders growing their buffers need a copying realloc
+static void* lien_stbi_realloc_sized(void* ptr, size_t old_size, size_t new_size)
+{
+    uint8_t* result = ien::aligned_alloc(new_size, LIEN_DEFAULT_ALIGNMENT);
+    if(result == nullptr) { return nullptr; }
+
+    if(ptr != nullptr)
+    {
+        std::memcpy(result, ptr, std::min(old_size, new_size));
+        ien::aligned_free(ptr);
+    }
+    return result;
+}
+
+#define STBI_REALLOC_SIZED(ptr, oldsz, newsz) lien_stbi_realloc_sized(ptr, oldsz, newsz)
+
 #include "stb_image.h"
\ No newline at end of file
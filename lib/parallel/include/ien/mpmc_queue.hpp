@@ -0,0 +1,127 @@
+#pragma once
+
+#include <ien/platform.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ien
+{
+    // Bounded lock-free multi-producer/multi-consumer queue (Vyukov's sequenced ring buffer).
+    // Capacity is rounded up to the next power of two.
+    template<typename T>
+    class mpmc_queue
+    {
+        static_assert(std::is_default_constructible_v<T>, "mpmc_queue requires a default constructible type");
+
+    private:
+        struct cell
+        {
+            std::atomic<size_t> sequence;
+            T data;
+        };
+
+        std::unique_ptr<cell[]> _cells;
+        size_t _mask;
+
+        alignas(LIEN_CACHE_LINE_SIZE) std::atomic<size_t> _enqueue_pos;
+        alignas(LIEN_CACHE_LINE_SIZE) std::atomic<size_t> _dequeue_pos;
+
+    public:
+        mpmc_queue(size_t capacity)
+            : _enqueue_pos(0)
+            , _dequeue_pos(0)
+        {
+            if(capacity == 0)
+            {
+                throw std::invalid_argument("Invalid queue capacity!");
+            }
+
+            size_t real_capacity = 1;
+            while(real_capacity < capacity) { real_capacity <<= 1; }
+
+            _cells = std::make_unique<cell[]>(real_capacity);
+            _mask = real_capacity - 1;
+
+            for(size_t i = 0; i < real_capacity; ++i)
+            {
+                _cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        mpmc_queue(const mpmc_queue&) = delete;
+        mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+        template<typename U>
+        [[nodiscard]] bool try_push(U&& value)
+        {
+            cell* target;
+            size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+            while(true)
+            {
+                target = &_cells[pos & _mask];
+                size_t seq = target->sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+                if(diff == 0)
+                {
+                    if(_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if(diff < 0)
+                {
+                    return false; // full
+                }
+                else
+                {
+                    pos = _enqueue_pos.load(std::memory_order_relaxed);
+                }
+            }
+
+            target->data = std::forward<U>(value);
+            target->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        [[nodiscard]] bool try_pop(T& out)
+        {
+            cell* target;
+            size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+            while(true)
+            {
+                target = &_cells[pos & _mask];
+                size_t seq = target->sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+
+                if(diff == 0)
+                {
+                    if(_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if(diff < 0)
+                {
+                    return false; // empty
+                }
+                else
+                {
+                    pos = _dequeue_pos.load(std::memory_order_relaxed);
+                }
+            }
+
+            out = std::move(target->data);
+            target->data = T();
+            target->sequence.store(pos + _mask + 1, std::memory_order_release);
+            return true;
+        }
+
+        size_t capacity() const noexcept { return _mask + 1; }
+    };
+}
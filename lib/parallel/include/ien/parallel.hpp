@@ -1,7 +1,14 @@
 #pragma once
 
+#include <ien/thread_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <stdexcept>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
 namespace ien
@@ -17,6 +24,87 @@ namespace ien
         parallel_for_params(long vcount) noexcept : count(vcount) { }
     };
 
+    struct parallel_for_range_params
+    {
+        long offset = 0;
+        long count = 0;
+        long grain_size = 0; // 0 -> automatic
+        unsigned int max_threads = std::thread::hardware_concurrency();
+
+        parallel_for_range_params() noexcept { }
+        parallel_for_range_params(long vcount) noexcept : count(vcount) { }
+        parallel_for_range_params(long vcount, long vgrain) noexcept : count(vcount), grain_size(vgrain) { }
+    };
+
     using parallel_for_pred_t = std::function<void(long)>;
     extern void parallel_for(parallel_for_params desc, parallel_for_pred_t pred, bool detached = false);
+    extern void parallel_for(thread_pool& pool, parallel_for_params desc, parallel_for_pred_t pred, bool detached = false);
+
+    namespace _internal
+    {
+        // Runs task(0) .. task(task_count - 1) on the pool, waiting for completion unless detached
+        extern void parallel_run(
+            thread_pool& pool,
+            unsigned int task_count,
+            std::function<void(unsigned int)> task,
+            bool detached
+        );
+    }
+
+    // Invokes body(begin, end) over [offset, offset + count) split in grain-sized chunks.
+    // Chunks are handed out dynamically, so uneven per-chunk costs get balanced across workers.
+    template<typename TBody>
+    void parallel_for_range(thread_pool& pool, parallel_for_range_params params, TBody&& body, bool detached = false)
+    {
+        static_assert(std::is_invocable_v<TBody&, long, long>, "Range body must be invocable as body(long begin, long end)");
+
+        if (params.count <= 0) { return; }
+        if (params.max_threads == 0)
+        {
+            throw std::invalid_argument("Invalid max threads count!");
+        }
+
+        const long grain = (params.grain_size > 0)
+            ? params.grain_size
+            : std::max(1L, params.count / (static_cast<long>(params.max_threads) * 4));
+
+        const long begin = params.offset;
+        const long end = params.offset + params.count;
+        const long chunk_count = (params.count + grain - 1) / grain;
+        const unsigned int task_count = static_cast<unsigned int>(
+            std::min(static_cast<long>(params.max_threads), chunk_count)
+        );
+
+        if (task_count == 1 && !detached)
+        {
+            for (long chunk_begin = begin; chunk_begin < end; chunk_begin += grain)
+            {
+                body(chunk_begin, std::min(chunk_begin + grain, end));
+            }
+            return;
+        }
+
+        struct range_state
+        {
+            std::decay_t<TBody> body;
+            std::atomic<long> next_chunk;
+        };
+        auto state = std::shared_ptr<range_state>(new range_state{ std::forward<TBody>(body), 0 });
+
+        _internal::parallel_run(pool, task_count, [state, begin, end, grain, chunk_count](unsigned int)
+        {
+            long chunk;
+            while ((chunk = state->next_chunk++) < chunk_count)
+            {
+                const long chunk_begin = begin + (chunk * grain);
+                state->body(chunk_begin, std::min(chunk_begin + grain, end));
+            }
+        }, detached);
+    }
+
+    template<typename TBody>
+    void parallel_for_range(parallel_for_range_params params, TBody&& body, bool detached = false)
+    {
+        parallel_for_range(default_thread_pool(), params, std::forward<TBody>(body), detached);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <ien/parallel.hpp>
+#include <ien/platform.hpp>
+#include <ien/thread_pool.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ien
+{
+    namespace _internal
+    {
+        // Per-task partial result, padded so that neighbouring partials never share a cache line
+        template<typename T>
+        struct alignas(LIEN_CACHE_LINE_SIZE) padded_partial
+        {
+            T value;
+        };
+
+        // Inputs smaller than this per block are not worth splitting
+        constexpr long PARALLEL_NUMERIC_MIN_BLOCK = 1024;
+
+        inline long numeric_block_count(long len, unsigned int max_threads)
+        {
+            long blocks = std::min(static_cast<long>(std::max(max_threads, 1u)), len / PARALLEL_NUMERIC_MIN_BLOCK);
+            return std::max(blocks, 1L);
+        }
+
+        inline long numeric_block_begin(long block, long block_count, long len)
+        {
+            return (len / block_count) * block + std::min(block, len % block_count);
+        }
+    }
+
+    // Blocks are reduced in order, so 'op' only needs to be associative
+    template<typename TIter, typename T, typename TReduceOp, typename TTransformOp>
+    T parallel_transform_reduce(
+        thread_pool& pool,
+        TIter first,
+        TIter last,
+        T init,
+        TReduceOp reduce_op,
+        TTransformOp transform_op,
+        unsigned int max_threads = std::thread::hardware_concurrency())
+    {
+        const long len = static_cast<long>(std::distance(first, last));
+        if (len == 0) { return init; }
+
+        const long block_count = _internal::numeric_block_count(len, max_threads);
+        if (block_count == 1)
+        {
+            for (; first != last; ++first)
+            {
+                init = reduce_op(init, transform_op(*first));
+            }
+            return init;
+        }
+
+        std::vector<_internal::padded_partial<T>> partials(block_count, { init });
+
+        _internal::parallel_run(pool, static_cast<unsigned int>(block_count), [&](unsigned int block)
+        {
+            const long begin = _internal::numeric_block_begin(block, block_count, len);
+            const long end = _internal::numeric_block_begin(block + 1, block_count, len);
+
+            TIter it = std::next(first, begin);
+            T acc = transform_op(*it);
+            for (long i = begin + 1; i < end; ++i)
+            {
+                acc = reduce_op(acc, transform_op(*(++it)));
+            }
+            partials[block].value = std::move(acc);
+        }, false);
+
+        for (const auto& partial : partials)
+        {
+            init = reduce_op(init, partial.value);
+        }
+        return init;
+    }
+
+    template<typename TIter, typename T, typename TReduceOp, typename TTransformOp>
+    T parallel_transform_reduce(
+        TIter first,
+        TIter last,
+        T init,
+        TReduceOp reduce_op,
+        TTransformOp transform_op,
+        unsigned int max_threads = std::thread::hardware_concurrency())
+    {
+        return parallel_transform_reduce(default_thread_pool(), first, last, init, reduce_op, transform_op, max_threads);
+    }
+
+    template<typename TIter, typename T, typename TReduceOp>
+    T parallel_reduce(
+        thread_pool& pool,
+        TIter first,
+        TIter last,
+        T init,
+        TReduceOp reduce_op,
+        unsigned int max_threads = std::thread::hardware_concurrency())
+    {
+        return parallel_transform_reduce(pool, first, last, init, reduce_op, [](const auto& v) { return v; }, max_threads);
+    }
+
+    template<typename TIter, typename T, typename TReduceOp>
+    T parallel_reduce(
+        TIter first,
+        TIter last,
+        T init,
+        TReduceOp reduce_op,
+        unsigned int max_threads = std::thread::hardware_concurrency())
+    {
+        return parallel_reduce(default_thread_pool(), first, last, init, reduce_op, max_threads);
+    }
+
+    namespace _internal
+    {
+        // Three pass scan: reduce every block, scan the block sums serially, then scan every block
+        // seeded with its prefix. 'd_first' may be equal to 'first'.
+        template<bool Inclusive, typename TInIter, typename TOutIter, typename T, typename TBinaryOp>
+        TOutIter parallel_scan(
+            thread_pool& pool,
+            TInIter first,
+            TInIter last,
+            TOutIter d_first,
+            T init,
+            bool has_init,
+            TBinaryOp op,
+            unsigned int max_threads)
+        {
+            const long len = static_cast<long>(std::distance(first, last));
+            if (len == 0) { return d_first; }
+
+            auto scan_block = [&](long begin, long end, bool seeded, T acc)
+            {
+                TInIter it = std::next(first, begin);
+                TOutIter out = std::next(d_first, begin);
+                for (long i = begin; i < end; ++i, ++it, ++out)
+                {
+                    T value = *it;
+                    if constexpr (Inclusive)
+                    {
+                        acc = seeded ? op(acc, value) : value;
+                        seeded = true;
+                        *out = acc;
+                    }
+                    else
+                    {
+                        *out = acc;
+                        acc = op(acc, value);
+                    }
+                }
+            };
+
+            const long block_count = numeric_block_count(len, max_threads);
+            if (block_count == 1)
+            {
+                scan_block(0, len, has_init, init);
+                return std::next(d_first, len);
+            }
+
+            std::vector<padded_partial<T>> partials(block_count, { init });
+
+            parallel_run(pool, static_cast<unsigned int>(block_count), [&](unsigned int block)
+            {
+                const long begin = numeric_block_begin(block, block_count, len);
+                const long end = numeric_block_begin(block + 1, block_count, len);
+
+                TInIter it = std::next(first, begin);
+                T acc = *it;
+                for (long i = begin + 1; i < end; ++i)
+                {
+                    acc = op(acc, *(++it));
+                }
+                partials[block].value = std::move(acc);
+            }, false);
+
+            // Turn block sums into block prefixes
+            std::vector<padded_partial<T>> prefixes(block_count, { init });
+            T running = init;
+            for (long block = 0; block < block_count; ++block)
+            {
+                prefixes[block].value = running;
+                running = (block == 0 && !has_init)
+                    ? partials[block].value
+                    : op(running, partials[block].value);
+            }
+
+            parallel_run(pool, static_cast<unsigned int>(block_count), [&](unsigned int block)
+            {
+                const long begin = numeric_block_begin(block, block_count, len);
+                const long end = numeric_block_begin(block + 1, block_count, len);
+                scan_block(begin, end, (block != 0) || has_init, prefixes[block].value);
+            }, false);
+
+            return std::next(d_first, len);
+        }
+    }
+
+    template<typename TInIter, typename TOutIter, typename TBinaryOp>
+    TOutIter parallel_inclusive_scan(
+        thread_pool& pool,
+        TInIter first,
+        TInIter last,
+        TOutIter d_first,
+        TBinaryOp op,
+        unsigned int max_threads = std::thread::hardware_concurrency())
+    {
+        using value_t = typename std::iterator_traits<TInIter>::value_type;
+        return _internal::parallel_scan<true>(pool, first, last, d_first, value_t{}, false, op, max_threads);
+    }
+
+    template<typename TInIter, typename TOutIter, typename TBinaryOp>
+    TOutIter parallel_inclusive_scan(
+        TInIter first,
+        TInIter last,
+        TOutIter d_first,
+        TBinaryOp op,
+        unsigned int max_threads = std::thread::hardware_concurrency())
+    {
+        return parallel_inclusive_scan(default_thread_pool(), first, last, d_first, op, max_threads);
+    }
+
+    template<typename TInIter, typename TOutIter, typename T, typename TBinaryOp>
+    TOutIter parallel_exclusive_scan(
+        thread_pool& pool,
+        TInIter first,
+        TInIter last,
+        TOutIter d_first,
+        T init,
+        TBinaryOp op,
+        unsigned int max_threads = std::thread::hardware_concurrency())
+    {
+        return _internal::parallel_scan<false>(pool, first, last, d_first, init, true, op, max_threads);
+    }
+
+    template<typename TInIter, typename TOutIter, typename T, typename TBinaryOp>
+    TOutIter parallel_exclusive_scan(
+        TInIter first,
+        TInIter last,
+        TOutIter d_first,
+        T init,
+        TBinaryOp op,
+        unsigned int max_threads = std::thread::hardware_concurrency())
+    {
+        return parallel_exclusive_scan(default_thread_pool(), first, last, d_first, init, op, max_threads);
+    }
+}
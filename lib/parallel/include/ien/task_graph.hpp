@@ -0,0 +1,164 @@
+#pragma once
+
+#include <ien/task_queue.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace ien
+{
+    namespace _internal
+    {
+        struct task_graph_state
+        {
+            size_t outstanding = 0;
+            std::mutex mux;
+            std::condition_variable cv;
+        };
+
+        class task_graph_node
+        {
+        private:
+            std::mutex _mux;
+            std::vector<std::shared_ptr<task_graph_node>> _dependents;
+            std::atomic<size_t> _pending_dependencies;
+            bool _finished = false;
+            task_t _body;
+            task_queue* _queue;
+
+        public:
+            task_graph_node(task_queue* queue, task_t body, size_t dependency_count);
+
+            // Registers 'node' to be notified on completion, or notifies it right away if already finished
+            void add_dependent(const std::shared_ptr<task_graph_node>& node);
+
+            // Returns true once every dependency has finished
+            bool dependency_finished();
+
+            // Submits a ready node from outside the workers, waits for a free slot if the queue is full
+            static void submit(const std::shared_ptr<task_graph_node>& node);
+
+        private:
+            // Runs on a worker. Dependents made ready are queued without waiting,
+            // those that do not fit run right here instead
+            static void run(std::shared_ptr<task_graph_node> node);
+
+            // Returns the dependents made ready
+            std::vector<std::shared_ptr<task_graph_node>> execute();
+        };
+    }
+
+    template<typename T>
+    class task_future
+    {
+        friend class task_graph;
+
+    private:
+        std::shared_ptr<_internal::task_graph_node> _node;
+        std::shared_future<T> _future;
+
+    public:
+        task_future() = default;
+
+        // Rethrows the exception thrown by the task, if any
+        decltype(auto) get() const { return _future.get(); }
+
+        void wait() const { _future.wait(); }
+
+        bool is_ready() const
+        {
+            return _future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }
+
+        bool valid() const noexcept { return _future.valid(); }
+    };
+
+    // Schedules tasks on a task_queue as soon as the tasks they depend on have finished.
+    // Task results are exposed through task_future, an exception thrown by a task is stored
+    // in its future and resurfaces in every dependent calling get() on it.
+    class task_graph
+    {
+    private:
+        task_queue& _queue;
+        std::shared_ptr<_internal::task_graph_state> _state;
+
+    public:
+        task_graph(task_queue& queue);
+
+        task_graph(const task_graph&) = delete;
+        task_graph& operator=(const task_graph&) = delete;
+
+        template<typename TFunc, typename ... TDeps>
+        auto emplace(TFunc&& func, const task_future<TDeps>& ... dependencies)
+            -> task_future<std::invoke_result_t<std::decay_t<TFunc>&>>
+        {
+            using result_t = std::invoke_result_t<std::decay_t<TFunc>&>;
+
+            if(((dependencies._node == nullptr) || ...))
+            {
+                throw std::invalid_argument("task_graph::emplace: dependency on a default-constructed task_future");
+            }
+
+            auto promise = std::make_shared<std::promise<result_t>>();
+
+            task_future<result_t> result;
+            result._future = promise->get_future().share();
+
+            {
+                std::lock_guard lock(_state->mux);
+                ++_state->outstanding;
+            }
+
+            task_t body = [promise, state = _state, func = std::forward<TFunc>(func)]() mutable
+            {
+                try
+                {
+                    if constexpr (std::is_void_v<result_t>)
+                    {
+                        func();
+                        promise->set_value();
+                    }
+                    else
+                    {
+                        promise->set_value(func());
+                    }
+                }
+                catch(...)
+                {
+                    promise->set_exception(std::current_exception());
+                }
+
+                std::lock_guard lock(state->mux);
+                if(--state->outstanding == 0) { state->cv.notify_all(); }
+            };
+
+            // One extra pending dependency guards against submission before every edge is registered
+            result._node = std::make_shared<_internal::task_graph_node>(
+                &_queue,
+                std::move(body),
+                sizeof...(TDeps) + 1
+            );
+
+            (dependencies._node->add_dependent(result._node), ...);
+            if(result._node->dependency_finished())
+            {
+                _internal::task_graph_node::submit(result._node);
+            }
+
+            return result;
+        }
+
+        // Waits for every task emplaced so far. Must not be called from a task.
+        void wait();
+
+        size_t pending() const;
+    };
+}
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <ien/mpmc_queue.hpp>
+
 #include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <mutex>
+#include <stdexcept>
 #include <thread>
 #include <type_traits>
 #include <vector>
@@ -10,36 +14,90 @@
 namespace ien
 {
     typedef std::function<void()> task_t;
+
+    enum class task_queue_wait_policy
+    {
+        BLOCKING,   // Idle workers and waiters sleep on a condition variable
+        SPINNING    // Idle workers and waiters busy-wait, yielding their time slice
+    };
+
     class task_queue
     {
     private:
-        std::vector<task_t> _tasks;
-        std::atomic<int> _current_task = 0;
+        mpmc_queue<task_t> _tasks;
         std::vector<std::thread> _threads;
+        std::atomic<size_t> _queued = 0;
+        std::atomic<size_t> _unfinished = 0;
+        std::atomic<bool> _stop = false;
         std::mutex _run_mux;
+        std::mutex _wait_mux;
+        std::condition_variable _work_cv;
+        std::condition_variable _idle_cv;
         size_t _max_concurrent;
+        task_queue_wait_policy _wait_policy;
         bool _detached = false;
-        bool _started = false;
+        std::atomic<bool> _started = false;
 
     public:
-        task_queue(size_t max_concurrent_tasks = std::thread::hardware_concurrency()) noexcept;
+        task_queue(
+            size_t max_concurrent_tasks = std::thread::hardware_concurrency(),
+            size_t capacity = 1024,
+            task_queue_wait_policy wait_policy = task_queue_wait_policy::BLOCKING
+        );
+        ~task_queue();
 
+        task_queue(const task_queue&) = delete;
+        task_queue& operator=(const task_queue&) = delete;
+
+        // Safe to call from any thread, including running tasks.
+        // Waits for a free slot when the queue is full and workers are running,
+        // throws when it is full before run(). Every submission after join() throws
         template<typename TTask>
         void emplace_back(TTask&& task)
         {
             static_assert(
-                std::is_same_v<std::decay_t<TTask>, task_t>, 
+                std::is_constructible_v<task_t, TTask&&>,
+                "Not a valid task type"
+            );
+
+            task_t wrapped(std::forward<TTask>(task));
+            while(!push_task(wrapped))
+            {
+                if(!_started)
+                {
+                    throw std::length_error("Task queue capacity exceeded before run()");
+                }
+                std::this_thread::yield();
+            }
+        }
+
+        // Returns false instead of waiting when the queue is full, throws after join()
+        template<typename TTask>
+        [[nodiscard]] bool try_emplace_back(TTask&& task)
+        {
+            static_assert(
+                std::is_constructible_v<task_t, TTask&&>,
                 "Not a valid task type"
             );
-            _tasks.push_back(std::forward(task));
+
+            task_t wrapped(std::forward<TTask>(task));
+            return push_task(wrapped);
         }
 
         void run(bool detached = false);
+
+        // Waits for every task and stops the workers, throws if tasks are queued and run() was never called
         void join();
 
+        // Blocks until every submitted task has finished. Must not be called from a task.
+        void wait_idle();
+
+        size_t capacity() const noexcept;
+
     private:
-        const task_t* dequeue_task();
         void worker_thread();
         void join_threads();
+        bool push_task(task_t& task);
+        void task_finished();
     };
 }
\ No newline at end of file
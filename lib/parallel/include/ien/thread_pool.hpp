@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ien
+{
+    typedef std::function<void()> task_t;
+
+    // Fixed set of worker threads, each one owning a task deque.
+    // Workers pop from the back of their own deque and steal from the front of the others.
+    class thread_pool
+    {
+    private:
+        struct worker_queue
+        {
+            std::deque<task_t> tasks;
+            std::mutex mux;
+        };
+
+        std::vector<std::unique_ptr<worker_queue>> _queues;
+        std::vector<std::thread> _threads;
+        std::atomic<size_t> _pending = 0;
+        std::atomic<size_t> _next_queue = 0;
+        std::mutex _sleep_mux;
+        std::condition_variable _sleep_cv;
+        bool _stop = false;
+
+    public:
+        thread_pool(size_t thread_count = std::thread::hardware_concurrency());
+        ~thread_pool();
+
+        thread_pool(const thread_pool&) = delete;
+        thread_pool(thread_pool&&) = delete;
+
+        thread_pool& operator=(const thread_pool&) = delete;
+        thread_pool& operator=(thread_pool&&) = delete;
+
+        void submit(task_t task);
+
+        // Runs a single queued task on the calling thread, if there is any.
+        // Lets threads waiting on pool work help instead of blocking.
+        bool run_pending_task();
+
+        size_t thread_count() const noexcept;
+
+    private:
+        bool pop_task(size_t queue_index, task_t& task);
+        bool steal_task(size_t thief_index, task_t& task);
+        void worker_thread(size_t index);
+        long current_worker_index() const noexcept;
+    };
+
+    // Lazily initialized pool shared by the parallel utilities
+    extern thread_pool& default_thread_pool();
+}
@@ -1,9 +1,22 @@
 #include <ien/parallel.hpp>
+
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 
 namespace ien
 {
-    void parallel_for_worker(long offset, long count, long stride, parallel_for_pred_t pred)
+    struct parallel_run_sync
+    {
+        unsigned int remaining = 0;
+        std::exception_ptr exception;
+        std::mutex mux;
+        std::condition_variable cv;
+    };
+
+    void parallel_for_worker(long offset, long count, long stride, const parallel_for_pred_t& pred)
     {
         long current_count = 0;
         while (current_count < count)
@@ -15,6 +28,11 @@ namespace ien
     }
 
     void parallel_for(parallel_for_params params, parallel_for_pred_t pred, bool detached)
+    {
+        parallel_for(default_thread_pool(), params, std::move(pred), detached);
+    }
+
+    void parallel_for(thread_pool& pool, parallel_for_params params, parallel_for_pred_t pred, bool detached)
     {
         if (params.count == 0) { return; }
         if (params.max_threads == 0)
@@ -22,34 +40,63 @@ namespace ien
             throw std::invalid_argument("Invalid max threads count!");
         }
 
-        std::vector<std::thread> threads;
-        threads.reserve(params.max_threads);
+        const long segment_count = static_cast<long>(params.max_threads);
+        const long segment_size = params.count / segment_count;
+        const long last_segsz = segment_size + (params.count % segment_count);
+
+        _internal::parallel_run(pool, params.max_threads, [=, pred = std::move(pred)](unsigned int i)
+        {
+            const long segment_offset = params.offset + (static_cast<long>(i) * segment_size * params.stride);
+            const long segsz = (i == params.max_threads - 1) ? last_segsz : segment_size;
+            parallel_for_worker(segment_offset, segsz, params.stride, pred);
+        }, detached);
+    }
+
+    void _internal::parallel_run(
+        thread_pool& pool,
+        unsigned int task_count,
+        std::function<void(unsigned int)> task,
+        bool detached)
+    {
+        if (task_count == 0) { return; }
 
-        const int segment_size = params.count / params.max_threads;
+        auto shared_task = std::make_shared<std::function<void(unsigned int)>>(std::move(task));
+        auto sync = std::make_shared<parallel_run_sync>();
+        sync->remaining = task_count;
 
-        for (unsigned int i = 0; i < params.max_threads - 1; ++i)
+        for (unsigned int i = 0; i < task_count; ++i)
         {
-            int offset = i * segment_size;
-            threads.push_back(
-                std::thread(&parallel_for_worker, offset, segment_size, params.stride, pred)
-            );
+            pool.submit([shared_task, sync, i]
+            {
+                std::exception_ptr ex;
+                try { (*shared_task)(i); }
+                catch(...) { ex = std::current_exception(); }
+
+                std::lock_guard lock(sync->mux);
+                if (ex && !sync->exception) { sync->exception = ex; }
+                if (--sync->remaining == 0) { sync->cv.notify_all(); }
+            });
         }
 
-        int last_offset = (params.max_threads - 1) * segment_size;
-        int last_segsz = segment_size + (params.count % params.max_threads);
-        threads.push_back(
-            std::thread(&parallel_for_worker, last_offset, last_segsz, params.stride, pred)
-        );
+        if (detached) { return; }
 
-        if (detached) {
-            for (unsigned int i = 0; i < params.max_threads; ++i) {
-                threads[i].detach();
+        // Help the pool run queued work instead of idling, this also keeps
+        // nested calls from pool workers from starving it
+        while (true)
+        {
+            {
+                std::lock_guard lock(sync->mux);
+                if (sync->remaining == 0) { break; }
             }
-        }
-        else {
-            for (unsigned int i = 0; i < params.max_threads; ++i) {
-                threads[i].join();
+
+            if (!pool.run_pending_task())
+            {
+                std::unique_lock lock(sync->mux);
+                sync->cv.wait(lock, [&]{ return sync->remaining == 0; });
+                break;
             }
         }
+
+        if (sync->exception) { std::rethrow_exception(sync->exception); }
     }
-}
\ No newline at end of file
+}
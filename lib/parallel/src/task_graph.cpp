@@ -0,0 +1,97 @@
+#include <ien/task_graph.hpp>
+
+namespace ien
+{
+    namespace _internal
+    {
+        task_graph_node::task_graph_node(task_queue* queue, task_t body, size_t dependency_count)
+            : _pending_dependencies(dependency_count)
+            , _body(std::move(body))
+            , _queue(queue)
+        { }
+
+        void task_graph_node::add_dependent(const std::shared_ptr<task_graph_node>& node)
+        {
+            {
+                std::lock_guard lock(_mux);
+                if(!_finished)
+                {
+                    _dependents.push_back(node);
+                    return;
+                }
+            }
+            // Never the last one, emplace() holds an extra dependency until every edge is registered
+            node->dependency_finished();
+        }
+
+        bool task_graph_node::dependency_finished()
+        {
+            return --_pending_dependencies == 0;
+        }
+
+        void task_graph_node::submit(const std::shared_ptr<task_graph_node>& node)
+        {
+            node->_queue->emplace_back([node]{ run(node); });
+        }
+
+        void task_graph_node::run(std::shared_ptr<task_graph_node> node)
+        {
+            // Waiting for a free slot here could stall every worker at once, nothing would pop
+            std::vector<std::shared_ptr<task_graph_node>> overflow;
+            overflow.push_back(std::move(node));
+            while(!overflow.empty())
+            {
+                std::shared_ptr<task_graph_node> current = std::move(overflow.back());
+                overflow.pop_back();
+
+                for(auto& ready : current->execute())
+                {
+                    if(!current->_queue->try_emplace_back([ready]{ run(ready); }))
+                    {
+                        overflow.push_back(std::move(ready));
+                    }
+                }
+            }
+        }
+
+        std::vector<std::shared_ptr<task_graph_node>> task_graph_node::execute()
+        {
+            _body();
+            _body = nullptr;
+
+            std::vector<std::shared_ptr<task_graph_node>> dependents;
+            {
+                std::lock_guard lock(_mux);
+                _finished = true;
+                dependents.swap(_dependents);
+            }
+
+            std::vector<std::shared_ptr<task_graph_node>> ready;
+            for(auto& node : dependents)
+            {
+                if(node->dependency_finished())
+                {
+                    ready.push_back(std::move(node));
+                }
+            }
+            return ready;
+        }
+    }
+
+    task_graph::task_graph(task_queue& queue)
+        : _queue(queue)
+        , _state(std::make_shared<_internal::task_graph_state>())
+    { }
+
+    void task_graph::wait()
+    {
+        std::unique_lock lock(_state->mux);
+        _state->cv.wait(lock, [this]{ return _state->outstanding == 0; });
+    }
+
+    size_t task_graph::pending() const
+    {
+        std::lock_guard lock(_state->mux);
+        return _state->outstanding;
+    }
+}
@@ -3,10 +3,20 @@
 
 namespace ien
 {
-    task_queue::task_queue(size_t max_concurrent_tasks) noexcept
-        : _max_concurrent(max_concurrent_tasks)
+    task_queue::task_queue(size_t max_concurrent_tasks, size_t capacity, task_queue_wait_policy wait_policy)
+        : _tasks(capacity)
+        , _max_concurrent(max_concurrent_tasks)
+        , _wait_policy(wait_policy)
     { }
 
+    task_queue::~task_queue()
+    {
+        if(_started && !_threads.empty())
+        {
+            join();
+        }
+    }
+
     void task_queue::run(bool detached)
     {
         {
@@ -21,36 +31,107 @@ namespace ien
             _threads.push_back(std::thread(&task_queue::worker_thread, this));
         }
         
-        if(!_detached) { join_threads(); }
+        if(!_detached) { join(); }
     }
 
     void task_queue::join()
     {
-        if(_detached) { join_threads(); }
+        if(!_started && _unfinished > 0)
+        {
+            throw std::logic_error("Task queue joined with queued tasks before run()");
+        }
+        wait_idle();
+        join_threads();
+    }
+
+    void task_queue::wait_idle()
+    {
+        if(_wait_policy == task_queue_wait_policy::SPINNING)
+        {
+            while(_unfinished > 0) { std::this_thread::yield(); }
+            return;
+        }
+
+        std::unique_lock lock(_wait_mux);
+        _idle_cv.wait(lock, [this]{ return _unfinished == 0; });
+    }
+
+    size_t task_queue::capacity() const noexcept
+    {
+        return _tasks.capacity();
     }
 
-    const task_t* task_queue::dequeue_task()
+    bool task_queue::push_task(task_t& task)
     {
-        if(_tasks.size() > _current_task)
+        // Nothing would run it and the unfinished count would never drop back to zero
+        if(_stop)
         {
-            task_t* res = &_tasks.at(_current_task);
-            ++_current_task;
-            return res;
+            throw std::logic_error("Task queue does not accept tasks after join()");
+        }
+
+        ++_unfinished;
+        ++_queued;
+        if(!_tasks.try_push(std::move(task)))
+        {
+            --_queued;
+            --_unfinished;
+            return false;
+        }
+
+        if(_wait_policy == task_queue_wait_policy::BLOCKING)
+        {
+            // Taking the lock orders the increment before a sleeping worker re-checks its predicate
+            { std::lock_guard lock(_wait_mux); }
+            _work_cv.notify_one();
+        }
+        return true;
+    }
+
+    void task_queue::task_finished()
+    {
+        if(--_unfinished == 0 && _wait_policy == task_queue_wait_policy::BLOCKING)
+        {
+            std::lock_guard lock(_wait_mux);
+            _idle_cv.notify_all();
         }
-        return nullptr;
     }
 
     void task_queue::worker_thread()
     {
-        while(const task_t* task = dequeue_task())
+        task_t task;
+        while(true)
         {
-            if(task == nullptr) { break; }
-            (*task)();
+            if(_tasks.try_pop(task))
+            {
+                --_queued;
+                task();
+                task = nullptr;
+                task_finished();
+                continue;
+            }
+
+            if(_wait_policy == task_queue_wait_policy::SPINNING)
+            {
+                if(_stop) { return; }
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock lock(_wait_mux);
+            _work_cv.wait(lock, [this]{ return _stop || _queued > 0; });
+            if(_stop && _queued == 0) { return; }
         }
     }
 
     void task_queue::join_threads()
     {
+        {
+            std::lock_guard lock(_wait_mux);
+            _stop = true;
+        }
+        _work_cv.notify_all();
+
         for(auto& th : _threads) { th.join(); }
+        _threads.clear();
     }
 }
\ No newline at end of file
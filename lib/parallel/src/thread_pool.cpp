@@ -0,0 +1,138 @@
+#include <ien/thread_pool.hpp>
+
+#include <algorithm>
+
+namespace ien
+{
+    static thread_local const thread_pool* tl_current_pool = nullptr;
+    static thread_local size_t tl_worker_index = 0;
+
+    thread_pool::thread_pool(size_t thread_count)
+    {
+        thread_count = std::max(thread_count, static_cast<size_t>(1));
+
+        _queues.reserve(thread_count);
+        for(size_t i = 0; i < thread_count; ++i)
+        {
+            _queues.push_back(std::make_unique<worker_queue>());
+        }
+
+        _threads.reserve(thread_count);
+        for(size_t i = 0; i < thread_count; ++i)
+        {
+            _threads.push_back(std::thread(&thread_pool::worker_thread, this, i));
+        }
+    }
+
+    thread_pool::~thread_pool()
+    {
+        {
+            std::lock_guard lock(_sleep_mux);
+            _stop = true;
+        }
+        _sleep_cv.notify_all();
+
+        for(auto& th : _threads) { th.join(); }
+    }
+
+    void thread_pool::submit(task_t task)
+    {
+        long worker_idx = current_worker_index();
+        size_t queue_idx = (worker_idx >= 0)
+            ? static_cast<size_t>(worker_idx)
+            : (_next_queue++ % _queues.size());
+
+        {
+            worker_queue& queue = *_queues[queue_idx];
+            std::lock_guard lock(queue.mux);
+            queue.tasks.push_back(std::move(task));
+        }
+        ++_pending;
+
+        // Taking the lock orders the increment before a sleeping worker re-checks its predicate
+        { std::lock_guard lock(_sleep_mux); }
+        _sleep_cv.notify_one();
+    }
+
+    bool thread_pool::run_pending_task()
+    {
+        long worker_idx = current_worker_index();
+
+        task_t task;
+        bool found = (worker_idx >= 0)
+            ? (pop_task(worker_idx, task) || steal_task(worker_idx, task))
+            : steal_task(_queues.size(), task);
+
+        if(!found) { return false; }
+        task();
+        return true;
+    }
+
+    size_t thread_pool::thread_count() const noexcept
+    {
+        return _threads.size();
+    }
+
+    bool thread_pool::pop_task(size_t queue_index, task_t& task)
+    {
+        worker_queue& queue = *_queues[queue_index];
+        std::lock_guard lock(queue.mux);
+        if(queue.tasks.empty()) { return false; }
+
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        --_pending;
+        return true;
+    }
+
+    bool thread_pool::steal_task(size_t thief_index, task_t& task)
+    {
+        const size_t queue_count = _queues.size();
+        for(size_t i = 1; i <= queue_count; ++i)
+        {
+            size_t victim = (thief_index + i) % queue_count;
+            if(victim == thief_index) { continue; }
+
+            worker_queue& queue = *_queues[victim];
+            std::lock_guard lock(queue.mux);
+            if(queue.tasks.empty()) { continue; }
+
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            --_pending;
+            return true;
+        }
+        return false;
+    }
+
+    void thread_pool::worker_thread(size_t index)
+    {
+        tl_current_pool = this;
+        tl_worker_index = index;
+
+        while(true)
+        {
+            task_t task;
+            if(pop_task(index, task) || steal_task(index, task))
+            {
+                task();
+                continue;
+            }
+
+            std::unique_lock lock(_sleep_mux);
+            _sleep_cv.wait(lock, [this]{ return _stop || _pending > 0; });
+            if(_stop && _pending == 0) { return; }
+        }
+    }
+
+    long thread_pool::current_worker_index() const noexcept
+    {
+        return (tl_current_pool == this) ? static_cast<long>(tl_worker_index) : -1;
+    }
+
+    thread_pool& default_thread_pool()
+    {
+        static thread_pool pool;
+        return pool;
+    }
+}
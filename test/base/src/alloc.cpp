@@ -2,6 +2,9 @@
 
 #include <ien/alloc.hpp>
 
+#include <thread>
+#include <vector>
+
 TEST_CASE("Aligned alloc")
 {
 	SECTION("Align 2 -> 4096 bytes, 32K")
@@ -22,4 +25,36 @@ TEST_CASE("Aligned alloc")
 		uintptr_t data_ptrval = reinterpret_cast<uintptr_t>(data_ptr);
 		REQUIRE(data_ptrval % alignment == 0);
 	}
+}
+
+TEST_CASE("Aligned free")
+{
+	SECTION("Free null")
+	{
+		uint8_t* ptr = nullptr;
+		ien::aligned_free(ptr);
+	}
+
+	SECTION("Concurrent alloc/free")
+	{
+		std::vector<std::thread> threads;
+		std::vector<int> failures(4, 0);
+		for (size_t t = 0; t < failures.size(); ++t)
+		{
+			threads.emplace_back([&failures, t]
+			{
+				for (size_t i = 0; i < 10000; ++i)
+				{
+					const size_t alignment = size_t(1) << (i % 12);
+					uint32_t* ptr = ien::aligned_alloc<uint32_t>(i % 97 + 1, alignment);
+					if (reinterpret_cast<uintptr_t>(ptr) % alignment != 0) { ++failures[t]; }
+					ptr[0] = static_cast<uint32_t>(i);
+					ien::aligned_free(ptr);
+				}
+			});
+		}
+
+		for (auto& th : threads) { th.join(); }
+		for (int f : failures) { REQUIRE(f == 0); }
+	}
 }
\ No newline at end of file
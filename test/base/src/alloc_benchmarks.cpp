@@ -0,0 +1,96 @@
+#ifdef NDEBUG
+
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch2/catch.hpp>
+
+#include <ien/alloc.hpp>
+#include <ien/allocators/pool_allocator.hpp>
+
+#include <thread>
+#include <vector>
+
+static void alloc_free_loop(size_t iterations)
+{
+	for (size_t i = 0; i < iterations; ++i)
+	{
+		uint8_t* ptr = ien::aligned_alloc(64 + (i % 4096), 32);
+		ptr[0] = static_cast<uint8_t>(i);
+		ien::aligned_free(ptr);
+	}
+}
+
+static void pool_alloc_free_loop(size_t iterations)
+{
+	for (size_t i = 0; i < iterations; ++i)
+	{
+		uint8_t* ptr = reinterpret_cast<uint8_t*>(ien::allocators::pool_alloc(64 + (i % 4096), 32));
+		ptr[0] = static_cast<uint8_t>(i);
+		ien::allocators::pool_free(ptr);
+	}
+}
+
+static void threaded_alloc_free(size_t thread_count, size_t iterations, void(*loop)(size_t) = alloc_free_loop)
+{
+	std::vector<std::thread> threads;
+	for (size_t t = 0; t < thread_count; ++t)
+	{
+		threads.emplace_back(loop, iterations / thread_count);
+	}
+	for (auto& th : threads) { th.join(); }
+}
+
+TEST_CASE("Aligned alloc benchmarks")
+{
+	static const size_t ITERATIONS = 1 << 18;
+
+	BENCHMARK("aligned_alloc/free (1 thread)")
+	{
+		return threaded_alloc_free(1, ITERATIONS);
+	};
+
+	BENCHMARK("aligned_alloc/free (2 threads)")
+	{
+		return threaded_alloc_free(2, ITERATIONS);
+	};
+
+	BENCHMARK("aligned_alloc/free (4 threads)")
+	{
+		return threaded_alloc_free(4, ITERATIONS);
+	};
+
+	BENCHMARK("aligned_alloc/free (8 threads)")
+	{
+		return threaded_alloc_free(8, ITERATIONS);
+	};
+}
+
+TEST_CASE("Pool alloc benchmarks")
+{
+	static const size_t ITERATIONS = 1 << 18;
+
+	BENCHMARK("pool_alloc/free (1 thread)")
+	{
+		return threaded_alloc_free(1, ITERATIONS, pool_alloc_free_loop);
+	};
+
+	BENCHMARK("pool_alloc/free (4 threads)")
+	{
+		return threaded_alloc_free(4, ITERATIONS, pool_alloc_free_loop);
+	};
+
+	BENCHMARK("Image sized buffers: aligned_alloc/free")
+	{
+		uint8_t* ptr = ien::aligned_alloc(1920 * 1080 * 4, 32);
+		ptr[0] = 1;
+		ien::aligned_free(ptr);
+	};
+
+	BENCHMARK("Image sized buffers: pool_alloc/free")
+	{
+		uint8_t* ptr = reinterpret_cast<uint8_t*>(ien::allocators::pool_alloc(1920 * 1080 * 4, 32));
+		ptr[0] = 1;
+		ien::allocators::pool_free(ptr);
+	};
+}
+
+#endif
\ No newline at end of file
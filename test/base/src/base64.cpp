@@ -0,0 +1,235 @@
+#include <catch2/catch.hpp>
+
+#include <ien/base64.hpp>
+#include <ien/platform.hpp>
+
+#if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
+    #include <ien/internal/x86/base64_x86.hpp>
+#endif
+
+#include <cinttypes>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "utils.hpp"
+
+using namespace ien;
+
+// Bit by bit reference
+static std::string reference_encode(const std::vector<uint8_t>& data, base64::alphabet abc)
+{
+    const std::string charset = std::string("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789")
+        + ((abc == base64::alphabet::url_safe) ? "-_" : "+/");
+
+    std::string result;
+    const size_t bits = data.size() * 8;
+    for (size_t i = 0; i < bits; i += 6)
+    {
+        int index = 0;
+        for (size_t b = i; b < i + 6; ++b)
+        {
+            const int bit = (b < bits) ? ((data[b / 8] >> (7 - (b % 8))) & 1) : 0;
+            index = (index << 1) | bit;
+        }
+        result += charset[static_cast<size_t>(index)];
+    }
+    while (result.size() % 4 != 0)
+    {
+        result += '=';
+    }
+    return result;
+}
+
+static std::vector<uint8_t> decode_string(const std::string& str, base64::alphabet abc = base64::alphabet::standard)
+{
+    return base64::decode(reinterpret_cast<const uint8_t*>(str.data()), str.size(), abc);
+}
+
+static std::string to_string(const std::vector<uint8_t>& data)
+{
+    return std::string(data.begin(), data.end());
+}
+
+TEST_CASE("Base64")
+{
+    const base64::alphabet alphabets[] = { base64::alphabet::standard, base64::alphabet::url_safe };
+
+    SECTION("RFC 4648 vectors")
+    {
+        const std::pair<std::string, std::string> vectors[] = {
+            { "", "" }, { "f", "Zg==" }, { "fo", "Zm8=" }, { "foo", "Zm9v" },
+            { "foob", "Zm9vYg==" }, { "fooba", "Zm9vYmE=" }, { "foobar", "Zm9vYmFy" }
+        };
+        for (const auto& [plain, encoded] : vectors)
+        {
+            REQUIRE(base64::encode(reinterpret_cast<const uint8_t*>(plain.data()), plain.size()) == encoded);
+            REQUIRE(to_string(decode_string(encoded)) == plain);
+        }
+
+        // Unpadded input
+        REQUIRE(to_string(decode_string("Zg")) == "f");
+        REQUIRE(to_string(decode_string("Zm9vYmE")) == "fooba");
+    };
+
+    SECTION("Round trip")
+    {
+        // Lengths around every SIMD block size
+        for (size_t len = 0; len < 300; ++len)
+        {
+            const std::vector<uint8_t> data = make_random_bytes(len);
+            for (auto abc : alphabets)
+            {
+                const std::string encoded = base64::encode(data.data(), data.size(), abc);
+                REQUIRE(encoded == reference_encode(data, abc));
+                REQUIRE(decode_string(encoded, abc) == data);
+            }
+        }
+
+        const std::vector<uint8_t> data = make_random_bytes(100000);
+        for (auto abc : alphabets)
+        {
+            const std::string encoded = base64::encode(data.data(), data.size(), abc);
+            REQUIRE(encoded == reference_encode(data, abc));
+
+            std::vector<uint8_t> decoded(base64::decoded_size_max(encoded.size()));
+            REQUIRE(base64::decode(encoded.data(), encoded.size(), decoded.data(), abc) == data.size());
+            decoded.resize(data.size());
+            REQUIRE(decoded == data);
+        }
+    };
+
+    SECTION("URL-safe alphabet")
+    {
+        const std::vector<uint8_t> data = { 0xFB, 0xFF, 0xBF };
+        REQUIRE(base64::encode(data.data(), data.size()) == "+/+/");
+        REQUIRE(base64::encode(data.data(), data.size(), base64::alphabet::url_safe) == "-_-_");
+        REQUIRE(decode_string("-_-_", base64::alphabet::url_safe) == data);
+        REQUIRE_THROWS_AS(decode_string("-_-_"), std::invalid_argument);
+        REQUIRE_THROWS_AS(decode_string("+/+/", base64::alphabet::url_safe), std::invalid_argument);
+    };
+
+    SECTION("Validation")
+    {
+        const std::vector<uint8_t> data = make_random_bytes(600);
+        const std::string encoded = base64::encode(data.data(), data.size());
+
+        // A bad character anywhere, inside and past the SIMD blocks
+        for (size_t pos : { size_t(0), size_t(5), size_t(31), size_t(32), size_t(100), size_t(790), encoded.size() - 1 })
+        {
+            for (char c : { '=', ' ', '\n', '.', '-', '\x80', '\xFF', '\0' })
+            {
+                std::string bad = encoded;
+                bad[pos] = c;
+                REQUIRE_THROWS_AS(decode_string(bad), std::invalid_argument);
+            }
+        }
+
+        REQUIRE_THROWS_AS(decode_string("Z"), std::invalid_argument);
+        REQUIRE_THROWS_AS(decode_string("Zm9vZ"), std::invalid_argument);
+        REQUIRE_THROWS_AS(decode_string("Z==="), std::invalid_argument);
+        REQUIRE_THROWS_AS(decode_string("===="), std::invalid_argument);
+        REQUIRE_THROWS_AS(decode_string("Zg="), std::invalid_argument);
+        REQUIRE_THROWS_AS(decode_string("Zg==Zm9v"), std::invalid_argument);
+        REQUIRE_THROWS_AS(decode_string("Zm=v"), std::invalid_argument);
+
+        // Non-zero unused bits
+        REQUIRE_THROWS_AS(decode_string("Zh=="), std::invalid_argument);
+        REQUIRE_THROWS_AS(decode_string("Zm9="), std::invalid_argument);
+        REQUIRE_THROWS_AS(decode_string("Zh"), std::invalid_argument);
+    };
+
+    SECTION("Streaming")
+    {
+        const std::vector<uint8_t> data = make_random_bytes(5000);
+        for (auto abc : alphabets)
+        {
+            const std::string expected = base64::encode(data.data(), data.size(), abc);
+
+            base64::encoder enc(abc);
+            std::string encoded;
+            for (size_t i = 0; i < data.size();)
+            {
+                const size_t n = std::min<size_t>(static_cast<size_t>(rand() % 100), data.size() - i);
+                std::vector<char> out(base64::encoded_size(n));
+                encoded.append(out.data(), enc.update(data.data() + i, n, out.data()));
+                i += n;
+            }
+            char tail[4];
+            encoded.append(tail, enc.finish(tail));
+            REQUIRE(encoded == expected);
+
+            base64::decoder dec(abc);
+            std::vector<uint8_t> decoded;
+            for (size_t i = 0; i < encoded.size();)
+            {
+                const size_t n = std::min<size_t>(static_cast<size_t>(rand() % 100), encoded.size() - i);
+                std::vector<uint8_t> out(base64::decoded_size_max(n));
+                out.resize(dec.update(encoded.data() + i, n, out.data()));
+                decoded.insert(decoded.end(), out.begin(), out.end());
+                i += n;
+            }
+            uint8_t dtail[2];
+            const size_t dtail_len = dec.finish(dtail);
+            decoded.insert(decoded.end(), dtail, dtail + dtail_len);
+            REQUIRE(decoded == data);
+        }
+
+        // Unpadded stream tail
+        base64::decoder dec;
+        uint8_t out[8];
+        REQUIRE(dec.update("Zm9vYm", 6, out) == 3);
+        REQUIRE(dec.update("E", 1, out) == 0);
+        REQUIRE(dec.finish(out) == 2);
+        REQUIRE(out[0] == 'b');
+        REQUIRE(out[1] == 'a');
+
+        // Padding ends the stream until finish()
+        REQUIRE(dec.update("Zg", 2, out) == 0);
+        REQUIRE(dec.update("==", 2, out) == 1);
+        REQUIRE_THROWS_AS(dec.update("Zg==", 4, out), std::invalid_argument);
+        REQUIRE(dec.finish(out) == 0);
+        REQUIRE(dec.update("Zg==", 4, out) == 1);
+    };
+
+#if (defined(LIEN_ARCH_X86) || defined(LIEN_ARCH_X86_64)) && defined(LIEN_USE_CUSTOM_SIMD)
+    SECTION("x86 kernels")
+    {
+        const std::vector<uint8_t> data = make_random_bytes(960);
+        for (auto abc : alphabets)
+        {
+            const std::string expected = reference_encode(data, abc);
+            const bool supported[] = {
+                platform::x86::get_feature(platform::x86::feature::SSSE3),
+                platform::x86::get_feature(platform::x86::feature::AVX2)
+            };
+
+            for (int tier = 0; tier < 2; ++tier)
+            {
+                if (!supported[tier]) { continue; }
+
+                auto encode = (tier == 0) ? _internal::base64_encode_ssse3 : _internal::base64_encode_avx2;
+                auto decode = (tier == 0) ? _internal::base64_decode_ssse3 : _internal::base64_decode_avx2;
+
+                std::string encoded(expected.size(), '\0');
+                const size_t consumed = encode(data.data(), data.size(), &encoded[0], abc);
+                REQUIRE(consumed > 0);
+                REQUIRE(consumed % 3 == 0);
+                REQUIRE(encoded.compare(0, (consumed / 3) * 4, expected, 0, (consumed / 3) * 4) == 0);
+
+                std::vector<uint8_t> decoded(data.size());
+                REQUIRE(decode(expected.data(), expected.size(), decoded.data(), abc) == expected.size());
+                REQUIRE(decoded == data);
+
+                // Stops before the block holding an invalid character
+                std::string bad = expected;
+                bad[100] = '*';
+                const size_t valid = decode(bad.data(), bad.size(), decoded.data(), abc);
+                REQUIRE(valid <= 100);
+                REQUIRE(valid % 4 == 0);
+            }
+        }
+    };
+#endif
+}
\ No newline at end of file
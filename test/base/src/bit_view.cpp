@@ -0,0 +1,177 @@
+#include <catch2/catch.hpp>
+
+#include <ien/bit_view.hpp>
+
+#include <cinttypes>
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#include "utils.hpp"
+
+using namespace ien;
+
+// Index/count pairs around byte and word boundaries, including the end of the view
+static std::vector<std::pair<size_t, size_t>> bit_view_ranges(size_t bitsize, size_t max_count)
+{
+    std::vector<std::pair<size_t, size_t>> result;
+    for (size_t index : { size_t(0), size_t(1), size_t(7), size_t(8), size_t(13), size_t(63), size_t(64), size_t(100) })
+    {
+        for (size_t count : { size_t(0), size_t(1), size_t(5), size_t(8), size_t(31), size_t(57), size_t(64), size_t(300), size_t(2001) })
+        {
+            if (count <= max_count && index + count <= bitsize)
+            {
+                result.emplace_back(index, count);
+            }
+        }
+    }
+    for (size_t count = 0; count <= std::min<size_t>(max_count, 64); ++count)
+    {
+        result.emplace_back(bitsize - count, count);
+    }
+    return result;
+}
+
+TEST_CASE("Bit view")
+{
+    // Large enough for the SIMD paths
+    std::vector<uint8_t> data = make_random_bytes(300);
+    bit_view view(data.data(), data.size());
+    const size_t bitsize = view.size();
+
+    SECTION("Bit order")
+    {
+        uint8_t bytes[] = { 0x80, 0x01 };
+        bit_view small(bytes, 2);
+        REQUIRE(small[0]);
+        REQUIRE_FALSE(small[1]);
+        REQUIRE(small[15]);
+        REQUIRE(small.extract(0, 16) == 0x8001);
+        REQUIRE(small.extract(7, 9) == 0x001);
+        REQUIRE(small.extract(0, 1) == 1);
+    };
+
+    SECTION("Extract")
+    {
+        for (auto [index, count] : bit_view_ranges(bitsize, 64))
+        {
+            uint64_t expected = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                expected = (expected << 1) | static_cast<uint64_t>(view[index + i]);
+            }
+            REQUIRE(view.extract(index, count) == expected);
+
+            auto bits = view.get_bits(index, count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                REQUIRE(bits[i] == view[index + i]);
+            }
+        }
+    };
+
+    SECTION("Insert")
+    {
+        for (auto [index, count] : bit_view_ranges(bitsize, 64))
+        {
+            std::vector<uint8_t> copy = data;
+            bit_view target(copy.data(), copy.size());
+            const uint64_t value = (static_cast<uint64_t>(rand()) << 40) ^ (static_cast<uint64_t>(rand()) << 20) ^ static_cast<uint64_t>(rand());
+            target.insert(index, count, value);
+
+            for (size_t i = 0; i < bitsize; ++i)
+            {
+                const bool inside = (i >= index) && (i < index + count);
+                const bool expected = inside ? (((value >> (count - 1 - (i - index))) & 1) != 0) : view[i];
+                REQUIRE(target[i] == expected);
+            }
+        }
+    };
+
+    SECTION("Extract bytes")
+    {
+        for (auto [index, count] : bit_view_ranges(bitsize, bitsize))
+        {
+            std::vector<uint8_t> out((count + 7) / 8 + 1, 0xCD);
+            view.extract_bytes(index, count, out.data());
+
+            bit_view result(out.data(), out.size());
+            for (size_t i = 0; i < count; ++i)
+            {
+                REQUIRE(result[i] == view[index + i]);
+            }
+            for (size_t i = count; i < ((count + 7) / 8) * 8; ++i)
+            {
+                REQUIRE_FALSE(result[i]);
+            }
+            REQUIRE(out.back() == 0xCD);
+        }
+    };
+
+    SECTION("Insert bytes")
+    {
+        const std::vector<uint8_t> src = make_random_bytes(300);
+        bit_view src_view(const_cast<uint8_t*>(src.data()), src.size());
+
+        for (auto [index, count] : bit_view_ranges(bitsize, bitsize))
+        {
+            std::vector<uint8_t> copy = data;
+            bit_view target(copy.data(), copy.size());
+            target.insert_bytes(index, count, src.data());
+
+            for (size_t i = 0; i < bitsize; ++i)
+            {
+                const bool inside = (i >= index) && (i < index + count);
+                REQUIRE(target[i] == (inside ? src_view[i - index] : view[i]));
+            }
+        }
+    };
+
+    SECTION("Popcount")
+    {
+        size_t total = 0;
+        for (size_t i = 0; i < bitsize; ++i)
+        {
+            total += view[i] ? 1 : 0;
+        }
+        REQUIRE(view.popcount() == total);
+
+        for (auto [index, count] : bit_view_ranges(bitsize, bitsize))
+        {
+            size_t expected = 0;
+            for (size_t i = index; i < index + count; ++i)
+            {
+                expected += view[i] ? 1 : 0;
+            }
+            REQUIRE(view.popcount(index, count) == expected);
+        }
+    };
+
+    SECTION("Find first set")
+    {
+        std::vector<uint8_t> sparse(257, 0);
+        bit_view sparse_view(sparse.data(), sparse.size());
+        REQUIRE(sparse_view.find_first_set() == bit_view::npos);
+
+        for (size_t bit : { size_t(0), size_t(5), size_t(9), size_t(300), size_t(1500), size_t(2055) })
+        {
+            std::fill(sparse.begin(), sparse.end(), 0);
+            sparse_view.insert(bit, 1, 1);
+            REQUIRE(sparse_view.find_first_set() == bit);
+            REQUIRE(sparse_view.find_first_set(bit) == bit);
+            REQUIRE(sparse_view.find_first_set(bit + 1) == bit_view::npos);
+        }
+
+        for (size_t index = 0; index < bitsize; index += 37)
+        {
+            size_t expected = index;
+            while (expected < bitsize && !view[expected])
+            {
+                ++expected;
+            }
+            REQUIRE(view.find_first_set(index) == ((expected == bitsize) ? bit_view::npos : expected));
+        }
+        REQUIRE(view.find_first_set(bitsize) == bit_view::npos);
+    };
+}
\ No newline at end of file
@@ -92,4 +92,33 @@ TEST_CASE("Fixed vector r/w")
     {
         REQUIRE(v[i] == i);
     }
+}
+
+static int adopted_frees = 0;
+
+static void counting_deleter(void* ptr)
+{
+    ++adopted_frees;
+    ien::aligned_free(ptr);
+}
+
+TEST_CASE("Fixed vector adopt")
+{
+    adopted_frees = 0;
+    {
+        int* raw = ien::aligned_alloc<int>(100, 32);
+        raw[99] = 99;
+
+        fixed_vector<int> v = fixed_vector<int>::adopt(raw, 100, 32, counting_deleter);
+        REQUIRE(v.data() == raw);
+        REQUIRE(v[99] == 99);
+
+        fixed_vector<int> copy(v);
+        REQUIRE(copy.data() != raw);
+        REQUIRE(copy[99] == 99);
+
+        fixed_vector<int> moved(std::move(v));
+        REQUIRE(moved.data() == raw);
+    }
+    REQUIRE(adopted_frees == 1);
 }
\ No newline at end of file
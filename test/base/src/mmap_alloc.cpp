@@ -0,0 +1,63 @@
+#include <catch2/catch.hpp>
+
+#include <ien/allocators/aligned_allocator.hpp>
+#include <ien/allocators/mmap_alloc.hpp>
+#include <ien/fixed_vector.hpp>
+
+#include <cstring>
+#include <vector>
+
+using namespace ien::allocators;
+
+TEST_CASE("mmap allocation")
+{
+    SECTION("Anonymous mapping")
+    {
+        const size_t len = LIEN_MMAP_THRESHOLD * 3 + 123;
+        uint8_t* ptr = reinterpret_cast<uint8_t*>(mmap_alloc(len, 64));
+        REQUIRE(ptr != nullptr);
+        REQUIRE(reinterpret_cast<uintptr_t>(ptr) % 64 == 0);
+
+        std::memset(ptr, 0xAB, len);
+        REQUIRE(ptr[len - 1] == 0xAB);
+        mmap_free(ptr, len);
+    };
+
+    SECTION("File-backed mapping")
+    {
+        const size_t len = LIEN_MMAP_THRESHOLD + 1;
+        uint8_t* ptr = reinterpret_cast<uint8_t*>(mmap_alloc(len, 32, true));
+        REQUIRE(ptr != nullptr);
+
+        std::memset(ptr, 0xCD, len);
+        REQUIRE(ptr[0] == 0xCD);
+        REQUIRE(ptr[len - 1] == 0xCD);
+        mmap_free(ptr, len);
+    };
+
+    SECTION("Small requests use the heap")
+    {
+        uint8_t* ptr = reinterpret_cast<uint8_t*>(mmap_alloc(1000, 32));
+        REQUIRE(reinterpret_cast<uintptr_t>(ptr) % 32 == 0);
+        ptr[999] = 1;
+        mmap_free(ptr, 1000);
+    };
+
+    SECTION("std::vector with mmap_allocator")
+    {
+        std::vector<uint32_t, mmap_allocator<uint32_t>> vec;
+        for (uint32_t i = 0; i < (1 << 20); ++i) { vec.push_back(i); }
+        REQUIRE(reinterpret_cast<uintptr_t>(vec.data()) % LIEN_DEFAULT_ALIGNMENT == 0);
+        REQUIRE(vec[(1 << 20) - 1] == (1 << 20) - 1);
+    };
+
+    SECTION("fixed_vector with mmap policy")
+    {
+        ien::fixed_vector<uint8_t> fv(LIEN_MMAP_THRESHOLD * 2, 32, alloc_policy::MMAP);
+        std::memset(fv.data(), 1, fv.size());
+
+        ien::fixed_vector<uint8_t> copy(fv);
+        REQUIRE(copy.policy() == alloc_policy::MMAP);
+        REQUIRE(copy[fv.size() - 1] == 1);
+    };
+}
\ No newline at end of file
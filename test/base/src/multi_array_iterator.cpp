@@ -0,0 +1,224 @@
+#include <catch2/catch.hpp>
+
+#include <ien/multi_array_bit_iterator.hpp>
+#include <ien/multi_array_iterator.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cinttypes>
+#include <cstdlib>
+#include <stdexcept>
+#include <vector>
+
+using namespace ien;
+
+TEST_CASE("Multi array iterator")
+{
+    std::vector<int> a = { 0, 1, 2 };
+    std::vector<int> b = { 3 };
+    std::vector<int> c = { 4, 5, 6, 7, 8 };
+
+    multi_array_iterator<int> it;
+    it.append_view(a.data(), a.size());
+    it.append_view(nullptr, 0);
+    it.append_view(b.data(), b.size());
+    it.append_view(c.data(), c.size());
+    REQUIRE(it.total_length() == 9);
+
+    SECTION("Increment and decrement")
+    {
+        for (int i = 0; i < 9; ++i)
+        {
+            REQUIRE(it.position() == static_cast<size_t>(i));
+            REQUIRE(*it == i);
+            REQUIRE(++it);
+        }
+        REQUIRE_FALSE(++it);
+        REQUIRE(it.remaining() == 0);
+
+        for (int i = 8; i >= 0; --i)
+        {
+            REQUIRE(--it);
+            REQUIRE(*it == i);
+        }
+        REQUIRE_FALSE(--it);
+    };
+
+    SECTION("Seek")
+    {
+        for (size_t pos = 0; pos < 9; ++pos)
+        {
+            it.seek(pos);
+            REQUIRE(it.position() == pos);
+            REQUIRE(*it == static_cast<int>(pos));
+        }
+        it.seek(100);
+        REQUIRE(it.position() == 9);
+    };
+
+    SECTION("Bulk read and write")
+    {
+        std::array<int, 9> out = {};
+        it.seek(2);
+        REQUIRE(it.read(out.data(), 5) == 5);
+        REQUIRE(out[0] == 2);
+        REQUIRE(out[4] == 6);
+        REQUIRE(it.position() == 7);
+        REQUIRE(it.read(out.data(), 5) == 2);
+        REQUIRE(out[1] == 8);
+
+        const std::array<int, 6> src = { 10, 11, 12, 13, 14, 15 };
+        it.seek(1);
+        REQUIRE(it.write(src.data(), src.size()) == 6);
+        REQUIRE(a[1] == 10);
+        REQUIRE(a[2] == 11);
+        REQUIRE(b[0] == 12);
+        REQUIRE(c[2] == 15);
+        REQUIRE(c[3] == 7);
+    };
+}
+
+TEST_CASE("Multi array bit iterator")
+{
+    // Four "planes" of odd sizes, as one bitstream
+    std::vector<std::vector<uint8_t>> planes = { std::vector<uint8_t>(37), std::vector<uint8_t>(5), std::vector<uint8_t>(64), std::vector<uint8_t>(1) };
+    std::vector<uint8_t> flat;
+    for (auto& plane : planes)
+    {
+        for (auto& byte : plane)
+        {
+            byte = static_cast<uint8_t>(rand());
+            flat.push_back(byte);
+        }
+    }
+    const size_t total_bits = flat.size() * 8;
+    auto flat_bit = [&](size_t i) { return ((flat[i / 8] >> (i % 8)) & 1) != 0; };
+
+    multi_array_bit_iterator<uint8_t> it;
+    for (auto& plane : planes)
+    {
+        it.append_view(plane.data(), plane.size());
+    }
+    REQUIRE(it.total_bits() == total_bits);
+
+    SECTION("Increment, decrement and seek")
+    {
+        for (size_t i = 0; i < total_bits; ++i)
+        {
+            REQUIRE(it.position() == i);
+            REQUIRE(*it == flat_bit(i));
+            REQUIRE(((i + 1 < total_bits) == ++it));
+        }
+
+        for (size_t i = total_bits - 1; i > 0; --i)
+        {
+            REQUIRE(--it);
+            REQUIRE(*it == flat_bit(i - 1));
+        }
+        REQUIRE_FALSE(--it);
+
+        for (size_t pos : { size_t(0), size_t(7), size_t(296), size_t(300), size_t(335), size_t(336), size_t(850) })
+        {
+            it.seek(pos);
+            REQUIRE(it.position() == pos);
+            REQUIRE(*it == flat_bit(pos));
+        }
+    };
+
+    SECTION("Read bits")
+    {
+        for (size_t pos : { size_t(0), size_t(3), size_t(290), size_t(333), size_t(800) })
+        {
+            for (size_t count : { size_t(1), size_t(9), size_t(50), size_t(64) })
+            {
+                if (pos + count > total_bits) { continue; }
+
+                it.seek(pos);
+                const uint64_t bits = it.read_bits(count);
+                for (size_t i = 0; i < count; ++i)
+                {
+                    REQUIRE((((bits >> i) & 1) != 0) == flat_bit(pos + i));
+                }
+                REQUIRE(it.position() == pos + count);
+            }
+        }
+
+        it.seek(total_bits - 3);
+        REQUIRE_THROWS_AS(it.read_bits(4), std::out_of_range);
+        REQUIRE_THROWS_AS(it.read_bits(65), std::out_of_range);
+    };
+
+    SECTION("Bulk read")
+    {
+        for (size_t pos : { size_t(0), size_t(5), size_t(296), size_t(801) })
+        {
+            it.seek(pos);
+            std::vector<uint8_t> out(flat.size() + 1, 0xCD);
+            const size_t read = it.read(out.data(), total_bits);
+            REQUIRE(read == total_bits - pos);
+            REQUIRE(it.remaining_bits() == 0);
+
+            for (size_t i = 0; i < read; ++i)
+            {
+                REQUIRE((((out[i / 8] >> (i % 8)) & 1) != 0) == flat_bit(pos + i));
+            }
+            if (read % 8 != 0)
+            {
+                REQUIRE((out[read / 8] >> (read % 8)) == 0);
+            }
+        }
+    };
+
+    SECTION("Bulk write")
+    {
+        std::vector<uint8_t> src(flat.size());
+        for (auto& byte : src)
+        {
+            byte = static_cast<uint8_t>(rand());
+        }
+        auto src_bit = [&](size_t i) { return ((src[i / 8] >> (i % 8)) & 1) != 0; };
+
+        const size_t pos = 291;
+        const size_t count = 500;
+        it.seek(pos);
+        REQUIRE(it.write(src.data(), count) == count);
+
+        multi_array_bit_iterator<uint8_t> check;
+        for (auto& plane : planes)
+        {
+            check.append_view(plane.data(), plane.size());
+        }
+        for (size_t i = 0; i < total_bits; ++i)
+        {
+            check.seek(i);
+            const bool inside = (i >= pos) && (i < pos + count);
+            REQUIRE(*check == (inside ? src_bit(i - pos) : flat_bit(i)));
+        }
+
+        // Aligned writes copy whole spans
+        it.seek(0);
+        REQUIRE(it.write(src.data(), total_bits) == total_bits);
+        REQUIRE(std::equal(planes[0].begin(), planes[0].end(), src.begin()));
+        REQUIRE(planes[3][0] == src.back());
+    };
+
+    SECTION("Wider items and read-only views")
+    {
+        const std::array<uint16_t, 3> words = { 0x8001, 0x00FF, 0xF00F };
+        multi_array_bit_iterator<uint16_t> wide;
+        wide.append_view(words.data(), words.size());
+        wide.seek(15);
+        REQUIRE(wide.read_bits(10) == (0x1 | (0xFF << 1) | (0 << 9)));
+
+        std::vector<uint8_t> out(8);
+        wide.seek(0);
+        REQUIRE(wide.read(out.data(), 48) == 48);
+        REQUIRE(out[0] == 0x01);
+        REQUIRE(out[1] == 0x80);
+        REQUIRE(out[5] == 0xF0);
+
+        wide.seek(0);
+        const uint8_t byte = 0;
+        REQUIRE_THROWS_AS(wide.write(&byte, 8), std::logic_error);
+    };
+}
\ No newline at end of file
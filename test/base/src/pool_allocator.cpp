@@ -0,0 +1,97 @@
+#include <catch2/catch.hpp>
+
+#include <ien/allocators/pool_allocator.hpp>
+#include <ien/fixed_vector.hpp>
+
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace ien::allocators;
+
+TEST_CASE("Pool allocator")
+{
+    SECTION("Alignment")
+    {
+        for (size_t alignment = 1; alignment <= 64; alignment *= 2)
+        {
+            for (size_t len = 0; len < 5000; len += 37)
+            {
+                void* ptr = pool_alloc(len, alignment);
+                REQUIRE(reinterpret_cast<uintptr_t>(ptr) % alignment == 0);
+                pool_free(ptr);
+            }
+        }
+    };
+
+    SECTION("Bypass for large alignment")
+    {
+        void* ptr = pool_alloc(1000, 4096);
+        REQUIRE(reinterpret_cast<uintptr_t>(ptr) % 4096 == 0);
+        pool_free(ptr);
+    };
+
+    SECTION("Blocks are reused")
+    {
+        pool_trim();
+        void* first = pool_alloc(100000, 32);
+        pool_free(first);
+
+        // Same size class
+        void* second = pool_alloc(99000, 32);
+        REQUIRE(second == first);
+        pool_free(second);
+    };
+
+    SECTION("Blocks freed on another thread")
+    {
+        std::vector<void*> ptrs;
+        for (size_t i = 0; i < 64; ++i)
+        {
+            ptrs.push_back(pool_alloc(i * 1000 + 1, 32));
+        }
+
+        std::thread th([&ptrs]
+        {
+            for (void* ptr : ptrs) { pool_free(ptr); }
+        });
+        th.join();
+
+        for (size_t i = 0; i < 64; ++i)
+        {
+            uint8_t* ptr = reinterpret_cast<uint8_t*>(pool_alloc(i * 1000 + 1, 32));
+            ptr[i * 1000] = 1;
+            pool_free(ptr);
+        }
+        pool_trim();
+    };
+
+    SECTION("std::vector with pool_allocator")
+    {
+        std::vector<int, pool_allocator<int, 32>> vec;
+        for (int i = 0; i < 10000; ++i) { vec.push_back(i); }
+        REQUIRE(reinterpret_cast<uintptr_t>(vec.data()) % 32 == 0);
+        REQUIRE(std::accumulate(vec.begin(), vec.end(), 0LL) == 49995000LL);
+    };
+}
+
+TEST_CASE("Pooled fixed vector")
+{
+    ien::fixed_vector<int> fv(1000, 32, alloc_policy::POOL);
+    REQUIRE(fv.policy() == alloc_policy::POOL);
+    std::iota(fv.data(), fv.data() + fv.size(), 0);
+
+    ien::fixed_vector<int> copy(fv);
+    REQUIRE(copy.policy() == alloc_policy::POOL);
+    REQUIRE(copy.data() != fv.data());
+    for (size_t i = 0; i < copy.size(); ++i)
+    {
+        REQUIRE(copy[i] == static_cast<int>(i));
+    }
+
+    ien::fixed_vector<int> other(10);
+    other = copy;
+    REQUIRE(other.policy() == alloc_policy::POOL);
+    REQUIRE(other.size() == 1000);
+    REQUIRE(other[999] == 999);
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cinttypes>
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+// Random test data, shared by the tests that need a plain byte buffer
+inline std::vector<uint8_t> make_random_bytes(size_t len)
+{
+    std::vector<uint8_t> data(len);
+    for (auto& byte : data)
+    {
+        byte = static_cast<uint8_t>(rand());
+    }
+    return data;
+}
\ No newline at end of file
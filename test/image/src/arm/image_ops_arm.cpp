@@ -7,7 +7,10 @@
 #include <ien/internal/std/image_ops_std.hpp>
 #include <ien/internal/arm/neon/image_ops_neon.hpp>
 
+#include <cmath>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 using namespace ien;
 
@@ -55,7 +58,8 @@ TEST_CASE("[ARM] Channel average RGBA")
         }
 
         image_ops::_internal::channel_info_extract_args_rgba args(img);
-        auto result = image_ops::_internal::rgba_average_neon(args);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgba_average_neon(args, result.data());
         for (size_t i = 0; i < px_count; ++i)
         {
             REQUIRE((result[i] == 8 || result[i] == 7));
@@ -79,7 +83,8 @@ TEST_CASE("[ARM] Channel max RGBA")
         }
 
         image_ops::_internal::channel_info_extract_args_rgba args(img);
-        auto result = image_ops::_internal::rgba_max_neon(args);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgba_max_neon(args, result.data());
         for (size_t i = 0; i < px_count; ++i)
         {
             REQUIRE(result[i] == 15);
@@ -103,7 +108,8 @@ TEST_CASE("[ARM] Channel min RGBA")
         }
 
         image_ops::_internal::channel_info_extract_args_rgba args(img);
-        auto result = image_ops::_internal::rgba_min_neon(args);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgba_min_neon(args, result.data());
         for (size_t i = 0; i < px_count; ++i)
         {
             REQUIRE(result[i] == 3);
@@ -127,7 +133,8 @@ TEST_CASE("[ARM] Channel sum saturated RGBA")
         }
 
         image_ops::_internal::channel_info_extract_args_rgba args(img);
-        auto result = image_ops::_internal::rgba_sum_saturated_neon(args);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgba_sum_saturated_neon(args, result.data());
         for (size_t i = 0; i < px_count; ++i)
         {
             REQUIRE(result[i] == 19);
@@ -148,7 +155,8 @@ TEST_CASE("[ARM] Channel sum saturated RGBA")
         }
 
         image_ops::_internal::channel_info_extract_args_rgba args(img);
-        auto result = image_ops::_internal::rgba_sum_saturated_neon(args);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgba_sum_saturated_neon(args, result.data());
         for (size_t i = 0; i < px_count; ++i)
         {
             REQUIRE(result[i] == 255u);
@@ -172,8 +180,10 @@ TEST_CASE("[ARM] Saturation")
         }
 
         image_ops::_internal::channel_info_extract_args_rgb args(img);
-        ien::fixed_vector<float> result0 = image_ops::_internal::rgb_saturation_std(args);
-        ien::fixed_vector<float> result1 = image_ops::_internal::rgb_saturation_neon(args);
+        ien::fixed_vector<float> result0(args.len);
+        image_ops::_internal::rgb_saturation_std(args, result0.data());
+        ien::fixed_vector<float> result1(args.len);
+        image_ops::_internal::rgb_saturation_neon(args, result1.data());
 
         REQUIRE(result0.size() == img.pixel_count());
         REQUIRE(result1.size() == img.pixel_count());
@@ -197,7 +207,8 @@ TEST_CASE("[ARM] Saturation")
         }
 
         image_ops::_internal::channel_info_extract_args_rgb args(img);
-        ien::fixed_vector<float> result = image_ops::_internal::rgb_saturation_neon(args);
+        ien::fixed_vector<float> result(args.len);
+        image_ops::_internal::rgb_saturation_neon(args, result.data());
 
         REQUIRE(result.size() == img.pixel_count());
         for(const float& f : result)
@@ -223,7 +234,8 @@ TEST_CASE("[ARM] Luminance")
         }
 
         image_ops::_internal::channel_info_extract_args_rgb args(img);
-        ien::fixed_vector<float> result = image_ops::_internal::rgb_luminance_neon(args);
+        ien::fixed_vector<float> result(args.len);
+        image_ops::_internal::rgb_luminance_neon(args, result.data());
 
         REQUIRE(result.size() == img.pixel_count());
         for(size_t i = 0; i < result.size(); ++i)
@@ -250,7 +262,8 @@ TEST_CASE("[ARM] Unpack Image Data")
             data[(i * 4) + 3] = 4;
         }
 
-        ien::image_planar_data result = image_ops::_internal::unpack_image_data_neon(data.data(), data.size());
+        ien::image_planar_data result(data.size() / 4);
+        image_ops::_internal::unpack_image_data_neon(data.data(), data.size(), result);
 
         for(size_t i = 0; i < result.size(); ++i)
         {
@@ -262,4 +275,136 @@ TEST_CASE("[ARM] Unpack Image Data")
     };
 };
 
+TEST_CASE("[ARM] Pack Image Data")
+{
+    SECTION("NEON")
+    {
+        planar_image img(41, 41);
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            img.data()->data_r()[i] = static_cast<uint8_t>(i);
+            img.data()->data_g()[i] = static_cast<uint8_t>(i * 3);
+            img.data()->data_b()[i] = static_cast<uint8_t>(i * 7);
+            img.data()->data_a()[i] = static_cast<uint8_t>(i * 11);
+        }
+
+        image_ops::_internal::channel_info_extract_args_rgba args(*img.cdata());
+        std::vector<uint8_t> expected(img.pixel_count() * 4);
+        std::vector<uint8_t> result(img.pixel_count() * 4);
+        image_ops::_internal::pack_image_data_std(args, expected.data());
+        image_ops::_internal::pack_image_data_neon(args, result.data());
+
+        REQUIRE(result == expected);
+    };
+};
+
+TEST_CASE("[ARM] RGB metrics")
+{
+    SECTION("NEON")
+    {
+        planar_image img(41, 41);
+        const size_t px_count = img.pixel_count();
+        for (size_t i = 0; i < px_count; ++i)
+        {
+            img.data()->data_r()[i] = static_cast<uint8_t>(i);
+            img.data()->data_g()[i] = static_cast<uint8_t>(i * 3);
+            img.data()->data_b()[i] = static_cast<uint8_t>(i * 7);
+        }
+
+        std::vector<float> exp_lum(px_count), exp_sat(px_count), exp_avg(px_count);
+        std::vector<uint8_t> exp_max(px_count), exp_min(px_count);
+        rgb_metrics_output expected = { exp_lum.data(), exp_sat.data(), exp_avg.data(), exp_max.data(), exp_min.data() };
+        image_ops::_internal::rgb_metrics_std(image_ops::_internal::rgb_metrics_args(img, rgb_metric::ALL, expected));
+
+        std::vector<float> lum(px_count), sat(px_count), avg(px_count);
+        std::vector<uint8_t> max(px_count), min(px_count);
+        rgb_metrics_output result = { lum.data(), sat.data(), avg.data(), max.data(), min.data() };
+        image_ops::_internal::rgb_metrics_neon(image_ops::_internal::rgb_metrics_args(img, rgb_metric::ALL, result));
+
+        for (size_t i = 0; i < px_count; ++i)
+        {
+            REQUIRE(lum[i] == Approx(exp_lum[i]).epsilon(0.01));
+            REQUIRE((std::isnan(exp_sat[i]) ? std::isnan(sat[i]) : sat[i] == Approx(exp_sat[i]).epsilon(0.01)));
+            REQUIRE(avg[i] == Approx(exp_avg[i]));
+            REQUIRE(max[i] == exp_max[i]);
+            REQUIRE(min[i] == exp_min[i]);
+        }
+    };
+};
+
+TEST_CASE("[ARM] Channel reductions")
+{
+    SECTION("NEON")
+    {
+        planar_image img(41, 41);
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            img.data()->data_r()[i] = static_cast<uint8_t>(10 + (i % 200));
+            img.data()->data_g()[i] = static_cast<uint8_t>(i * 3);
+            img.data()->data_b()[i] = static_cast<uint8_t>(i * 7);
+            img.data()->data_a()[i] = static_cast<uint8_t>(i * 11);
+        }
+
+        image_ops::_internal::channel_info_extract_args_rgba args(*img.cdata());
+        image_ops::_internal::rgba_reduction expected, result;
+        image_ops::_internal::rgba_reduce_std(args, expected);
+        image_ops::_internal::rgba_reduce_neon(args, result);
+
+        for (size_t ch = 0; ch < 4; ++ch)
+        {
+            REQUIRE(result.sum[ch] == expected.sum[ch]);
+            REQUIRE(result.sum_sq[ch] == expected.sum_sq[ch]);
+            REQUIRE(result.min[ch] == expected.min[ch]);
+            REQUIRE(result.max[ch] == expected.max[ch]);
+        }
+    };
+};
+
+TEST_CASE("[ARM] Resample passes")
+{
+    typedef void(*func_ptr_t)(const image_ops::_internal::resample_args&);
+
+    const std::pair<size_t, size_t> sizes[] = { { 7, 100 }, { 100, 7 }, { 45, 45 * 3 }, { 131, 64 } };
+    const resize_filter filters[] = { resize_filter::BOX, resize_filter::BILINEAR, resize_filter::BICUBIC, resize_filter::LANCZOS3 };
+
+    auto check_against_std = [&](func_ptr_t std_func, func_ptr_t func, bool horizontal)
+    {
+        for (resize_filter filter : filters)
+        {
+            for (auto [in_len, out_len] : sizes)
+            {
+                const size_t other_len = 19;
+                auto coeffs = image_ops::_internal::build_resample_coeffs(in_len, out_len, filter);
+
+                std::vector<uint8_t> src(in_len * other_len);
+                for (size_t i = 0; i < src.size(); ++i)
+                {
+                    src[i] = static_cast<uint8_t>((i * 37) ^ (i >> 3));
+                }
+
+                image_ops::_internal::resample_args args;
+                args.coeffs = &coeffs;
+                args.src = src.data();
+                args.width = horizontal ? 0 : other_len;
+                args.row_begin = 0;
+                args.row_end = horizontal ? other_len : out_len;
+
+                std::vector<uint8_t> expected(out_len * other_len), result(out_len * other_len);
+                args.dst = expected.data();
+                std_func(args);
+                args.dst = result.data();
+                func(args);
+
+                REQUIRE(result == expected);
+            }
+        }
+    };
+
+    SECTION("NEON")
+    {
+        check_against_std(&image_ops::_internal::resample_horizontal_std, &image_ops::_internal::resample_horizontal_neon, true);
+        check_against_std(&image_ops::_internal::resample_vertical_std, &image_ops::_internal::resample_vertical_neon, false);
+    };
+};
+
 #endif
@@ -3,12 +3,24 @@
 #define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include <catch2/catch.hpp>
 
+#include <ien/bit_iterator.hpp>
 #include <ien/image.hpp>
+#include <ien/image_ops.hpp>
 #include <ien/platform.hpp>
+#include <ien/thread_pool.hpp>
 #include <ien/internal/std/image_ops_std.hpp>
 
+#include <stb_image_resize.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #if defined(LIEN_ARCH_X86_64) || defined(LIEN_ARCH_X86)
     #include <ien/internal/x86/image_ops_x86.hpp>
+
+    #define HAS_AVX512() (platform::x86::get_feature(platform::x86::feature::AVX512F) \
+                       && platform::x86::get_feature(platform::x86::feature::AVX512BW))
 #elif defined(LIEN_ARM_NEON)
     #include <ien/internal/arm/neon/image_ops_neon.hpp>
 #endif
@@ -64,6 +76,18 @@ TEST_CASE("Benchmark truncate channel bits")
         });
     };
 
+    if (HAS_AVX512())
+    {
+        BENCHMARK_ADVANCED("AVX512")(Catch::Benchmark::Chronometer meter)
+        {
+            TRUNCATE_CHANNEL_BITS_SETUP(args);
+            meter.measure([&]
+            {
+                image_ops::_internal::truncate_channel_data_avx512(args);
+            });
+        };
+    }
+
 #elif defined(LIEN_ARM_NEON)
     BENCHMARK_ADVANCED("NEON")(Catch::Benchmark::Chronometer meter)
     {
@@ -91,37 +115,54 @@ TEST_CASE("Benchmark rgba average")
     BENCHMARK_ADVANCED("STD")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgba_average_std(args);
+            image_ops::_internal::rgba_average_std(args, out.data());
         });
     };
 #if defined(LIEN_ARCH_X86_64) || defined(LIEN_ARCH_X86)
     BENCHMARK_ADVANCED("SSE2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgba_average_sse2(args);
+            image_ops::_internal::rgba_average_sse2(args, out.data());
         });
     };
 
     BENCHMARK_ADVANCED("AVX2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgba_average_avx2(args);
+            image_ops::_internal::rgba_average_avx2(args, out.data());
         });
     };
 
+    if (HAS_AVX512())
+    {
+        BENCHMARK_ADVANCED("AVX512")(Catch::Benchmark::Chronometer meter)
+        {
+            EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+            fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
+            meter.measure([&]
+            {
+                image_ops::_internal::rgba_average_avx512(args, out.data());
+            });
+        };
+    }
+
 #elif defined(LIEN_ARM_NEON)
     BENCHMARK_ADVANCED("NEON")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgba_average_neon(args);
+            image_ops::_internal::rgba_average_neon(args, out.data());
         });
     };
 #endif
@@ -132,46 +173,64 @@ TEST_CASE("Benchmark rgb average")
     BENCHMARK_ADVANCED("STD")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<float> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_average_std(args);
+            image_ops::_internal::rgb_average_std(args, out.data());
         });
     };
     #if defined(LIEN_ARCH_X86_64) || defined(LIEN_ARCH_X86)
     BENCHMARK_ADVANCED("SSE2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<float> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_average_sse2(args);
+            image_ops::_internal::rgb_average_sse2(args, out.data());
         });
     };
 
     BENCHMARK_ADVANCED("SSE41")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<float> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_average_sse41(args);
+            image_ops::_internal::rgb_average_sse41(args, out.data());
         });
     };
 
     BENCHMARK_ADVANCED("AVX2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<float> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_average_avx2(args);
+            image_ops::_internal::rgb_average_avx2(args, out.data());
         });
     };
 
+    if (HAS_AVX512())
+    {
+        BENCHMARK_ADVANCED("AVX512")(Catch::Benchmark::Chronometer meter)
+        {
+            EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+            fixed_vector<float> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
+            meter.measure([&]
+            {
+                image_ops::_internal::rgb_average_avx512(args, out.data());
+            });
+        };
+    }
+
     #elif defined(LIEN_ARM_NEON)
     BENCHMARK_ADVANCED("NEON")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<float> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_average_neon(args);
+            image_ops::_internal::rgb_average_neon(args, out.data());
         });
     };
     #endif
@@ -182,37 +241,54 @@ TEST_CASE("Benchmark rgba max")
     BENCHMARK_ADVANCED("STD")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgba_max_std(args);
+            image_ops::_internal::rgba_max_std(args, out.data());
         });
     };
 #if defined(LIEN_ARCH_X86_64) || defined(LIEN_ARCH_X86)
     BENCHMARK_ADVANCED("SSE2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgba_max_sse2(args);
+            image_ops::_internal::rgba_max_sse2(args, out.data());
         });
     };
 
     BENCHMARK_ADVANCED("AVX2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgba_max_avx2(args);
+            image_ops::_internal::rgba_max_avx2(args, out.data());
         });
     };
 
+    if (HAS_AVX512())
+    {
+        BENCHMARK_ADVANCED("AVX512")(Catch::Benchmark::Chronometer meter)
+        {
+            EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+            fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
+            meter.measure([&]
+            {
+                image_ops::_internal::rgba_max_avx512(args, out.data());
+            });
+        };
+    }
+
 #elif defined(LIEN_ARM_NEON)
     BENCHMARK_ADVANCED("NEON")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgba_max_neon(args);
+            image_ops::_internal::rgba_max_neon(args, out.data());
         });
     };
 #endif
@@ -223,9 +299,10 @@ TEST_CASE("Benchmark rgba min")
     BENCHMARK_ADVANCED("STD")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgba_min_std(args);
+            image_ops::_internal::rgba_min_std(args, out.data());
         });
     };
 
@@ -233,28 +310,44 @@ TEST_CASE("Benchmark rgba min")
     BENCHMARK_ADVANCED("SSE2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgba_min_sse2(args);
+            image_ops::_internal::rgba_min_sse2(args, out.data());
         });
     };
 
     BENCHMARK_ADVANCED("AVX2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgba_min_avx2(args);
+            image_ops::_internal::rgba_min_avx2(args, out.data());
         });
     };
 
+    if (HAS_AVX512())
+    {
+        BENCHMARK_ADVANCED("AVX512")(Catch::Benchmark::Chronometer meter)
+        {
+            EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+            fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
+            meter.measure([&]
+            {
+                image_ops::_internal::rgba_min_avx512(args, out.data());
+            });
+        };
+    }
+
 #elif defined(LIEN_ARM_NEON)
     BENCHMARK_ADVANCED("NEON")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgba_min_neon(args);
+            image_ops::_internal::rgba_min_neon(args, out.data());
         });
     };
 #endif
@@ -265,37 +358,54 @@ TEST_CASE("Benchmark rgb max")
     BENCHMARK_ADVANCED("STD")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_max_std(args);
+            image_ops::_internal::rgb_max_std(args, out.data());
         });
     };
 #if defined(LIEN_ARCH_X86_64) || defined(LIEN_ARCH_X86)
     BENCHMARK_ADVANCED("SSE2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_max_sse2(args);
+            image_ops::_internal::rgb_max_sse2(args, out.data());
         });
     };
 
     BENCHMARK_ADVANCED("AVX2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_max_avx2(args);
+            image_ops::_internal::rgb_max_avx2(args, out.data());
         });
     };
 
+    if (HAS_AVX512())
+    {
+        BENCHMARK_ADVANCED("AVX512")(Catch::Benchmark::Chronometer meter)
+        {
+            EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+            fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
+            meter.measure([&]
+            {
+                image_ops::_internal::rgb_max_avx512(args, out.data());
+            });
+        };
+    }
+
 #elif defined(LIEN_ARM_NEON)
     BENCHMARK_ADVANCED("NEON")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_max_neon(args);
+            image_ops::_internal::rgb_max_neon(args, out.data());
         });
     };
 #endif
@@ -306,9 +416,10 @@ TEST_CASE("Benchmark rgb min")
     BENCHMARK_ADVANCED("STD")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_min_std(args);
+            image_ops::_internal::rgb_min_std(args, out.data());
         });
     };
 
@@ -316,28 +427,44 @@ TEST_CASE("Benchmark rgb min")
     BENCHMARK_ADVANCED("SSE2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_min_sse2(args);
+            image_ops::_internal::rgb_min_sse2(args, out.data());
         });
     };
 
     BENCHMARK_ADVANCED("AVX2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_min_avx2(args);
+            image_ops::_internal::rgb_min_avx2(args, out.data());
         });
     };
 
+    if (HAS_AVX512())
+    {
+        BENCHMARK_ADVANCED("AVX512")(Catch::Benchmark::Chronometer meter)
+        {
+            EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+            fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
+            meter.measure([&]
+            {
+                image_ops::_internal::rgb_min_avx512(args, out.data());
+            });
+        };
+    }
+
 #elif defined(LIEN_ARM_NEON)
     BENCHMARK_ADVANCED("NEON")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_min_neon(args);
+            image_ops::_internal::rgb_min_neon(args, out.data());
         });
     };
 #endif
@@ -348,9 +475,10 @@ TEST_CASE("Benchmark rgba sum saturated")
     BENCHMARK_ADVANCED("STD")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgba_sum_saturated_std(args);
+            image_ops::_internal::rgba_sum_saturated_std(args, out.data());
         });
     };
 
@@ -358,28 +486,44 @@ TEST_CASE("Benchmark rgba sum saturated")
     BENCHMARK_ADVANCED("SSE2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgba_sum_saturated_sse2(args);
+            image_ops::_internal::rgba_sum_saturated_sse2(args, out.data());
         });
     };
 
     BENCHMARK_ADVANCED("AVX2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgba_sum_saturated_avx2(args);
+            image_ops::_internal::rgba_sum_saturated_avx2(args, out.data());
         });
     };
 
+    if (HAS_AVX512())
+    {
+        BENCHMARK_ADVANCED("AVX512")(Catch::Benchmark::Chronometer meter)
+        {
+            EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+            fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
+            meter.measure([&]
+            {
+                image_ops::_internal::rgba_sum_saturated_avx512(args, out.data());
+            });
+        };
+    }
+
 #elif defined(LIEN_ARM_NEON)
     BENCHMARK_ADVANCED("NEON")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGBA_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgba_sum_saturated_neon(args);
+            image_ops::_internal::rgba_sum_saturated_neon(args, out.data());
         });
     };
 #endif
@@ -390,9 +534,10 @@ TEST_CASE("Benchmark rgb saturation")
     BENCHMARK_ADVANCED("STD")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<float> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_saturation_std(args);
+            image_ops::_internal::rgb_saturation_std(args, out.data());
         });
     };
 
@@ -400,28 +545,44 @@ TEST_CASE("Benchmark rgb saturation")
     BENCHMARK_ADVANCED("SSE2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<float> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_saturation_sse2(args);
+            image_ops::_internal::rgb_saturation_sse2(args, out.data());
         });
     };
 
     BENCHMARK_ADVANCED("AVX2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<float> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_saturation_avx2(args);
+            image_ops::_internal::rgb_saturation_avx2(args, out.data());
         });
     };
 
+    if (HAS_AVX512())
+    {
+        BENCHMARK_ADVANCED("AVX512")(Catch::Benchmark::Chronometer meter)
+        {
+            EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+            fixed_vector<float> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
+            meter.measure([&]
+            {
+                image_ops::_internal::rgb_saturation_avx512(args, out.data());
+            });
+        };
+    }
+
 #elif defined(LIEN_ARM_NEON)
     BENCHMARK_ADVANCED("NEON")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<float> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_saturation_neon(args);
+            image_ops::_internal::rgb_saturation_neon(args, out.data());
         });
     };
 #endif
@@ -432,9 +593,10 @@ TEST_CASE("Benchmark rgba luminance")
     BENCHMARK_ADVANCED("STD")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<float> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_luminance_std(args);
+            image_ops::_internal::rgb_luminance_std(args, out.data());
         });
     };
 
@@ -442,33 +604,92 @@ TEST_CASE("Benchmark rgba luminance")
     BENCHMARK_ADVANCED("SSE2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<float> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_luminance_sse2(args);
+            image_ops::_internal::rgb_luminance_sse2(args, out.data());
         });
     };
 
     BENCHMARK_ADVANCED("AVX2")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<float> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_luminance_avx2(args);
+            image_ops::_internal::rgb_luminance_avx2(args, out.data());
         });
     };
 
+    if (HAS_AVX512())
+    {
+        BENCHMARK_ADVANCED("AVX512")(Catch::Benchmark::Chronometer meter)
+        {
+            EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+            fixed_vector<float> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
+            meter.measure([&]
+            {
+                image_ops::_internal::rgb_luminance_avx512(args, out.data());
+            });
+        };
+    }
+
 #elif defined(LIEN_ARM_NEON)
     BENCHMARK_ADVANCED("NEON")(Catch::Benchmark::Chronometer meter)
     {
         EXTRACT_CHANNEL_DATA_RGB_SETUP(args);
+        fixed_vector<float> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::rgb_luminance_neon(args);
+            image_ops::_internal::rgb_luminance_neon(args, out.data());
         });
     };
 #endif
 };
 
+#define RGB_METRICS_SETUP(img, out) \
+    planar_image img(IMG_DIM, IMG_DIM); \
+    fill_image_random(img); \
+    std::vector<float> lum(img.pixel_count()), sat(img.pixel_count()), avg(img.pixel_count()); \
+    std::vector<uint8_t> max(img.pixel_count()), min(img.pixel_count()); \
+    rgb_metrics_output out = { lum.data(), sat.data(), avg.data(), max.data(), min.data() }
+
+TEST_CASE("Benchmark rgb metrics")
+{
+    // Both arms write into the same preallocated buffers, only the passes over the planes differ
+    BENCHMARK_ADVANCED("Separate ops")(Catch::Benchmark::Chronometer meter)
+    {
+        RGB_METRICS_SETUP(img, out);
+        const size_t len = img.pixel_count();
+        meter.measure([&]
+        {
+            image_ops::rgb_luminance(img, out.luminance, len);
+            image_ops::rgb_saturation(img, out.saturation, len);
+            image_ops::rgb_average(img, out.average, len);
+            image_ops::rgb_max(img, out.max, len);
+            image_ops::rgb_min(img, out.min, len);
+        });
+    };
+
+    BENCHMARK_ADVANCED("Fused")(Catch::Benchmark::Chronometer meter)
+    {
+        RGB_METRICS_SETUP(img, out);
+        meter.measure([&]
+        {
+            image_ops::rgb_metrics(img, rgb_metric::ALL, out);
+        });
+    };
+
+    BENCHMARK_ADVANCED("Fused (luminance + max)")(Catch::Benchmark::Chronometer meter)
+    {
+        RGB_METRICS_SETUP(img, out);
+        meter.measure([&]
+        {
+            image_ops::rgb_metrics(img, rgb_metric::LUMINANCE | rgb_metric::MAX, out);
+        });
+    };
+};
+
 #define IMG_DIM_UNPACK 128
 
 TEST_CASE("Benchmark unpack image data")
@@ -484,9 +705,10 @@ TEST_CASE("Benchmark unpack image data")
             data[(i * 4) + 3] = 4;
         }
 
+        image_planar_data out(data.size() / 4);
         meter.measure([&]
         {
-            return image_ops::_internal::unpack_image_data_std(data.data(), data.size());
+            image_ops::_internal::unpack_image_data_std(data.data(), data.size(), out);
         });
     };
 
@@ -502,9 +724,10 @@ TEST_CASE("Benchmark unpack image data")
             data[(i * 4) + 3] = 4;
         }
 
+        image_planar_data out(data.size() / 4);
         meter.measure([&]
         {
-            return image_ops::_internal::unpack_image_data_ssse3(data.data(), data.size());
+            image_ops::_internal::unpack_image_data_ssse3(data.data(), data.size(), out);
         });
     };
 
@@ -519,11 +742,33 @@ TEST_CASE("Benchmark unpack image data")
             data[(i * 4) + 3] = 4;
         }
 
+        image_planar_data out(data.size() / 4);
         meter.measure([&]
         {
-            return image_ops::_internal::unpack_image_data_avx2(data.data(), data.size());
+            image_ops::_internal::unpack_image_data_avx2(data.data(), data.size(), out);
         });
     };
+
+    if (HAS_AVX512())
+    {
+        BENCHMARK_ADVANCED("AVX512")(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<uint8_t> data(IMG_DIM_UNPACK * IMG_DIM_UNPACK);
+            for (size_t i = 0; i < ((IMG_DIM_UNPACK * IMG_DIM_UNPACK) / 4); ++i)
+            {
+                data[(i * 4) + 0] = 1;
+                data[(i * 4) + 1] = 2;
+                data[(i * 4) + 2] = 3;
+                data[(i * 4) + 3] = 4;
+            }
+
+            image_planar_data out(data.size() / 4);
+            meter.measure([&]
+            {
+                image_ops::_internal::unpack_image_data_avx512(data.data(), data.size(), out);
+            });
+        };
+    }
     
 #elif defined(LIEN_ARM_NEON)
     BENCHMARK_ADVANCED("NEON")(Catch::Benchmark::Chronometer meter)
@@ -537,9 +782,70 @@ TEST_CASE("Benchmark unpack image data")
             data[(i * 4) + 3] = 4;
         }
 
+        image_planar_data out(data.size() / 4);
         meter.measure([&]
         {
-            return image_ops::_internal::unpack_image_data_neon(data.data(), data.size());
+            image_ops::_internal::unpack_image_data_neon(data.data(), data.size(), out);
+        });
+    };
+#endif
+};
+
+#define PACK_IMAGE_DATA_SETUP(args, out) \
+    planar_image img(IMG_DIM, IMG_DIM); \
+    fill_image_random(img);\
+    image_ops::_internal::channel_info_extract_args_rgba args(*img.cdata()); \
+    std::vector<uint8_t> out(img.pixel_count() * 4)
+
+TEST_CASE("Benchmark pack image data")
+{
+    BENCHMARK_ADVANCED("STD")(Catch::Benchmark::Chronometer meter)
+    {
+        PACK_IMAGE_DATA_SETUP(args, out);
+        meter.measure([&]
+        {
+            image_ops::_internal::pack_image_data_std(args, out.data());
+        });
+    };
+
+#if defined(LIEN_ARCH_X86_64) || defined(LIEN_ARCH_X86)
+    BENCHMARK_ADVANCED("SSE2")(Catch::Benchmark::Chronometer meter)
+    {
+        PACK_IMAGE_DATA_SETUP(args, out);
+        meter.measure([&]
+        {
+            image_ops::_internal::pack_image_data_sse2(args, out.data());
+        });
+    };
+
+    BENCHMARK_ADVANCED("AVX2")(Catch::Benchmark::Chronometer meter)
+    {
+        PACK_IMAGE_DATA_SETUP(args, out);
+        meter.measure([&]
+        {
+            image_ops::_internal::pack_image_data_avx2(args, out.data());
+        });
+    };
+
+    if (HAS_AVX512())
+    {
+        BENCHMARK_ADVANCED("AVX512")(Catch::Benchmark::Chronometer meter)
+        {
+            PACK_IMAGE_DATA_SETUP(args, out);
+            meter.measure([&]
+            {
+                image_ops::_internal::pack_image_data_avx512(args, out.data());
+            });
+        };
+    }
+
+#elif defined(LIEN_ARM_NEON)
+    BENCHMARK_ADVANCED("NEON")(Catch::Benchmark::Chronometer meter)
+    {
+        PACK_IMAGE_DATA_SETUP(args, out);
+        meter.measure([&]
+        {
+            image_ops::_internal::pack_image_data_neon(args, out.data());
         });
     };
 #endif
@@ -555,9 +861,10 @@ TEST_CASE("Benchmark channel compare")
     BENCHMARK_ADVANCED("STD")(Catch::Benchmark::Chronometer meter)
     {
         COMPARE_CHANNEL_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::channel_compare_std(args);
+            image_ops::_internal::channel_compare_std(args, out.data());
         });
     };
 
@@ -565,31 +872,287 @@ TEST_CASE("Benchmark channel compare")
     BENCHMARK_ADVANCED("SSE2")(Catch::Benchmark::Chronometer meter)
     {
         COMPARE_CHANNEL_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::channel_compare_sse2(args);
+            image_ops::_internal::channel_compare_sse2(args, out.data());
         });
     };
 
     BENCHMARK_ADVANCED("AVX2")(Catch::Benchmark::Chronometer meter)
     {
         COMPARE_CHANNEL_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::channel_compare_avx2(args);
+            image_ops::_internal::channel_compare_avx2(args, out.data());
         });
     };
 
+    if (HAS_AVX512())
+    {
+        BENCHMARK_ADVANCED("AVX512")(Catch::Benchmark::Chronometer meter)
+        {
+            COMPARE_CHANNEL_SETUP(args);
+            fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
+            meter.measure([&]
+            {
+                image_ops::_internal::channel_compare_avx512(args, out.data());
+            });
+        };
+    }
+
 #elif defined(LIEN_ARM_NEON)
     BENCHMARK_ADVANCED("NEON")(Catch::Benchmark::Chronometer meter)
     {
         COMPARE_CHANNEL_SETUP(args);
+        fixed_vector<uint8_t> out(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
         meter.measure([&]
         {
-            return image_ops::_internal::channel_compare_neon(args);
+            image_ops::_internal::channel_compare_neon(args, out.data());
         });
     };
 #endif
 };
 
+#define CHANNEL_STATS_SETUP(args) \
+    planar_image img(IMG_DIM, IMG_DIM); \
+    fill_image_random(img);\
+    image_ops::_internal::channel_info_extract_args_rgba args(*img.cdata())
+
+TEST_CASE("Benchmark channel statistics")
+{
+    BENCHMARK_ADVANCED("Histogram")(Catch::Benchmark::Chronometer meter)
+    {
+        CHANNEL_STATS_SETUP(args);
+        std::vector<uint64_t> bins(4 * 256);
+        meter.measure([&]
+        {
+            image_ops::_internal::rgba_histogram_std(args, bins.data());
+        });
+    };
+
+    BENCHMARK_ADVANCED("Reduce STD")(Catch::Benchmark::Chronometer meter)
+    {
+        CHANNEL_STATS_SETUP(args);
+        image_ops::_internal::rgba_reduction out;
+        meter.measure([&]
+        {
+            image_ops::_internal::rgba_reduce_std(args, out);
+        });
+    };
+
+#if defined(LIEN_ARCH_X86_64) || defined(LIEN_ARCH_X86)
+    BENCHMARK_ADVANCED("Reduce SSE2")(Catch::Benchmark::Chronometer meter)
+    {
+        CHANNEL_STATS_SETUP(args);
+        image_ops::_internal::rgba_reduction out;
+        meter.measure([&]
+        {
+            image_ops::_internal::rgba_reduce_sse2(args, out);
+        });
+    };
+
+    BENCHMARK_ADVANCED("Reduce AVX2")(Catch::Benchmark::Chronometer meter)
+    {
+        CHANNEL_STATS_SETUP(args);
+        image_ops::_internal::rgba_reduction out;
+        meter.measure([&]
+        {
+            image_ops::_internal::rgba_reduce_avx2(args, out);
+        });
+    };
+
+    if (HAS_AVX512())
+    {
+        BENCHMARK_ADVANCED("Reduce AVX512")(Catch::Benchmark::Chronometer meter)
+        {
+            CHANNEL_STATS_SETUP(args);
+            image_ops::_internal::rgba_reduction out;
+            meter.measure([&]
+            {
+                image_ops::_internal::rgba_reduce_avx512(args, out);
+            });
+        };
+    }
+
+#elif defined(LIEN_ARM_NEON)
+    BENCHMARK_ADVANCED("Reduce NEON")(Catch::Benchmark::Chronometer meter)
+    {
+        CHANNEL_STATS_SETUP(args);
+        image_ops::_internal::rgba_reduction out;
+        meter.measure([&]
+        {
+            image_ops::_internal::rgba_reduce_neon(args, out);
+        });
+    };
+#endif
+};
+
+TEST_CASE("Benchmark resize")
+{
+    planar_image img(1024, 1024);
+    fill_image_random(img);
+
+    // Previous implementation: pack, stb resize of the interleaved buffer, unpack
+    auto resize_stb = [&](size_t w, size_t h)
+    {
+        fixed_vector<uint8_t> packed = image_ops::pack_image_data(*img.cdata());
+        std::vector<uint8_t> resized(w * h * 4);
+        stbir_resize_uint8(packed.cdata(), 1024, 1024, 4, resized.data(), static_cast<int>(w), static_cast<int>(h), 4, 4);
+        return image_ops::unpack_image_data(resized.data(), resized.size());
+    };
+
+    BENCHMARK("Downscale 1024 -> 640 stb")
+    {
+        return resize_stb(640, 640);
+    };
+
+    BENCHMARK("Downscale 1024 -> 640 bicubic")
+    {
+        return image_ops::resize(img, 640, 640, resize_filter::BICUBIC);
+    };
+
+    BENCHMARK("Downscale 1024 -> 640 lanczos3")
+    {
+        return image_ops::resize(img, 640, 640, resize_filter::LANCZOS3);
+    };
+
+    BENCHMARK("Upscale 1024 -> 1600 stb")
+    {
+        return resize_stb(1600, 1600);
+    };
+
+    BENCHMARK("Upscale 1024 -> 1600 bilinear")
+    {
+        return image_ops::resize(img, 1600, 1600, resize_filter::BILINEAR);
+    };
+
+    BENCHMARK("Upscale 1024 -> 1600 bicubic")
+    {
+        return image_ops::resize(img, 1600, 1600, resize_filter::BICUBIC);
+    };
+
+    BENCHMARK("Upscale 1024 -> 1600 bicubic parallel")
+    {
+        return image_ops::resize(img, 1600, 1600, resize_filter::BICUBIC, execution_policy::parallel());
+    };
+};
+
+TEST_CASE("Benchmark parallel image ops")
+{
+    const size_t PARALLEL_IMG_DIM = 2048;
+    planar_image img(PARALLEL_IMG_DIM, PARALLEL_IMG_DIM);
+    fill_image_random(img);
+    fixed_vector<float> out_f32(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
+    fixed_vector<uint8_t> out_u8(img.pixel_count(), LIEN_DEFAULT_ALIGNMENT);
+
+    thread_pool pool;
+    const unsigned int max_threads = static_cast<unsigned int>(std::max<size_t>(1, pool.thread_count()));
+
+    BENCHMARK("Luminance serial")
+    {
+        image_ops::rgb_luminance(img, out_f32);
+    };
+
+    BENCHMARK("RGBA max serial")
+    {
+        image_ops::rgba_max(img, out_u8);
+    };
+
+    for (unsigned int threads = 1; threads <= max_threads; ++threads)
+    {
+        const execution_policy policy = execution_policy::parallel(pool, threads);
+        const std::string suffix = " " + std::to_string(threads) + " thread(s)";
+
+        BENCHMARK("Luminance" + suffix)
+        {
+            image_ops::rgb_luminance(img, out_f32, policy);
+        };
+
+        BENCHMARK("RGBA max" + suffix)
+        {
+            image_ops::rgba_max(img, out_u8, policy);
+        };
+    }
+};
+
+TEST_CASE("Benchmark LSB steganography")
+{
+    const size_t LSB_IMG_DIM = 1024;
+    planar_image img(LSB_IMG_DIM, LSB_IMG_DIM);
+    fill_image_random(img);
+
+    // 2 bits per channel, one payload byte per pixel
+    const size_t payload_len = image_ops::lsb_capacity(img, 2, 2, 2, 2);
+    std::vector<uint8_t> payload(payload_len);
+    for (auto& byte : payload)
+    {
+        byte = static_cast<uint8_t>(rand());
+    }
+    std::vector<uint8_t> extracted(payload_len);
+
+    image_ops::_internal::lsb_embed_args embed;
+    embed.len = img.pixel_count();
+    embed.ch_r = img.data()->data_r();
+    embed.ch_g = img.data()->data_g();
+    embed.ch_b = img.data()->data_b();
+    embed.ch_a = img.data()->data_a();
+    embed.bits_r = embed.bits_g = embed.bits_b = embed.bits_a = 2;
+    embed.payload = payload.data();
+    embed.payload_len = payload_len;
+
+    image_ops::_internal::lsb_extract_args extract;
+    extract.len = img.pixel_count();
+    extract.ch_r = img.cdata()->cdata_r();
+    extract.ch_g = img.cdata()->cdata_g();
+    extract.ch_b = img.cdata()->cdata_b();
+    extract.ch_a = img.cdata()->cdata_a();
+    extract.bits_r = extract.bits_g = extract.bits_b = extract.bits_a = 2;
+    extract.payload = extracted.data();
+    extract.payload_len = payload_len;
+
+    // Per-bit loop over a bit_iterator, what embedding looked like without the engine
+    BENCHMARK("Embed bit iterator")
+    {
+        bit_iterator<uint8_t> it(payload.data(), payload_len);
+        uint8_t* planes[4] = { embed.ch_r, embed.ch_g, embed.ch_b, embed.ch_a };
+        for (size_t i = 0; i < embed.len; ++i)
+        {
+            for (uint8_t* plane : planes)
+            {
+                uint8_t value = plane[i] & 0xFC;
+                value |= static_cast<uint8_t>(it.next());
+                value |= static_cast<uint8_t>(it.next()) << 1;
+                plane[i] = value;
+            }
+        }
+    };
+
+    BENCHMARK("Embed STD")
+    {
+        image_ops::_internal::lsb_embed_std(embed);
+    };
+
+    BENCHMARK("Extract STD")
+    {
+        image_ops::_internal::lsb_extract_std(extract);
+    };
+
+#if defined(LIEN_ARCH_X86_64) || defined(LIEN_ARCH_X86)
+    if (platform::x86::get_feature(platform::x86::feature::AVX2) && platform::x86::get_feature(platform::x86::feature::BMI2))
+    {
+        BENCHMARK("Embed AVX2 + BMI2")
+        {
+            image_ops::_internal::lsb_embed_avx2_bmi2(embed);
+        };
+
+        BENCHMARK("Extract AVX2 + BMI2")
+        {
+            image_ops::_internal::lsb_extract_avx2_bmi2(extract);
+        };
+    }
+#endif
+};
+
 #endif
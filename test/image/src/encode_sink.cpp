@@ -0,0 +1,209 @@
+#include <catch2/catch.hpp>
+
+#include <ien/base64.hpp>
+#include <ien/encode_sink.hpp>
+#include <ien/filesystem.hpp>
+#include <ien/interleaved_image.hpp>
+#include <ien/planar_image.hpp>
+#include <ien/platform.hpp>
+
+#include <stb_image.h>
+
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(LIEN_OS_UNIX) || defined(LIEN_OS_MAC)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+using namespace ien;
+
+static planar_image make_sink_test_image()
+{
+    planar_image img(61, 47);
+    for (size_t i = 0; i < img.pixel_count(); ++i)
+    {
+        img.set_pixel(i, static_cast<uint32_t>(i * 2654435761u) | 0xFF);
+    }
+    return img;
+}
+
+static void require_decodes_to(const uint8_t* data, size_t len, const planar_image& expected)
+{
+    int w = 0, h = 0, ch = 0;
+    uint8_t* decoded = stbi_load_from_memory(data, static_cast<int>(len), &w, &h, &ch, 4);
+    REQUIRE(decoded != nullptr);
+    REQUIRE(static_cast<size_t>(w) == expected.width());
+    REQUIRE(static_cast<size_t>(h) == expected.height());
+
+    fixed_vector<uint8_t> packed = expected.cdata()->pack_data();
+    const bool equal = std::memcmp(decoded, packed.cdata(), packed.size()) == 0;
+    stbi_image_free(decoded);
+    REQUIRE(equal);
+}
+
+TEST_CASE("Encode sinks")
+{
+    const planar_image img = make_sink_test_image();
+
+    SECTION("Growable buffer")
+    {
+        growable_buffer_sink sink;
+        std::vector<uint8_t> expected;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            const uint8_t chunk[3] = { static_cast<uint8_t>(i), static_cast<uint8_t>(i >> 8), 0xAB };
+            sink.write(chunk, sizeof(chunk));
+            expected.insert(expected.end(), chunk, chunk + sizeof(chunk));
+        }
+        REQUIRE(sink.size() == expected.size());
+        REQUIRE(sink.capacity() >= sink.size());
+        REQUIRE(std::memcmp(sink.data(), expected.data(), expected.size()) == 0);
+
+        const size_t capacity = sink.capacity();
+        sink.clear();
+        REQUIRE(sink.size() == 0);
+        REQUIRE(sink.capacity() == capacity);
+
+        fixed_vector<uint8_t> released;
+        sink.write(expected.data(), 10);
+        released = sink.release();
+        REQUIRE(released.size() == 10);
+        REQUIRE(std::memcmp(released.cdata(), expected.data(), 10) == 0);
+        REQUIRE(sink.size() == 0);
+        REQUIRE(sink.capacity() == 0);
+    };
+
+    SECTION("Repeated encodes reuse capacity")
+    {
+        growable_buffer_sink sink;
+        img.encode_png(sink);
+        const std::vector<uint8_t> first(sink.data(), sink.data() + sink.size());
+        const uint8_t* storage = sink.data();
+        const size_t capacity = sink.capacity();
+
+        for (int i = 0; i < 3; ++i)
+        {
+            sink.clear();
+            img.encode_png(sink);
+            REQUIRE(sink.data() == storage);
+            REQUIRE(sink.capacity() == capacity);
+            REQUIRE(sink.size() == first.size());
+            REQUIRE(std::memcmp(sink.data(), first.data(), first.size()) == 0);
+        }
+        require_decodes_to(sink.data(), sink.size(), img);
+    };
+
+    SECTION("Caller-provided buffer")
+    {
+        fixed_vector<uint8_t> buffer(1024 * 1024);
+        fixed_buffer_sink sink(buffer);
+        img.encode_tga(sink);
+        require_decodes_to(buffer.cdata(), sink.size(), img);
+
+        // Encoders surface the overflow, including through stb's C callbacks
+        fixed_buffer_sink small(buffer.data(), 64);
+        REQUIRE_THROWS_AS(img.encode_tga(small), std::length_error);
+        small.clear();
+        REQUIRE_THROWS_AS(img.encode_jpeg(small), std::length_error);
+        small.clear();
+        REQUIRE_THROWS_AS(img.encode_png(small), std::length_error);
+    };
+
+    SECTION("save_to_memory keeps every chunk")
+    {
+        // JPEG is written in many small callbacks
+        fixed_vector<uint8_t> jpeg = img.save_to_memory_jpeg(100);
+        int w = 0, h = 0, ch = 0;
+        uint8_t* decoded = stbi_load_from_memory(jpeg.cdata(), static_cast<int>(jpeg.size()), &w, &h, &ch, 4);
+        REQUIRE(decoded != nullptr);
+        REQUIRE(w == 61);
+        REQUIRE(h == 47);
+        stbi_image_free(decoded);
+
+        fixed_vector<uint8_t> png = img.save_to_memory_png();
+        require_decodes_to(png.cdata(), png.size(), img);
+
+        interleaved_image interleaved = planar_image(img).to_interleaved_image();
+        fixed_vector<uint8_t> tga = interleaved.save_to_memory_tga();
+        require_decodes_to(tga.cdata(), tga.size(), img);
+    };
+
+    SECTION("Base64 pipeline")
+    {
+        // Records the largest single write reaching the final sink
+        class chunk_limit_sink : public growable_buffer_sink
+        {
+        public:
+            size_t max_write = 0;
+            size_t flushes = 0;
+
+            void write(const uint8_t* data, size_t len) override
+            {
+                max_write = std::max(max_write, len);
+                growable_buffer_sink::write(data, len);
+            }
+
+            void flush() override { ++flushes; }
+        };
+
+        const fixed_vector<uint8_t> png = img.save_to_memory_png();
+        const std::string expected = base64::encode(png.cdata(), png.size());
+
+        chunk_limit_sink sink;
+        img.encode_png_base64(sink);
+        REQUIRE(std::string(reinterpret_cast<const char*>(sink.data()), sink.size()) == expected);
+        REQUIRE(sink.max_write <= 4096);
+        REQUIRE(sink.flushes == 1);
+        REQUIRE(planar_image(img).to_png_base64() == expected);
+
+        const std::string expected_url = base64::encode(png.cdata(), png.size(), base64::alphabet::url_safe);
+        sink.clear();
+        img.encode_png_base64(sink, 4, base64::alphabet::url_safe);
+        REQUIRE(std::string(reinterpret_cast<const char*>(sink.data()), sink.size()) == expected_url);
+
+        // Arbitrary write sizes, the adapter is reusable after flush()
+        growable_buffer_sink text;
+        base64_encode_sink b64(text);
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            text.clear();
+            for (size_t i = 0, n = 1; i < png.size(); i += n, n = (n * 7) % 10007)
+            {
+                n = std::min(n, png.size() - i);
+                b64.write(png.cdata() + i, n);
+            }
+            b64.flush();
+            REQUIRE(std::string(reinterpret_cast<const char*>(text.data()), text.size()) == expected);
+        }
+    };
+
+#if defined(LIEN_OS_UNIX) || defined(LIEN_OS_MAC)
+    SECTION("File descriptor")
+    {
+        const std::string path = (LIEN_FS::temp_directory_path() / "lien_fd_sink_test.png").string();
+        int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        REQUIRE(fd >= 0);
+        {
+            fd_sink sink(fd);
+            img.encode_png(sink);
+        }
+        ::close(fd);
+
+        planar_image loaded(path);
+        LIEN_FS::remove(path);
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            REQUIRE(loaded.get_pixel(i) == img.get_pixel(i));
+        }
+
+        fd_sink closed(-1);
+        const uint8_t byte = 0;
+        REQUIRE_THROWS_AS(closed.write(&byte, 1), std::runtime_error);
+    };
+#endif
+}
\ No newline at end of file
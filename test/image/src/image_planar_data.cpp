@@ -0,0 +1,50 @@
+#include <catch2/catch.hpp>
+
+#include <ien/image_planar_data.hpp>
+#include <ien/platform.hpp>
+
+using namespace ien;
+
+TEST_CASE("Planar data layout")
+{
+    SECTION("Planes are contiguous, aligned and padded")
+    {
+        for (size_t len = 0; len < 300; len += 7)
+        {
+            image_planar_data data(len);
+            REQUIRE(data.stride() % LIEN_CACHE_LINE_SIZE == 0);
+            REQUIRE(data.stride() >= len);
+            REQUIRE(ien::is_ptr_aligned(data.cdata_r(), LIEN_CACHE_LINE_SIZE));
+            REQUIRE(data.cdata_g() == data.cdata_r() + data.stride());
+            REQUIRE(data.cdata_b() == data.cdata_g() + data.stride());
+            REQUIRE(data.cdata_a() == data.cdata_b() + data.stride());
+
+            for (size_t i = len; i < data.stride(); ++i)
+            {
+                REQUIRE(data.cdata_r()[i] == 0);
+                REQUIRE(data.cdata_a()[i] == 0);
+            }
+        }
+    };
+
+    SECTION("Copy and resize")
+    {
+        image_planar_data data(100);
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data.set_pixel(i, static_cast<uint32_t>(i * 0x01010101));
+        }
+
+        image_planar_data copy(data);
+        REQUIRE(copy.cdata_r() != data.cdata_r());
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            REQUIRE(copy.get_pixel(i) == data.get_pixel(i));
+        }
+
+        copy.resize(1000);
+        REQUIRE(copy.size() == 1000);
+        REQUIRE(copy.stride() >= 1000);
+        REQUIRE(copy.cdata_a() == copy.cdata_r() + (copy.stride() * 3));
+    };
+}
\ No newline at end of file
@@ -0,0 +1,404 @@
+#include <catch2/catch.hpp>
+
+#include <ien/filesystem.hpp>
+#include <ien/image_ops.hpp>
+#include <ien/image_stream.hpp>
+#include <ien/interleaved_image.hpp>
+#include <ien/planar_image.hpp>
+
+#include <stb_image_write.h>
+
+#if defined(LIEN_IMAGE_ZLIB)
+    #include <zlib.h>
+#endif
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ien;
+
+static planar_image make_stream_test_image(size_t w, size_t h)
+{
+    planar_image img(w, h);
+    image_planar_data& data = *img.data();
+    for (size_t i = 0; i < img.pixel_count(); ++i)
+    {
+        // Runs of repeated pixels every few rows, so RLE packets of both kinds are produced
+        const size_t v = ((i / w) % 3 == 0) ? (i / 8) : (i * 2654435761u) >> 7;
+        data.data_r()[i] = static_cast<uint8_t>(v);
+        data.data_g()[i] = static_cast<uint8_t>(v >> 8);
+        data.data_b()[i] = static_cast<uint8_t>(v >> 16);
+        data.data_a()[i] = static_cast<uint8_t>(v * 7);
+    }
+    return img;
+}
+
+static std::string stream_test_path(const std::string& name)
+{
+    return (LIEN_FS::temp_directory_path() / name).string();
+}
+
+static void write_file(const std::string& path, const std::vector<uint8_t>& bytes)
+{
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    REQUIRE(f != nullptr);
+    std::fwrite(bytes.data(), 1, bytes.size(), f);
+    std::fclose(f);
+}
+
+static void require_rows_match(image_stream_reader& reader, const planar_image& expected, size_t strip_rows, bool opaque = false)
+{
+    REQUIRE(reader.width() == expected.width());
+    REQUIRE(reader.height() == expected.height());
+
+    const image_planar_data& exp = *expected.cdata();
+    planar_image strip;
+    size_t y0 = 0;
+    while (reader.read_strip(strip, strip_rows))
+    {
+        REQUIRE(strip.width() == expected.width());
+        for (size_t i = 0; i < strip.pixel_count(); ++i)
+        {
+            const size_t idx = (y0 * expected.width()) + i;
+            REQUIRE(strip.cdata()->cdata_r()[i] == exp.cdata_r()[idx]);
+            REQUIRE(strip.cdata()->cdata_g()[i] == exp.cdata_g()[idx]);
+            REQUIRE(strip.cdata()->cdata_b()[i] == exp.cdata_b()[idx]);
+            REQUIRE(strip.cdata()->cdata_a()[i] == (opaque ? 255 : exp.cdata_a()[idx]));
+        }
+        y0 += strip.height();
+    }
+    REQUIRE(y0 == expected.height());
+    REQUIRE(reader.rows_remaining() == 0);
+}
+
+static void write_strips(const planar_image& src, const std::string& path, image_stream_format format, size_t strip_rows)
+{
+    auto writer = open_image_writer(path, format, src.width(), src.height());
+    const size_t w = src.width();
+    for (size_t y0 = 0; y0 < src.height(); y0 += strip_rows)
+    {
+        const size_t rows = std::min(strip_rows, src.height() - y0);
+        planar_image strip(w, rows);
+        for (size_t i = 0; i < strip.pixel_count(); ++i)
+        {
+            strip.set_pixel(i, src.get_pixel((y0 * w) + i));
+        }
+        writer->write_strip(strip);
+    }
+    writer->finish();
+}
+
+#if defined(LIEN_IMAGE_ZLIB)
+static void append_png_chunk(std::vector<uint8_t>& png, const char* type, const std::vector<uint8_t>& data)
+{
+    const uint32_t len = static_cast<uint32_t>(data.size());
+    const uint8_t len_be[4] = {
+        static_cast<uint8_t>(len >> 24), static_cast<uint8_t>(len >> 16),
+        static_cast<uint8_t>(len >> 8), static_cast<uint8_t>(len)
+    };
+    png.insert(png.end(), len_be, len_be + 4);
+
+    const size_t type_pos = png.size();
+    png.insert(png.end(), type, type + 4);
+    png.insert(png.end(), data.begin(), data.end());
+
+    const uLong crc = crc32(0L, png.data() + type_pos, static_cast<uInt>(data.size() + 4));
+    const uint8_t crc_be[4] = {
+        static_cast<uint8_t>(crc >> 24), static_cast<uint8_t>(crc >> 16),
+        static_cast<uint8_t>(crc >> 8), static_cast<uint8_t>(crc)
+    };
+    png.insert(png.end(), crc_be, crc_be + 4);
+}
+
+// 'rows' already carry their filter byte. The image data is split over two IDAT chunks,
+// after an ancillary chunk the reader has to skip
+static std::vector<uint8_t> make_png(
+    uint32_t w, uint32_t h, uint8_t depth, uint8_t color_type, const std::vector<uint8_t>& rows,
+    const std::vector<uint8_t>& plte = {}, const std::vector<uint8_t>& trns = {}, uint8_t interlace = 0)
+{
+    std::vector<uint8_t> png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    append_png_chunk(png, "IHDR", {
+        static_cast<uint8_t>(w >> 24), static_cast<uint8_t>(w >> 16), static_cast<uint8_t>(w >> 8), static_cast<uint8_t>(w),
+        static_cast<uint8_t>(h >> 24), static_cast<uint8_t>(h >> 16), static_cast<uint8_t>(h >> 8), static_cast<uint8_t>(h),
+        depth, color_type, 0, 0, interlace
+    });
+    if (!plte.empty()) { append_png_chunk(png, "PLTE", plte); }
+    if (!trns.empty()) { append_png_chunk(png, "tRNS", trns); }
+
+    std::vector<uint8_t> z(compressBound(static_cast<uLong>(rows.size())));
+    uLongf zlen = static_cast<uLongf>(z.size());
+    REQUIRE(compress(z.data(), &zlen, rows.data(), static_cast<uLong>(rows.size())) == Z_OK);
+
+    const size_t half = zlen / 2;
+    append_png_chunk(png, "tEXt", { 'k', 0, 'v' });
+    append_png_chunk(png, "IDAT", std::vector<uint8_t>(z.begin(), z.begin() + half));
+    append_png_chunk(png, "IDAT", std::vector<uint8_t>(z.begin() + half, z.begin() + zlen));
+    append_png_chunk(png, "IEND", {});
+    return png;
+}
+
+static std::vector<uint32_t> decode_all(const std::string& path)
+{
+    auto reader = open_image_reader(path);
+    std::vector<uint8_t> row(reader->width() * 4);
+    std::vector<uint32_t> result;
+    while (reader->rows_remaining() > 0)
+    {
+        reader->read_row(row.data());
+        for (size_t i = 0; i < reader->width(); ++i)
+        {
+            const uint8_t* px = row.data() + (i * 4);
+            result.push_back((uint32_t(px[0]) << 24) | (uint32_t(px[1]) << 16) | (uint32_t(px[2]) << 8) | px[3]);
+        }
+    }
+    return result;
+}
+#endif
+
+TEST_CASE("Image streams")
+{
+    const planar_image src = make_stream_test_image(37, 23);
+
+    SECTION("TGA round trip")
+    {
+        const std::string path = stream_test_path("lien_stream_test.tga");
+        write_strips(src, path, image_stream_format::TGA, 5);
+        auto reader = open_image_reader(path);
+        require_rows_match(*reader, src, 7);
+        reader.reset();
+        LIEN_FS::remove(path);
+    };
+
+    SECTION("PAM round trip")
+    {
+        const std::string path = stream_test_path("lien_stream_test.pam");
+        write_strips(src, path, image_stream_format::PAM, 4);
+        auto reader = open_image_reader(path);
+        require_rows_match(*reader, src, 23);
+        reader.reset();
+        LIEN_FS::remove(path);
+    };
+
+    SECTION("PPM drops alpha")
+    {
+        const std::string path = stream_test_path("lien_stream_test.ppm");
+        write_strips(src, path, image_stream_format::PPM, 64);
+        auto reader = open_image_reader(path);
+        require_rows_match(*reader, src, 1, true);
+        reader.reset();
+        LIEN_FS::remove(path);
+    };
+
+#if defined(LIEN_IMAGE_ZLIB)
+    SECTION("PNG round trip")
+    {
+        for (int level : { 0, 6 })
+        {
+            const std::string path = stream_test_path("lien_stream_test.png");
+            auto writer = open_image_writer(path, image_stream_format::PNG, src.width(), src.height(), level);
+            writer->write_strip(src);
+            writer->finish();
+            writer.reset();
+
+            auto reader = open_image_reader(path);
+            require_rows_match(*reader, src, 6);
+            reader.reset();
+
+            // stb decodes it too
+            interleaved_image loaded(path);
+            LIEN_FS::remove(path);
+            for (size_t i = 0; i < src.pixel_count(); ++i)
+            {
+                REQUIRE(loaded.cdata()[(i * 4) + 0] == src.cdata()->cdata_r()[i]);
+                REQUIRE(loaded.cdata()[(i * 4) + 3] == src.cdata()->cdata_a()[i]);
+            }
+        }
+    };
+
+    SECTION("PNG written by stb")
+    {
+        const std::string path = stream_test_path("lien_stream_stb.png");
+        fixed_vector<uint8_t> packed = src.cdata()->pack_data();
+        REQUIRE(stbi_write_png(path.c_str(), 37, 23, 4, packed.data(), 37 * 4));
+        auto reader = open_image_reader(path);
+        require_rows_match(*reader, src, 5);
+        reader.reset();
+        LIEN_FS::remove(path);
+    };
+
+    SECTION("PNG color types and bit depths")
+    {
+        const std::string path = stream_test_path("lien_stream_variants.png");
+
+        // 1-bit gray, 10 pixels wide -> 2 bytes per row
+        write_file(path, make_png(10, 2, 1, 0, {
+            0, 0b10110000, 0b01000000,
+            2, 0b11111111, 0b11000000 // 'up' filter on top of the first row
+        }));
+        REQUIRE(decode_all(path) == std::vector<uint32_t>{
+            0xFFFFFFFF, 0x000000FF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0x000000FF, 0xFFFFFFFF,
+            0xFFFFFFFF, 0x000000FF, 0xFFFFFFFF, 0x000000FF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000000FF, 0x000000FF
+        });
+
+        // 4-bit palette with transparency for the first entry
+        write_file(path, make_png(3, 1, 4, 3, { 0, 0x01, 0x20 },
+            { 10, 20, 30, 40, 50, 60, 70, 80, 90 }, { 0 }));
+        REQUIRE(decode_all(path) == std::vector<uint32_t>{ 0x0A141E00, 0x28323CFF, 0x46505AFF });
+
+        // 16-bit RGB with a color key, 'sub' filter
+        write_file(path, make_png(2, 1, 16, 2, {
+            1, 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC,
+               0x00, 0x01, 0x00, 0x01, 0x00, 0x01
+        }, {}, { 0x12, 0x35, 0x56, 0x79, 0x9A, 0xBD }));
+        REQUIRE(decode_all(path) == std::vector<uint32_t>{ 0x12569AFF, 0x12569A00 });
+
+        // 8-bit gray + alpha, 'average' and 'paeth' filters
+        write_file(path, make_png(2, 2, 8, 4, {
+            3, 100, 200, 10, 20,
+            4, 1, 1, 1, 1
+        }));
+        REQUIRE(decode_all(path) == std::vector<uint32_t>{
+            0x646464C8, 0x3C3C3C78,
+            0x656565C9, 0x3D3D3D79
+        });
+
+        // Interlaced images can't be streamed, planar_image still loads them through stb
+        write_file(path, make_png(1, 1, 8, 0, { 0, 0 }, {}, {}, 1));
+        REQUIRE_THROWS_AS(open_image_reader(path), unsupported_image_format);
+        REQUIRE(planar_image(path).pixel_count() == 1);
+
+        LIEN_FS::remove(path);
+    };
+
+    SECTION("Corrupt PNGs are rejected")
+    {
+        const std::string path = stream_test_path("lien_stream_corrupt.png");
+        const std::vector<uint8_t> png = make_png(2, 1, 8, 0, { 0, 10, 20 });
+
+        // IHDR CRC, then the CRC of the last IDAT chunk (the 12 byte IEND chunk follows it).
+        // planar_image must not fall back to stb on these
+        for (size_t crc_pos : { size_t(29), png.size() - 16 })
+        {
+            std::vector<uint8_t> bad = png;
+            bad[crc_pos] ^= 0x01;
+            write_file(path, bad);
+            REQUIRE_THROWS_WITH(decode_all(path), Catch::Contains("CRC"));
+            REQUIRE_THROWS_WITH(planar_image(path), Catch::Contains("CRC"));
+        }
+
+        // Oversized dimensions fail before any allocation
+        write_file(path, make_png(1u << 30, 1u << 30, 8, 6, { 0 }));
+        REQUIRE_THROWS_WITH(open_image_reader(path), Catch::Contains("Invalid PNG dimensions"));
+        REQUIRE_THROWS_WITH(planar_image(path), Catch::Contains("Invalid PNG dimensions"));
+
+        // Truncated image data
+        write_file(path, std::vector<uint8_t>(png.begin(), png.begin() + 45));
+        REQUIRE_THROWS_AS(decode_all(path), std::runtime_error);
+        REQUIRE_THROWS_AS(planar_image(path), std::runtime_error);
+
+        LIEN_FS::remove(path);
+    };
+#endif
+
+    SECTION("Missing file keeps the image class contract")
+    {
+        const std::string path = stream_test_path("lien_stream_missing.png");
+        LIEN_FS::remove(path);
+        REQUIRE_THROWS_AS(planar_image(path), std::invalid_argument);
+        REQUIRE_THROWS_AS(interleaved_image(path), std::invalid_argument);
+    };
+
+    SECTION("TGA written by stb")
+    {
+        // stb writes bottom-up RLE, rows are visited in reverse through the recorded row offsets
+        const std::string path = stream_test_path("lien_stream_stb.tga");
+        fixed_vector<uint8_t> packed = src.cdata()->pack_data();
+        REQUIRE(stbi_write_tga(path.c_str(), 37, 23, 4, packed.data()));
+        auto reader = open_image_reader(path);
+        require_rows_match(*reader, src, 3);
+        reader.reset();
+
+        // Color-mapped TGAs have no streaming decoder, planar_image loads them through stb
+        write_file(path, {
+            0, 1, 1, 0, 0, 2, 0, 24, 0, 0, 0, 0, 2, 0, 1, 0, 8, 0x20,
+            30, 20, 10, 60, 50, 40,
+            1, 0
+        });
+        REQUIRE_THROWS_AS(open_image_reader(path), unsupported_image_format);
+        planar_image mapped(path);
+        REQUIRE(mapped.width() == 2);
+        REQUIRE(mapped.cdata()->cdata_r()[0] == 40);
+        REQUIRE(mapped.cdata()->cdata_b()[1] == 30);
+        LIEN_FS::remove(path);
+    };
+
+    SECTION("Image classes")
+    {
+        for (bool png : { false, true })
+        {
+            const std::string path = stream_test_path(png ? "lien_stream_class.png" : "lien_stream_class.tga");
+            REQUIRE((png ? src.save_to_file_png(path) : src.save_to_file_tga(path)) == true);
+
+            planar_image loaded(path);
+            LIEN_FS::remove(path);
+            REQUIRE(loaded.width() == src.width());
+            REQUIRE(loaded.height() == src.height());
+            for (size_t i = 0; i < src.pixel_count(); ++i)
+            {
+                REQUIRE(loaded.get_pixel(i) == src.get_pixel(i));
+            }
+        }
+    };
+
+    SECTION("Strip-wise image ops")
+    {
+        const std::string in_path = stream_test_path("lien_stream_in.pam");
+        const std::string out_path = stream_test_path("lien_stream_out.pam");
+        write_strips(src, in_path, image_stream_format::PAM, 23);
+
+        auto reader = open_image_reader(in_path);
+        auto writer = open_image_writer(out_path, image_stream_format::PAM, reader->width(), reader->height());
+        planar_image strip;
+        while (reader->read_strip(strip, 4))
+        {
+            image_ops::rgba_max(strip, rgba_channel::A);
+            writer->write_strip(strip);
+        }
+        writer->finish();
+        reader.reset();
+        writer.reset();
+
+        planar_image expected = src;
+        image_ops::rgba_max(expected, rgba_channel::A);
+        auto out_reader = open_image_reader(out_path);
+        require_rows_match(*out_reader, expected, 9);
+        out_reader.reset();
+
+        LIEN_FS::remove(in_path);
+        LIEN_FS::remove(out_path);
+    };
+
+    SECTION("Row count is enforced")
+    {
+        const std::string path = stream_test_path("lien_stream_rows.pam");
+        auto writer = open_image_writer(path, image_stream_format::PAM, 4, 2);
+        std::vector<uint8_t> row(16, 0x7F);
+        writer->write_row(row.data());
+        REQUIRE_THROWS_AS(writer->finish(), std::logic_error);
+        writer->write_row(row.data());
+        REQUIRE_THROWS_AS(writer->write_row(row.data()), std::out_of_range);
+        writer->finish();
+        writer.reset();
+
+        auto reader = open_image_reader(path);
+        reader->read_row(row.data());
+        reader->read_row(row.data());
+        REQUIRE_THROWS_AS(reader->read_row(row.data()), std::out_of_range);
+        reader.reset();
+        LIEN_FS::remove(path);
+
+        REQUIRE_THROWS_AS(open_image_reader(stream_test_path("lien_stream_missing.tga")), std::invalid_argument);
+    };
+}
\ No newline at end of file
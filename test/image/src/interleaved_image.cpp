@@ -0,0 +1,56 @@
+#include <catch2/catch.hpp>
+
+#include <ien/filesystem.hpp>
+#include <ien/interleaved_image.hpp>
+#include <ien/planar_image.hpp>
+
+#include <stdexcept>
+
+using namespace ien;
+
+TEST_CASE("Interleaved image buffer adoption")
+{
+    SECTION("Adopt packed buffer")
+    {
+        fixed_vector<uint8_t> buff(16 * 8 * 4, LIEN_DEFAULT_ALIGNMENT);
+        for (size_t i = 0; i < buff.size(); ++i) { buff[i] = static_cast<uint8_t>(i); }
+        const uint8_t* raw = buff.cdata();
+
+        interleaved_image img(std::move(buff), 16, 8);
+        REQUIRE(img.cdata() == raw);
+        REQUIRE(img.width() == 16);
+        REQUIRE(img.height() == 8);
+    };
+
+    SECTION("Buffer too small")
+    {
+        fixed_vector<uint8_t> buff(10);
+        REQUIRE_THROWS_AS(interleaved_image(std::move(buff), 16, 8), std::invalid_argument);
+    };
+
+    SECTION("Load adopts the decoded buffer")
+    {
+        planar_image src(37, 23);
+        for (size_t i = 0; i < src.pixel_count(); ++i)
+        {
+            src.set_pixel(i, static_cast<uint32_t>(i * 2654435761u) | 0xFF);
+        }
+
+        const std::string path = (LIEN_FS::temp_directory_path() / "lien_adopt_test.png").string();
+        REQUIRE(src.save_to_file_png(path));
+
+        interleaved_image loaded(path);
+        LIEN_FS::remove(path);
+
+        REQUIRE(loaded.width() == 37);
+        REQUIRE(loaded.height() == 23);
+        for (size_t i = 0; i < src.pixel_count(); ++i)
+        {
+            const uint8_t* px = loaded.cdata() + (i * 4);
+            REQUIRE(px[0] == src.cdata()->cdata_r()[i]);
+            REQUIRE(px[1] == src.cdata()->cdata_g()[i]);
+            REQUIRE(px[2] == src.cdata()->cdata_b()[i]);
+            REQUIRE(px[3] == src.cdata()->cdata_a()[i]);
+        }
+    };
+}
\ No newline at end of file
@@ -9,8 +9,12 @@
 #include <ien/internal/x86/image_ops_x86.hpp>
 #endif
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
 
 #include "utils.hpp"
 
@@ -71,50 +75,85 @@ TEST_CASE("[x86] Channel byte truncation")
             REQUIRE(img.cdata()->cdata_a()[i] == 0xF0);
         }
     };
-};
 
-TEST_CASE("[x86] Channel average RGBA")
-{
-    SECTION("SSE2")
+    SECTION("AVX512")
     {
-        LIEN_CHECK_SSE2("[x86] Channel average RGBA", return);
-        planar_image img(41, 41);
+        LIEN_CHECK_AVX512("[x86] Channel byte truncation", return);
+        planar_image img(131, 131);
+        auto px_count = 131 * 131;
 
-        for (size_t i = 0; i < img.pixel_count(); ++i)
+        for (size_t i = 0; i < px_count; ++i)
         {
-            img.data()->data_r()[i] = 20;
-            img.data()->data_g()[i] = 25;
-            img.data()->data_b()[i] = 41;
-            img.data()->data_a()[i] = 68;
+            img.data()->data_r()[i] = 0xFF;
+            img.data()->data_g()[i] = 0xFF;
+            img.data()->data_b()[i] = 0xFF;
+            img.data()->data_a()[i] = 0xFF;
         }
 
-        image_ops::_internal::channel_info_extract_args_rgba args(img);
-        auto result = image_ops::_internal::rgba_average_sse2(args);
-        for (size_t i = 0; i < img.pixel_count(); ++i)
+        image_ops::_internal::truncate_channel_args args(img, 1, 2, 3, 4);
+
+        image_ops::_internal::truncate_channel_data_avx512(args);
+        for (size_t i = 0; i < px_count; ++i)
         {
-            REQUIRE(result[i] == average<uint8_t>(20, 25, 41, 68));
+            REQUIRE(img.cdata()->cdata_r()[i] == 0xFE);
+            REQUIRE(img.cdata()->cdata_g()[i] == 0xFC);
+            REQUIRE(img.cdata()->cdata_b()[i] == 0xF8);
+            REQUIRE(img.cdata()->cdata_a()[i] == 0xF0);
         }
     };
+};
+
+// Random planes, constant ones hide rounding errors that depend on the low bits of each channel
+static void fill_random_planes(planar_image& img, uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(0, 255);
+    for (size_t i = 0; i < img.pixel_count(); ++i)
+    {
+        img.data()->data_r()[i] = static_cast<uint8_t>(dist(rng));
+        img.data()->data_g()[i] = static_cast<uint8_t>(dist(rng));
+        img.data()->data_b()[i] = static_cast<uint8_t>(dist(rng));
+        img.data()->data_a()[i] = static_cast<uint8_t>(dist(rng));
+    }
+}
+
+static void check_rgba_average_matches_std(
+    size_t w,
+    size_t h,
+    void(*kernel)(const image_ops::_internal::channel_info_extract_args_rgba&, uint8_t*))
+{
+    planar_image img(w, h);
+    fill_random_planes(img, static_cast<uint32_t>(w * h));
+
+    image_ops::_internal::channel_info_extract_args_rgba args(img);
+    fixed_vector<uint8_t> result(args.len);
+    fixed_vector<uint8_t> expected(args.len);
+    kernel(args, result.data());
+    image_ops::_internal::rgba_average_std(args, expected.data());
+    for (size_t i = 0; i < img.pixel_count(); ++i)
+    {
+        REQUIRE(result[i] == expected[i]);
+    }
+}
+
+TEST_CASE("[x86] Channel average RGBA")
+{
+    SECTION("SSE2")
+    {
+        LIEN_CHECK_SSE2("[x86] Channel average RGBA", return);
+        check_rgba_average_matches_std(41, 41, &image_ops::_internal::rgba_average_sse2);
+    };
 
     SECTION("AVX2")
     {
         LIEN_CHECK_AVX2("[x86] Channel average RGBA", return);
-        planar_image img(71, 71);
-
-        for (size_t i = 0; i < img.pixel_count(); ++i)
-        {
-            img.data()->data_r()[i] = 1;
-            img.data()->data_g()[i] = 5;
-            img.data()->data_b()[i] = 10;
-            img.data()->data_a()[i] = 15;
-        }
+        check_rgba_average_matches_std(71, 71, &image_ops::_internal::rgba_average_avx2);
+    };
 
-        image_ops::_internal::channel_info_extract_args_rgba args(img);
-        auto result = image_ops::_internal::rgba_average_avx2(args);
-        for (size_t i = 0; i < img.pixel_count(); ++i)
-        {
-            REQUIRE(result[i] == average<uint8_t>(1, 5, 10, 15));
-        }
+    SECTION("AVX512")
+    {
+        LIEN_CHECK_AVX512("[x86] Channel average RGBA", return);
+        check_rgba_average_matches_std(131, 131, &image_ops::_internal::rgba_average_avx512);
     };
 };
 
@@ -134,7 +173,8 @@ TEST_CASE("[x86] Channel average RGB")
         }
 
         image_ops::_internal::channel_info_extract_args_rgb args(img);
-        auto result = image_ops::_internal::rgb_average_sse2(args);
+        fixed_vector<float> result(args.len);
+        image_ops::_internal::rgb_average_sse2(args, result.data());
         for (size_t i = 0; i < img.pixel_count(); ++i)
         {
             REQUIRE(result[i] == Approx(safe_add<float>(10, 50, 200) / 3));
@@ -155,7 +195,8 @@ TEST_CASE("[x86] Channel average RGB")
         }
 
         image_ops::_internal::channel_info_extract_args_rgb args(img);
-        auto result = image_ops::_internal::rgb_average_sse41(args);
+        fixed_vector<float> result(args.len);
+        image_ops::_internal::rgb_average_sse41(args, result.data());
         for (size_t i = 0; i < img.pixel_count(); ++i)
         {
             REQUIRE(result[i] == Approx(safe_add<float>(10, 50, 200) / 3));
@@ -176,7 +217,30 @@ TEST_CASE("[x86] Channel average RGB")
         }
 
         image_ops::_internal::channel_info_extract_args_rgb args(img);
-        auto result = image_ops::_internal::rgb_average_avx2(args);
+        fixed_vector<float> result(args.len);
+        image_ops::_internal::rgb_average_avx2(args, result.data());
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            REQUIRE(result[i] == Approx(safe_add<float>(1, 5, 10) / 3));
+        }
+    };
+
+    SECTION("AVX512")
+    {
+        LIEN_CHECK_AVX512("[x86] Channel average RGB", return);
+        planar_image img(131, 131);
+
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            img.data()->data_r()[i] = 1;
+            img.data()->data_g()[i] = 5;
+            img.data()->data_b()[i] = 10;
+            img.data()->data_a()[i] = 15;
+        }
+
+        image_ops::_internal::channel_info_extract_args_rgb args(img);
+        fixed_vector<float> result(args.len);
+        image_ops::_internal::rgb_average_avx512(args, result.data());
         for (size_t i = 0; i < img.pixel_count(); ++i)
         {
             REQUIRE(result[i] == Approx(safe_add<float>(1, 5, 10) / 3));
@@ -200,7 +264,8 @@ TEST_CASE("[x86] Channel max RGBA")
         }
 
         image_ops::_internal::channel_info_extract_args_rgba args(img);
-        auto result = image_ops::_internal::rgba_max_sse2(args);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgba_max_sse2(args, result.data());
         for (size_t i = 0; i < img.pixel_count(); ++i)
         {
             REQUIRE(result[i] == 15);
@@ -221,7 +286,30 @@ TEST_CASE("[x86] Channel max RGBA")
         }
 
         image_ops::_internal::channel_info_extract_args_rgba args(img);
-        auto result = image_ops::_internal::rgba_max_avx2(args);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgba_max_avx2(args, result.data());
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            REQUIRE(result[i] == 15);
+        }
+    };
+
+    SECTION("AVX512")
+    {
+        LIEN_CHECK_AVX512("[x86] Channel max RGBA", return);
+        planar_image img(131, 131);
+
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            img.data()->data_r()[i] = 1;
+            img.data()->data_g()[i] = 5;
+            img.data()->data_b()[i] = 10;
+            img.data()->data_a()[i] = 15;
+        }
+
+        image_ops::_internal::channel_info_extract_args_rgba args(img);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgba_max_avx512(args, result.data());
         for (size_t i = 0; i < img.pixel_count(); ++i)
         {
             REQUIRE(result[i] == 15);
@@ -245,7 +333,8 @@ TEST_CASE("[x86] Channel min RGBA")
         }
 
         image_ops::_internal::channel_info_extract_args_rgba args(img);
-        auto result = image_ops::_internal::rgba_min_sse2(args);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgba_min_sse2(args, result.data());
         for (size_t i = 0; i < img.pixel_count(); ++i)
         {
             REQUIRE(result[i] == 3);
@@ -266,7 +355,30 @@ TEST_CASE("[x86] Channel min RGBA")
         }
 
         image_ops::_internal::channel_info_extract_args_rgba args(img);
-        auto result = image_ops::_internal::rgba_min_avx2(args);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgba_min_avx2(args, result.data());
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            REQUIRE(result[i] == 3);
+        }
+    };
+
+    SECTION("AVX512")
+    {
+        LIEN_CHECK_AVX512("[x86] Channel min RGBA", return);
+        planar_image img(131, 131);
+
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            img.data()->data_r()[i] = 7;
+            img.data()->data_g()[i] = 5;
+            img.data()->data_b()[i] = 3;
+            img.data()->data_a()[i] = 4;
+        }
+
+        image_ops::_internal::channel_info_extract_args_rgba args(img);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgba_min_avx512(args, result.data());
         for (size_t i = 0; i < img.pixel_count(); ++i)
         {
             REQUIRE(result[i] == 3);
@@ -290,7 +402,8 @@ TEST_CASE("[x86] Channel max RGB")
         }
 
         image_ops::_internal::channel_info_extract_args_rgb args(img);
-        auto result = image_ops::_internal::rgb_max_sse2(args);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgb_max_sse2(args, result.data());
         for (size_t i = 0; i < img.pixel_count(); ++i)
         {
             REQUIRE(result[i] == 10);
@@ -311,7 +424,30 @@ TEST_CASE("[x86] Channel max RGB")
         }
 
         image_ops::_internal::channel_info_extract_args_rgb args(img);
-        auto result = image_ops::_internal::rgb_max_avx2(args);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgb_max_avx2(args, result.data());
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            REQUIRE(result[i] == 10);
+        }
+    };
+
+    SECTION("AVX512")
+    {
+        LIEN_CHECK_AVX512("[x86] Channel max RGB", return);
+        planar_image img(131, 131);
+
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            img.data()->data_r()[i] = 1;
+            img.data()->data_g()[i] = 5;
+            img.data()->data_b()[i] = 10;
+            img.data()->data_a()[i] = 15;
+        }
+
+        image_ops::_internal::channel_info_extract_args_rgb args(img);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgb_max_avx512(args, result.data());
         for (size_t i = 0; i < img.pixel_count(); ++i)
         {
             REQUIRE(result[i] == 10);
@@ -335,7 +471,8 @@ TEST_CASE("[x86] Channel min RGB")
         }
 
         image_ops::_internal::channel_info_extract_args_rgb args(img);
-        auto result = image_ops::_internal::rgb_min_sse2(args);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgb_min_sse2(args, result.data());
         for (size_t i = 0; i < img.pixel_count(); ++i)
         {
             REQUIRE(result[i] == 3);
@@ -356,7 +493,30 @@ TEST_CASE("[x86] Channel min RGB")
         }
 
         image_ops::_internal::channel_info_extract_args_rgb args(img);
-        auto result = image_ops::_internal::rgb_min_avx2(args);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgb_min_avx2(args, result.data());
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            REQUIRE(result[i] == 3);
+        }
+    };
+
+    SECTION("AVX512")
+    {
+        LIEN_CHECK_AVX512("[x86] Channel min RGB", return);
+        planar_image img(131, 131);
+
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            img.data()->data_r()[i] = 7;
+            img.data()->data_g()[i] = 5;
+            img.data()->data_b()[i] = 3;
+            img.data()->data_a()[i] = 1;
+        }
+
+        image_ops::_internal::channel_info_extract_args_rgb args(img);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgb_min_avx512(args, result.data());
         for (size_t i = 0; i < img.pixel_count(); ++i)
         {
             REQUIRE(result[i] == 3);
@@ -380,7 +540,8 @@ TEST_CASE("[x86] Channel sum saturated RGBA")
         }
 
         image_ops::_internal::channel_info_extract_args_rgba args(img);
-        auto result = image_ops::_internal::rgba_sum_saturated_sse2(args);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgba_sum_saturated_sse2(args, result.data());
         for (size_t i = 0; i < img.pixel_count(); ++i)
         {
             REQUIRE(result[i] == 19);
@@ -401,7 +562,8 @@ TEST_CASE("[x86] Channel sum saturated RGBA")
         }
 
         image_ops::_internal::channel_info_extract_args_rgba args(img);
-        auto result = image_ops::_internal::rgba_sum_saturated_sse2(args);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgba_sum_saturated_sse2(args, result.data());
         for (size_t i = 0; i < img.pixel_count(); ++i)
         {
             REQUIRE(result[i] == 255u);
@@ -422,7 +584,30 @@ TEST_CASE("[x86] Channel sum saturated RGBA")
         }
 
         image_ops::_internal::channel_info_extract_args_rgba args(img);
-        auto result = image_ops::_internal::rgba_sum_saturated_avx2(args);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgba_sum_saturated_avx2(args, result.data());
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            REQUIRE(result[i] == 19);
+        }
+    };
+
+    SECTION("AVX512 - Below limit")
+    {
+        LIEN_CHECK_AVX512("[x86] Channel sum saturated RGBA", return);
+        planar_image img(131, 131);
+
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            img.data()->data_r()[i] = 7;
+            img.data()->data_g()[i] = 5;
+            img.data()->data_b()[i] = 3;
+            img.data()->data_a()[i] = 4;
+        }
+
+        image_ops::_internal::channel_info_extract_args_rgba args(img);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgba_sum_saturated_avx512(args, result.data());
         for (size_t i = 0; i < img.pixel_count(); ++i)
         {
             REQUIRE(result[i] == 19);
@@ -443,7 +628,30 @@ TEST_CASE("[x86] Channel sum saturated RGBA")
         }
 
         image_ops::_internal::channel_info_extract_args_rgba args(img);
-        auto result = image_ops::_internal::rgba_sum_saturated_avx2(args);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgba_sum_saturated_avx2(args, result.data());
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            REQUIRE(result[i] == 255u);
+        }
+    };
+
+    SECTION("AVX512 - Above limit")
+    {
+        LIEN_CHECK_AVX512("[x86] Channel sum saturated RGBA", return);
+        planar_image img(131, 131);
+
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            img.data()->data_r()[i] = 77;
+            img.data()->data_g()[i] = 55;
+            img.data()->data_b()[i] = 73;
+            img.data()->data_a()[i] = 184;
+        }
+
+        image_ops::_internal::channel_info_extract_args_rgba args(img);
+        fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::rgba_sum_saturated_avx512(args, result.data());
         for (size_t i = 0; i < img.pixel_count(); ++i)
         {
             REQUIRE(result[i] == 255u);
@@ -467,8 +675,10 @@ TEST_CASE("[x86] Saturation")
         }
 
         image_ops::_internal::channel_info_extract_args_rgb args(img);
-        ien::fixed_vector<float> result0 = image_ops::_internal::rgb_saturation_std(args);
-        ien::fixed_vector<float> result1 = image_ops::_internal::rgb_saturation_sse2(args);
+        ien::fixed_vector<float> result0(args.len);
+        image_ops::_internal::rgb_saturation_std(args, result0.data());
+        ien::fixed_vector<float> result1(args.len);
+        image_ops::_internal::rgb_saturation_sse2(args, result1.data());
 
         REQUIRE(result0.size() == img.pixel_count());
         REQUIRE(result1.size() == img.pixel_count());
@@ -492,8 +702,37 @@ TEST_CASE("[x86] Saturation")
         }
 
         image_ops::_internal::channel_info_extract_args_rgb args(img);
-        ien::fixed_vector<float> result0 = image_ops::_internal::rgb_saturation_std(args);
-        ien::fixed_vector<float> result1 = image_ops::_internal::rgb_saturation_avx2(args);
+        ien::fixed_vector<float> result0(args.len);
+        image_ops::_internal::rgb_saturation_std(args, result0.data());
+        ien::fixed_vector<float> result1(args.len);
+        image_ops::_internal::rgb_saturation_avx2(args, result1.data());
+
+        REQUIRE(result0.size() == img.pixel_count());
+        REQUIRE(result1.size() == img.pixel_count());
+        for (size_t i = 0; i < result0.size(); ++i)
+        {
+            REQUIRE(result0[i] == Approx(result1[i]));
+        }
+    };
+
+    SECTION("STD == AVX512")
+    {
+        LIEN_CHECK_AVX512("[x86] Saturation", return);
+        planar_image img(131, 131);
+
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            img.data()->data_r()[i] = static_cast<uint8_t>(i + 1);
+            img.data()->data_g()[i] = static_cast<uint8_t>(i + 2);
+            img.data()->data_b()[i] = static_cast<uint8_t>(i + 3);
+            img.data()->data_a()[i] = static_cast<uint8_t>(i + 4);
+        }
+
+        image_ops::_internal::channel_info_extract_args_rgb args(img);
+        ien::fixed_vector<float> result0(args.len);
+        image_ops::_internal::rgb_saturation_std(args, result0.data());
+        ien::fixed_vector<float> result1(args.len);
+        image_ops::_internal::rgb_saturation_avx512(args, result1.data());
 
         REQUIRE(result0.size() == img.pixel_count());
         REQUIRE(result1.size() == img.pixel_count());
@@ -517,7 +756,8 @@ TEST_CASE("[x86] Saturation")
         }
 
         image_ops::_internal::channel_info_extract_args_rgb args(img);
-        ien::fixed_vector<float> result = image_ops::_internal::rgb_saturation_sse2(args);
+        ien::fixed_vector<float> result(args.len);
+        image_ops::_internal::rgb_saturation_sse2(args, result.data());
 
         REQUIRE(result.size() == img.pixel_count());
         for(const float& f : result)
@@ -540,7 +780,32 @@ TEST_CASE("[x86] Saturation")
         }
 
         image_ops::_internal::channel_info_extract_args_rgb args(img);
-        ien::fixed_vector<float> result = image_ops::_internal::rgb_saturation_avx2(args);
+        ien::fixed_vector<float> result(args.len);
+        image_ops::_internal::rgb_saturation_avx2(args, result.data());
+
+        REQUIRE(result.size() == img.pixel_count());
+        for(float& f : result)
+        {
+            REQUIRE(f == Approx(0.6666666F));
+        }
+    };
+
+    SECTION("AVX512")
+    {
+        LIEN_CHECK_AVX512("[x86] Saturation", return);
+        planar_image img(131, 131);
+
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            img.data()->data_r()[i] = static_cast<uint8_t>(1);
+            img.data()->data_g()[i] = static_cast<uint8_t>(2);
+            img.data()->data_b()[i] = static_cast<uint8_t>(3);
+            img.data()->data_a()[i] = static_cast<uint8_t>(4);
+        }
+
+        image_ops::_internal::channel_info_extract_args_rgb args(img);
+        ien::fixed_vector<float> result(args.len);
+        image_ops::_internal::rgb_saturation_avx512(args, result.data());
 
         REQUIRE(result.size() == img.pixel_count());
         for(float& f : result)
@@ -565,7 +830,8 @@ TEST_CASE("[x86] Luminance")
         }
 
         image_ops::_internal::channel_info_extract_args_rgb args(img);
-        ien::fixed_vector<float> result = image_ops::_internal::rgb_luminance_sse2(args);
+        ien::fixed_vector<float> result(args.len);
+        image_ops::_internal::rgb_luminance_sse2(args, result.data());
 
         REQUIRE(result.size() == img.pixel_count());
         for(size_t i = 0; i < result.size(); ++i)
@@ -590,7 +856,35 @@ TEST_CASE("[x86] Luminance")
         }
 
         image_ops::_internal::channel_info_extract_args_rgb args(img);
-        ien::fixed_vector<float> result = image_ops::_internal::rgb_luminance_avx2(args);
+        ien::fixed_vector<float> result(args.len);
+        image_ops::_internal::rgb_luminance_avx2(args, result.data());
+
+        REQUIRE(result.size() == img.pixel_count());
+        for(size_t i = 0; i < result.size(); ++i)
+        {
+            float v = ((img.data()->data_r()[i] * 0.2126F) / 255)
+                + ((img.data()->data_g()[i] * 0.7152F) / 255)
+                + ((img.data()->data_b()[i] * 0.0722F) / 255);
+            REQUIRE(result[i] == Approx(v).margin(0.001F));
+        }
+    };
+
+    SECTION("AVX512")
+    {
+        LIEN_CHECK_AVX512("[x86] Luminance", return);
+        planar_image img(131, 131);
+
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            img.data()->data_r()[i] = static_cast<uint8_t>(i % 32);
+            img.data()->data_g()[i] = static_cast<uint8_t>(i % 32);
+            img.data()->data_b()[i] = static_cast<uint8_t>(i % 32);
+            img.data()->data_a()[i] = static_cast<uint8_t>(i % 32);
+        }
+
+        image_ops::_internal::channel_info_extract_args_rgb args(img);
+        ien::fixed_vector<float> result(args.len);
+        image_ops::_internal::rgb_luminance_avx512(args, result.data());
 
         REQUIRE(result.size() == img.pixel_count());
         for(size_t i = 0; i < result.size(); ++i)
@@ -617,7 +911,33 @@ TEST_CASE("[x86] Unpack Image Data")
             data[(i * 4) + 3] = 4;
         }
 
-        ien::image_planar_data result = image_ops::_internal::unpack_image_data_avx2(data.data(), data.size());
+        ien::image_planar_data result(data.size() / 4);
+        image_ops::_internal::unpack_image_data_avx2(data.data(), data.size(), result);
+
+        for (size_t i = 0; i < result.size(); ++i)
+        {
+            REQUIRE(result.cdata_r()[i] == 1);
+            REQUIRE(result.cdata_g()[i] == 2);
+            REQUIRE(result.cdata_b()[i] == 3);
+            REQUIRE(result.cdata_a()[i] == 4);
+        }
+    };
+
+    SECTION("AVX512")
+    {
+        LIEN_CHECK_AVX512("[x86] Unpack Image Data", return);
+        std::vector<uint8_t> data(1024 * 1024);
+
+        for (size_t i = 0; i < data.size() / 4; ++i)
+        {
+            data[(i * 4) + 0] = 1;
+            data[(i * 4) + 1] = 2;
+            data[(i * 4) + 2] = 3;
+            data[(i * 4) + 3] = 4;
+        }
+
+        ien::image_planar_data result(data.size() / 4);
+        image_ops::_internal::unpack_image_data_avx512(data.data(), data.size(), result);
 
         for (size_t i = 0; i < result.size(); ++i)
         {
@@ -640,7 +960,8 @@ TEST_CASE("[x86] Unpack Image Data")
             data[(i * 4) + 3] = 4;
         }
 
-        ien::image_planar_data result = image_ops::_internal::unpack_image_data_ssse3(data.data(), data.size());
+        ien::image_planar_data result(data.size() / 4);
+        image_ops::_internal::unpack_image_data_ssse3(data.data(), data.size(), result);
 
         for(size_t i = 0; i < result.size(); ++i)
         {
@@ -650,6 +971,41 @@ TEST_CASE("[x86] Unpack Image Data")
             REQUIRE(result.cdata_a()[i] == 4);
         }
     };
+
+    SECTION("Pixel order")
+    {
+        // Distinct pixels and lengths with a scalar tail, constant data can't catch reordering
+        for (size_t px_count : { 37, 63, 100, 4099 })
+        {
+            std::vector<uint8_t> data(px_count * 4);
+            for (size_t i = 0; i < data.size(); ++i)
+            {
+                data[i] = static_cast<uint8_t>((i * 7) + (i / 251));
+            }
+
+            ien::image_planar_data result_ssse3(px_count);
+            ien::image_planar_data result_avx2(px_count);
+            image_ops::_internal::unpack_image_data_ssse3(data.data(), data.size(), result_ssse3);
+            image_ops::_internal::unpack_image_data_avx2(data.data(), data.size(), result_avx2);
+
+            for (size_t i = 0; i < px_count; ++i)
+            {
+                REQUIRE(result_ssse3.get_pixel(i) == result_avx2.get_pixel(i));
+                REQUIRE(result_avx2.cdata_r()[i] == data[(i * 4) + 0]);
+                REQUIRE(result_avx2.cdata_g()[i] == data[(i * 4) + 1]);
+                REQUIRE(result_avx2.cdata_b()[i] == data[(i * 4) + 2]);
+                REQUIRE(result_avx2.cdata_a()[i] == data[(i * 4) + 3]);
+            }
+
+            LIEN_CHECK_AVX512("[x86] Unpack Image Data", continue);
+            ien::image_planar_data result_avx512(px_count);
+            image_ops::_internal::unpack_image_data_avx512(data.data(), data.size(), result_avx512);
+            for (size_t i = 0; i < px_count; ++i)
+            {
+                REQUIRE(result_avx512.get_pixel(i) == result_avx2.get_pixel(i));
+            }
+        }
+    };
 };
 
 TEST_CASE("[X86] Channel compare")
@@ -667,7 +1023,8 @@ TEST_CASE("[X86] Channel compare")
         }
 
         image_ops::_internal::channel_compare_args args(img, rgba_channel::R, 107);
-        ien::fixed_vector<uint8_t> result = image_ops::_internal::channel_compare_sse2(args);
+        ien::fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::channel_compare_sse2(args, result.data());
 
         REQUIRE(result.size() == img.pixel_count());
         for(size_t i = 0; i < result.size(); ++i)
@@ -691,7 +1048,8 @@ TEST_CASE("[X86] Channel compare")
         }
 
         image_ops::_internal::channel_compare_args args(img, rgba_channel::R, 107);
-        ien::fixed_vector<uint8_t> result = image_ops::_internal::channel_compare_avx2(args);
+        ien::fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::channel_compare_avx2(args, result.data());
 
         REQUIRE(result.size() == img.pixel_count());
         for(size_t i = 0; i < result.size(); ++i)
@@ -701,6 +1059,379 @@ TEST_CASE("[X86] Channel compare")
             REQUIRE(res == cmp);
         }
     };
+
+    SECTION("AVX512")
+    {
+        LIEN_CHECK_AVX512("[X86] Channel compare", return);
+        planar_image img(131, 131);
+
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            img.data()->data_r()[i] = static_cast<uint8_t>(1 + i);
+            img.data()->data_g()[i] = static_cast<uint8_t>(2 + i);
+            img.data()->data_b()[i] = static_cast<uint8_t>(3 + i);
+            img.data()->data_a()[i] = static_cast<uint8_t>(4 + i);
+        }
+
+        image_ops::_internal::channel_compare_args args(img, rgba_channel::R, 107);
+        ien::fixed_vector<uint8_t> result(args.len);
+        image_ops::_internal::channel_compare_avx512(args, result.data());
+
+        REQUIRE(result.size() == img.pixel_count());
+        for(size_t i = 0; i < result.size(); ++i)
+        {
+            bool res = static_cast<bool>(result[i]);
+            bool cmp = (static_cast<uint8_t>(1 + i) >= 107);
+            REQUIRE(res == cmp);
+        }
+    };
+};
+
+TEST_CASE("[x86] Pack Image Data")
+{
+    // 41x41 leaves a scalar tail after the vector loops
+    planar_image img(41, 41);
+    for (size_t i = 0; i < img.pixel_count(); ++i)
+    {
+        img.data()->data_r()[i] = static_cast<uint8_t>(i);
+        img.data()->data_g()[i] = static_cast<uint8_t>(i * 3);
+        img.data()->data_b()[i] = static_cast<uint8_t>(i * 7);
+        img.data()->data_a()[i] = static_cast<uint8_t>(i * 11);
+    }
+
+    image_ops::_internal::channel_info_extract_args_rgba args(*img.cdata());
+    std::vector<uint8_t> expected(img.pixel_count() * 4);
+    image_ops::_internal::pack_image_data_std(args, expected.data());
+
+    SECTION("SSE2")
+    {
+        LIEN_CHECK_SSE2("[x86] Pack Image Data", return);
+        std::vector<uint8_t> result(img.pixel_count() * 4);
+        image_ops::_internal::pack_image_data_sse2(args, result.data());
+        REQUIRE(result == expected);
+    };
+
+    SECTION("AVX2")
+    {
+        LIEN_CHECK_AVX2("[x86] Pack Image Data", return);
+        std::vector<uint8_t> result(img.pixel_count() * 4);
+        image_ops::_internal::pack_image_data_avx2(args, result.data());
+        REQUIRE(result == expected);
+    };
+
+    SECTION("AVX512")
+    {
+        LIEN_CHECK_AVX512("[x86] Pack Image Data", return);
+        std::vector<uint8_t> result(img.pixel_count() * 4);
+        image_ops::_internal::pack_image_data_avx512(args, result.data());
+        REQUIRE(result == expected);
+    };
+};
+
+TEST_CASE("[x86] RGB metrics")
+{
+    // Odd sizes leave a scalar tail after the vector loops
+    auto fill_image = [](planar_image& img)
+    {
+        for (size_t i = 0; i < img.pixel_count(); ++i)
+        {
+            img.data()->data_r()[i] = static_cast<uint8_t>(i);
+            img.data()->data_g()[i] = static_cast<uint8_t>(i * 3);
+            img.data()->data_b()[i] = static_cast<uint8_t>(i * 7);
+            img.data()->data_a()[i] = static_cast<uint8_t>(i * 11);
+        }
+    };
+
+    auto check_against_std = [](const planar_image& img, void(*func)(const image_ops::_internal::rgb_metrics_args&))
+    {
+        const size_t px_count = img.pixel_count();
+
+        std::vector<float> exp_lum(px_count), exp_sat(px_count), exp_avg(px_count);
+        std::vector<uint8_t> exp_max(px_count), exp_min(px_count);
+        rgb_metrics_output expected = { exp_lum.data(), exp_sat.data(), exp_avg.data(), exp_max.data(), exp_min.data() };
+        image_ops::_internal::rgb_metrics_std(image_ops::_internal::rgb_metrics_args(img, rgb_metric::ALL, expected));
+
+        std::vector<float> lum(px_count), sat(px_count), avg(px_count);
+        std::vector<uint8_t> max(px_count), min(px_count);
+        rgb_metrics_output result = { lum.data(), sat.data(), avg.data(), max.data(), min.data() };
+        func(image_ops::_internal::rgb_metrics_args(img, rgb_metric::ALL, result));
+
+        for (size_t i = 0; i < px_count; ++i)
+        {
+            REQUIRE(lum[i] == Approx(exp_lum[i]));
+            REQUIRE((std::isnan(exp_sat[i]) ? std::isnan(sat[i]) : sat[i] == Approx(exp_sat[i])));
+            REQUIRE(avg[i] == Approx(exp_avg[i]));
+            REQUIRE(max[i] == exp_max[i]);
+            REQUIRE(min[i] == exp_min[i]);
+        }
+    };
+
+    SECTION("SSE2")
+    {
+        LIEN_CHECK_SSE2("[x86] RGB metrics", return);
+        planar_image img(41, 41);
+        fill_image(img);
+        check_against_std(img, &image_ops::_internal::rgb_metrics_sse2);
+    };
+
+    SECTION("AVX2")
+    {
+        LIEN_CHECK_AVX2("[x86] RGB metrics", return);
+        planar_image img(41, 41);
+        fill_image(img);
+        check_against_std(img, &image_ops::_internal::rgb_metrics_avx2);
+    };
+
+    SECTION("AVX512")
+    {
+        LIEN_CHECK_AVX512("[x86] RGB metrics", return);
+        planar_image img(131, 131);
+        fill_image(img);
+        check_against_std(img, &image_ops::_internal::rgb_metrics_avx512);
+    };
+};
+
+TEST_CASE("[x86] Float ops keep pixel order")
+{
+    // Per-pixel distinct data, constant images can't catch lane shuffles
+    planar_image img(131, 131);
+    for (size_t i = 0; i < img.pixel_count(); ++i)
+    {
+        img.data()->data_r()[i] = static_cast<uint8_t>(i);
+        img.data()->data_g()[i] = static_cast<uint8_t>(i * 3);
+        img.data()->data_b()[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    typedef void(*func_ptr_t)(const image_ops::_internal::channel_info_extract_args_rgb&, float*);
+    image_ops::_internal::channel_info_extract_args_rgb args(img);
+
+    auto check_against_std = [&](func_ptr_t std_func, func_ptr_t func)
+    {
+        std::vector<float> expected(args.len), result(args.len);
+        std_func(args, expected.data());
+        func(args, result.data());
+        for (size_t i = 0; i < args.len; ++i)
+        {
+            REQUIRE((std::isnan(expected[i]) ? std::isnan(result[i]) : result[i] == Approx(expected[i])));
+        }
+    };
+
+    SECTION("SSE2")
+    {
+        LIEN_CHECK_SSE2("[x86] Float ops keep pixel order", return);
+        check_against_std(&image_ops::_internal::rgb_average_std, &image_ops::_internal::rgb_average_sse2);
+        check_against_std(&image_ops::_internal::rgb_luminance_std, &image_ops::_internal::rgb_luminance_sse2);
+        check_against_std(&image_ops::_internal::rgb_saturation_std, &image_ops::_internal::rgb_saturation_sse2);
+    };
+
+    SECTION("AVX2")
+    {
+        LIEN_CHECK_AVX2("[x86] Float ops keep pixel order", return);
+        check_against_std(&image_ops::_internal::rgb_average_std, &image_ops::_internal::rgb_average_avx2);
+        check_against_std(&image_ops::_internal::rgb_luminance_std, &image_ops::_internal::rgb_luminance_avx2);
+        check_against_std(&image_ops::_internal::rgb_saturation_std, &image_ops::_internal::rgb_saturation_avx2);
+    };
+
+    SECTION("AVX512")
+    {
+        LIEN_CHECK_AVX512("[x86] Float ops keep pixel order", return);
+        check_against_std(&image_ops::_internal::rgb_average_std, &image_ops::_internal::rgb_average_avx512);
+        check_against_std(&image_ops::_internal::rgb_luminance_std, &image_ops::_internal::rgb_luminance_avx512);
+        check_against_std(&image_ops::_internal::rgb_saturation_std, &image_ops::_internal::rgb_saturation_avx512);
+    };
+};
+
+TEST_CASE("[x86] Channel reductions")
+{
+    typedef void(*func_ptr_t)(const image_ops::_internal::channel_info_extract_args_rgba&, image_ops::_internal::rgba_reduction&);
+
+    auto check_against_std = [](const planar_image& img, func_ptr_t func)
+    {
+        image_ops::_internal::channel_info_extract_args_rgba args(*img.cdata());
+        image_ops::_internal::rgba_reduction expected, result;
+        image_ops::_internal::rgba_reduce_std(args, expected);
+        func(args, result);
+
+        for (size_t ch = 0; ch < 4; ++ch)
+        {
+            REQUIRE(result.sum[ch] == expected.sum[ch]);
+            REQUIRE(result.sum_sq[ch] == expected.sum_sq[ch]);
+            REQUIRE(result.min[ch] == expected.min[ch]);
+            REQUIRE(result.max[ch] == expected.max[ch]);
+        }
+    };
+
+    auto check_func = [&](func_ptr_t func)
+    {
+        // Odd size leaves a tail after the vector loop, min/max must not see the padding
+        planar_image seq(41, 41);
+        for (size_t i = 0; i < seq.pixel_count(); ++i)
+        {
+            seq.data()->data_r()[i] = static_cast<uint8_t>(10 + (i % 200));
+            seq.data()->data_g()[i] = static_cast<uint8_t>(i * 3);
+            seq.data()->data_b()[i] = static_cast<uint8_t>(i * 7);
+            seq.data()->data_a()[i] = static_cast<uint8_t>(i * 11);
+        }
+        check_against_std(seq, func);
+
+        // Large enough to overflow the 32-bit square accumulators without the periodic flush
+        planar_image full(1024, 1024);
+        std::fill(full.data()->data_r(), full.data()->data_r() + full.data()->stride() * 4, uint8_t(0xFF));
+        check_against_std(full, func);
+    };
+
+    SECTION("SSE2")
+    {
+        LIEN_CHECK_SSE2("[x86] Channel reductions", return);
+        check_func(&image_ops::_internal::rgba_reduce_sse2);
+    };
+
+    SECTION("AVX2")
+    {
+        LIEN_CHECK_AVX2("[x86] Channel reductions", return);
+        check_func(&image_ops::_internal::rgba_reduce_avx2);
+    };
+
+    SECTION("AVX512")
+    {
+        LIEN_CHECK_AVX512("[x86] Channel reductions", return);
+        check_func(&image_ops::_internal::rgba_reduce_avx512);
+    };
+};
+
+TEST_CASE("[x86] Resample passes")
+{
+    typedef void(*func_ptr_t)(const image_ops::_internal::resample_args&);
+
+    // Widths below, at and above the vector sizes, up and down in both axes
+    const std::pair<size_t, size_t> sizes[] = { { 7, 100 }, { 100, 7 }, { 45, 45 * 3 }, { 131, 64 }, { 33, 32 }, { 300, 41 } };
+    const resize_filter filters[] = { resize_filter::BOX, resize_filter::BILINEAR, resize_filter::BICUBIC, resize_filter::LANCZOS3 };
+
+    auto check_against_std = [&](func_ptr_t std_func, func_ptr_t func, bool horizontal)
+    {
+        for (resize_filter filter : filters)
+        {
+            for (auto [in_len, out_len] : sizes)
+            for (size_t other_len : { 19, 70 })
+            {
+                auto coeffs = image_ops::_internal::build_resample_coeffs(in_len, out_len, filter);
+
+                std::vector<uint8_t> src(in_len * other_len);
+                for (size_t i = 0; i < src.size(); ++i)
+                {
+                    src[i] = static_cast<uint8_t>((i * 37) ^ (i >> 3));
+                }
+
+                image_ops::_internal::resample_args args;
+                args.coeffs = &coeffs;
+                args.src = src.data();
+                args.width = horizontal ? 0 : other_len;
+                args.row_begin = 0;
+                args.row_end = horizontal ? other_len : out_len;
+
+                std::vector<uint8_t> expected(out_len * other_len), result(out_len * other_len);
+                args.dst = expected.data();
+                std_func(args);
+                args.dst = result.data();
+                func(args);
+
+                REQUIRE(result == expected);
+            }
+        }
+    };
+
+    SECTION("SSE2")
+    {
+        LIEN_CHECK_SSE2("[x86] Resample passes", return);
+        check_against_std(&image_ops::_internal::resample_horizontal_std, &image_ops::_internal::resample_horizontal_sse2, true);
+        check_against_std(&image_ops::_internal::resample_vertical_std, &image_ops::_internal::resample_vertical_sse2, false);
+    };
+
+    SECTION("AVX2")
+    {
+        LIEN_CHECK_AVX2("[x86] Resample passes", return);
+        check_against_std(&image_ops::_internal::resample_horizontal_std, &image_ops::_internal::resample_horizontal_avx2, true);
+        check_against_std(&image_ops::_internal::resample_vertical_std, &image_ops::_internal::resample_vertical_avx2, false);
+    };
+};
+
+TEST_CASE("[x86] LSB steganography")
+{
+    SECTION("AVX2 + BMI2")
+    {
+        LIEN_CHECK_AVX2("[x86] LSB steganography", return);
+        LIEN_CHECK_BMI2("[x86] LSB steganography", return);
+
+        const int configs[][4] = { { 1, 1, 1, 1 }, { 2, 2, 2, 0 }, { 3, 0, 5, 1 }, { 8, 8, 8, 8 }, { 0, 0, 0, 1 }, { 7, 6, 5, 4 } };
+        for (const auto& c : configs)
+        {
+            const size_t pixel_bits = static_cast<size_t>(c[0] + c[1] + c[2] + c[3]);
+
+            // Below one block, exactly on block boundaries and with scalar tails
+            for (size_t px_count : { size_t(7), size_t(32), size_t(64), size_t(100), size_t(1031) })
+            {
+                planar_image expected(px_count, 1);
+                for (size_t i = 0; i < px_count; ++i)
+                {
+                    expected.set_pixel(i, static_cast<uint32_t>(i * 2654435761u));
+                }
+                planar_image result(expected);
+
+                const size_t payload_len = (px_count * pixel_bits) / 8;
+                std::vector<uint8_t> payload(payload_len);
+                for (size_t i = 0; i < payload_len; ++i)
+                {
+                    payload[i] = static_cast<uint8_t>((i * 131) ^ (i >> 3));
+                }
+
+                image_ops::_internal::lsb_embed_args embed;
+                embed.len = ((payload_len * 8) + pixel_bits - 1) / pixel_bits;
+                embed.bits_r = c[0];
+                embed.bits_g = c[1];
+                embed.bits_b = c[2];
+                embed.bits_a = c[3];
+                embed.payload = payload.data();
+                embed.payload_len = payload_len;
+
+                embed.ch_r = expected.data()->data_r();
+                embed.ch_g = expected.data()->data_g();
+                embed.ch_b = expected.data()->data_b();
+                embed.ch_a = expected.data()->data_a();
+                image_ops::_internal::lsb_embed_std(embed);
+
+                embed.ch_r = result.data()->data_r();
+                embed.ch_g = result.data()->data_g();
+                embed.ch_b = result.data()->data_b();
+                embed.ch_a = result.data()->data_a();
+                image_ops::_internal::lsb_embed_avx2_bmi2(embed);
+
+                for (size_t i = 0; i < px_count; ++i)
+                {
+                    REQUIRE(result.get_pixel(i) == expected.get_pixel(i));
+                }
+
+                image_ops::_internal::lsb_extract_args extract;
+                extract.len = embed.len;
+                extract.ch_r = result.cdata()->cdata_r();
+                extract.ch_g = result.cdata()->cdata_g();
+                extract.ch_b = result.cdata()->cdata_b();
+                extract.ch_a = result.cdata()->cdata_a();
+                extract.bits_r = c[0];
+                extract.bits_g = c[1];
+                extract.bits_b = c[2];
+                extract.bits_a = c[3];
+                extract.payload_len = payload_len;
+
+                // One guard byte past the end, which must be left untouched
+                std::vector<uint8_t> extracted(payload_len + 1, 0xCD);
+                extract.payload = extracted.data();
+                image_ops::_internal::lsb_extract_avx2_bmi2(extract);
+
+                REQUIRE(std::equal(payload.begin(), payload.end(), extracted.begin()));
+                REQUIRE(extracted[payload_len] == 0xCD);
+            }
+        }
+    };
 };
 
 #endif
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <ien/parallel.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <vector>
 
@@ -53,4 +54,77 @@ TEST_CASE("parallel_for")
             REQUIRE(vec[i] == 1);
         }
     }
+};
+
+TEST_CASE("parallel_for offset and stride")
+{
+    std::vector<int> vec(1000, 0);
+
+    ien::parallel_for_params pfprms;
+    pfprms.offset = 1;
+    pfprms.count = 333;
+    pfprms.stride = 3;
+    pfprms.max_threads = 4;
+
+    ien::parallel_for(pfprms, [&vec](long i)
+    {
+        vec[i] += 1;
+    });
+
+    for(size_t i = 0; i < vec.size(); ++i)
+    {
+        INFO("Index: " + std::to_string(i));
+        REQUIRE(vec[i] == ((i % 3 == 1 && i < 1000) ? 1 : 0));
+    }
+};
+
+TEST_CASE("parallel_for_range")
+{
+    SECTION("covers the whole range once")
+    {
+        static const long VEC_SZ = 100003;
+        std::vector<int> vec(VEC_SZ, 0);
+
+        for(long grain : { 0L, 1L, 7L, 4096L, VEC_SZ * 2 })
+        {
+            std::fill(vec.begin(), vec.end(), 0);
+
+            ien::parallel_for_range_params prms(VEC_SZ, grain);
+            ien::parallel_for_range(prms, [&vec](long begin, long end)
+            {
+                for(long i = begin; i < end; ++i)
+                {
+                    vec[i] += 1;
+                }
+            });
+
+            INFO("Grain: " + std::to_string(grain));
+            REQUIRE(std::all_of(vec.begin(), vec.end(), [](int v){ return v == 1; }));
+        }
+    }
+
+    SECTION("chunks respect offset and grain size")
+    {
+        ien::thread_pool pool(3);
+        std::vector<std::pair<long, long>> chunks(100);
+        std::atomic<size_t> chunk_idx = 0;
+
+        ien::parallel_for_range_params prms;
+        prms.offset = 50;
+        prms.count = 1000;
+        prms.grain_size = 64;
+
+        ien::parallel_for_range(pool, prms, [&](long begin, long end)
+        {
+            chunks[chunk_idx++] = { begin, end };
+        });
+
+        REQUIRE(chunk_idx == 16);
+        std::sort(chunks.begin(), chunks.begin() + chunk_idx);
+        for(size_t i = 0; i < chunk_idx; ++i)
+        {
+            REQUIRE(chunks[i].first == 50 + static_cast<long>(i) * 64);
+            REQUIRE(chunks[i].second == std::min(chunks[i].first + 64, 1050L));
+        }
+    }
 };
\ No newline at end of file
@@ -3,12 +3,19 @@
 #define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include <catch2/catch.hpp>
 #include <ien/parallel.hpp>
+#include <ien/parallel_numeric.hpp>
 
 #include <algorithm>
 #include <limits>
 #include <cmath>
+#include <functional>
+#include <numeric>
 #include <vector>
 
+#ifdef LIEN_BENCHMARK_PARALLEL_STL
+    #include <execution>
+#endif
+
 double expensive_op(const double val)
 {
     double res = std::asin(val);
@@ -77,4 +84,122 @@ TEST_CASE("parallel_for benchmarks")
     };
 }
 
+TEST_CASE("parallel_for small loop benchmarks")
+{
+    BENCHMARK_ADVANCED("ien::parallel_for (64 items)")(Catch::Benchmark::Chronometer meter)
+    {
+        std::vector<double> vec;
+        vec.resize(64);
+        std::transform(vec.begin(), vec.end(), vec.begin(), [](double i){ return std::rand(); });
+        meter.measure([&] (int _i)
+        {
+            ien::parallel_for_params pfdesc;
+            pfdesc.count = static_cast<long>(vec.size());
+
+            ien::parallel_for(pfdesc, [&](long i)
+            {
+                vec[i] = std::sqrt(vec[i]);
+            });
+        });
+        return vec;
+    };
+}
+
+TEST_CASE("parallel_for_range benchmarks")
+{
+    static const size_t RANGE_VEC_SIZE = 1 << 22;
+
+    BENCHMARK_ADVANCED("ien::parallel_for (per index)")(Catch::Benchmark::Chronometer meter)
+    {
+        std::vector<float> vec(RANGE_VEC_SIZE, 1.0F);
+        meter.measure([&] (int _i)
+        {
+            ien::parallel_for_params pfdesc(static_cast<long>(vec.size()));
+            ien::parallel_for(pfdesc, [&](long i)
+            {
+                vec[i] = vec[i] * 0.5F + 1.0F;
+            });
+        });
+        return vec;
+    };
+
+    BENCHMARK_ADVANCED("ien::parallel_for_range")(Catch::Benchmark::Chronometer meter)
+    {
+        std::vector<float> vec(RANGE_VEC_SIZE, 1.0F);
+        meter.measure([&] (int _i)
+        {
+            ien::parallel_for_range_params prms(static_cast<long>(vec.size()));
+            ien::parallel_for_range(prms, [&](long begin, long end)
+            {
+                for(long i = begin; i < end; ++i)
+                {
+                    vec[i] = vec[i] * 0.5F + 1.0F;
+                }
+            });
+        });
+        return vec;
+    };
+}
+
+TEST_CASE("parallel_reduce benchmarks")
+{
+    static const size_t REDUCE_VEC_SIZE = 1 << 24;
+    std::vector<double> vec(REDUCE_VEC_SIZE);
+    std::transform(vec.begin(), vec.end(), vec.begin(), [](double i){ return std::rand() % 1000; });
+
+    BENCHMARK("std::accumulate")
+    {
+        return std::accumulate(vec.begin(), vec.end(), 0.0);
+    };
+
+#ifdef LIEN_BENCHMARK_PARALLEL_STL
+    BENCHMARK("std::reduce (std::execution::seq)")
+    {
+        return std::reduce(std::execution::seq, vec.begin(), vec.end(), 0.0);
+    };
+
+    BENCHMARK("std::reduce (std::execution::par_unseq)")
+    {
+        return std::reduce(std::execution::par_unseq, vec.begin(), vec.end(), 0.0);
+    };
+#endif
+
+    BENCHMARK("ien::parallel_reduce")
+    {
+        return ien::parallel_reduce(vec.begin(), vec.end(), 0.0, std::plus<double>());
+    };
+
+    BENCHMARK("ien::parallel_transform_reduce")
+    {
+        return ien::parallel_transform_reduce(vec.begin(), vec.end(), 0.0, std::plus<double>(), [](double v) { return v * v; });
+    };
+}
+
+TEST_CASE("parallel scan benchmarks")
+{
+    static const size_t SCAN_VEC_SIZE = 1 << 24;
+    std::vector<double> vec(SCAN_VEC_SIZE, 1.0);
+    std::vector<double> out(SCAN_VEC_SIZE);
+
+    BENCHMARK("std::partial_sum")
+    {
+        std::partial_sum(vec.begin(), vec.end(), out.begin());
+        return out.back();
+    };
+
+#ifdef LIEN_BENCHMARK_PARALLEL_STL
+    BENCHMARK("std::inclusive_scan (std::execution::par)")
+    {
+        std::inclusive_scan(std::execution::par, vec.begin(), vec.end(), out.begin());
+        return out.back();
+    };
+#endif
+
+    BENCHMARK("ien::parallel_inclusive_scan")
+    {
+        ien::parallel_inclusive_scan(vec.begin(), vec.end(), out.begin(), std::plus<double>());
+        return out.back();
+    };
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include <catch2/catch.hpp>
+#include <ien/parallel_numeric.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+TEST_CASE("parallel_reduce")
+{
+    SECTION("sum")
+    {
+        std::vector<int64_t> vec(100003);
+        std::iota(vec.begin(), vec.end(), 1);
+
+        int64_t expected = std::accumulate(vec.begin(), vec.end(), int64_t(7));
+        int64_t result = ien::parallel_reduce(vec.begin(), vec.end(), int64_t(7), std::plus<int64_t>());
+        REQUIRE(result == expected);
+    }
+
+    SECTION("empty range returns init")
+    {
+        std::vector<int> vec;
+        REQUIRE(ien::parallel_reduce(vec.begin(), vec.end(), 42, std::plus<int>()) == 42);
+    }
+
+    SECTION("non commutative operation keeps order")
+    {
+        std::vector<std::string> vec;
+        for(int i = 0; i < 5000; ++i)
+        {
+            vec.push_back(std::string(1, static_cast<char>('a' + (i % 26))));
+        }
+
+        std::string expected = std::accumulate(vec.begin(), vec.end(), std::string(">"));
+        std::string result = ien::parallel_reduce(vec.begin(), vec.end(), std::string(">"), std::plus<std::string>(), 4);
+        REQUIRE(result == expected);
+    }
+}
+
+TEST_CASE("parallel_transform_reduce")
+{
+    std::vector<int> vec(65536);
+    std::iota(vec.begin(), vec.end(), 0);
+
+    int64_t expected = 0;
+    for(int v : vec) { expected += static_cast<int64_t>(v) * v; }
+
+    int64_t result = ien::parallel_transform_reduce(
+        vec.begin(), vec.end(),
+        int64_t(0),
+        std::plus<int64_t>(),
+        [](int v) { return static_cast<int64_t>(v) * v; }
+    );
+    REQUIRE(result == expected);
+}
+
+TEST_CASE("parallel scans")
+{
+    static const int SCAN_SIZE = 70001;
+
+    std::vector<int64_t> vec(SCAN_SIZE);
+    for(int i = 0; i < SCAN_SIZE; ++i) { vec[i] = (i % 13) - 6; }
+
+    SECTION("inclusive scan")
+    {
+        std::vector<int64_t> expected(vec.size()), result(vec.size());
+        std::partial_sum(vec.begin(), vec.end(), expected.begin());
+
+        auto end = ien::parallel_inclusive_scan(vec.begin(), vec.end(), result.begin(), std::plus<int64_t>(), 4);
+        REQUIRE(end == result.end());
+        REQUIRE(result == expected);
+    }
+
+    SECTION("exclusive scan")
+    {
+        std::vector<int64_t> expected(vec.size()), result(vec.size());
+        int64_t acc = 100;
+        for(size_t i = 0; i < vec.size(); ++i)
+        {
+            expected[i] = acc;
+            acc += vec[i];
+        }
+
+        ien::parallel_exclusive_scan(vec.begin(), vec.end(), result.begin(), int64_t(100), std::plus<int64_t>(), 4);
+        REQUIRE(result == expected);
+    }
+
+    SECTION("in place")
+    {
+        std::vector<int64_t> expected(vec.size());
+        std::partial_sum(vec.begin(), vec.end(), expected.begin());
+
+        ien::parallel_inclusive_scan(vec.begin(), vec.end(), vec.begin(), std::plus<int64_t>(), 3);
+        REQUIRE(vec == expected);
+    }
+
+    SECTION("small input")
+    {
+        std::vector<int64_t> small = { 1, 2, 3 };
+        std::vector<int64_t> result(3);
+        ien::parallel_exclusive_scan(small.begin(), small.end(), result.begin(), int64_t(0), std::plus<int64_t>());
+        REQUIRE(result == std::vector<int64_t>{ 0, 1, 3 });
+    }
+}
\ No newline at end of file
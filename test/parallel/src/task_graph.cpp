@@ -0,0 +1,158 @@
+#include <catch2/catch.hpp>
+#include <ien/task_graph.hpp>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("task_graph")
+{
+    ien::task_queue tq(3);
+    tq.run(true);
+
+    SECTION("values flow through dependencies")
+    {
+        ien::task_graph graph(tq);
+
+        auto a = graph.emplace([]{ return 2; });
+        auto b = graph.emplace([]{ return 3; });
+        auto c = graph.emplace([a, b]{ return a.get() * b.get(); }, a, b);
+        auto d = graph.emplace([c]{ return std::to_string(c.get()); }, c);
+
+        REQUIRE(d.get() == "6");
+        graph.wait();
+        REQUIRE(graph.pending() == 0);
+    }
+
+    SECTION("independent pipelines overlap")
+    {
+        static const int PIPELINES = 32;
+        ien::task_graph graph(tq);
+
+        std::vector<ien::task_future<std::vector<int>>> outputs;
+        for(int p = 0; p < PIPELINES; ++p)
+        {
+            auto decoded = graph.emplace([p]
+            {
+                std::vector<int> v(256);
+                std::iota(v.begin(), v.end(), p);
+                return v;
+            });
+            auto processed = graph.emplace([decoded]
+            {
+                std::vector<int> v = decoded.get();
+                for(int& i : v) { i *= 2; }
+                return v;
+            }, decoded);
+            outputs.push_back(processed);
+        }
+
+        graph.wait();
+        for(int p = 0; p < PIPELINES; ++p)
+        {
+            REQUIRE(outputs[p].is_ready());
+            const auto& v = outputs[p].get();
+            REQUIRE(v.front() == p * 2);
+            REQUIRE(v.back() == (p + 255) * 2);
+        }
+    }
+
+    SECTION("dependencies run before dependents")
+    {
+        ien::task_graph graph(tq);
+        std::atomic<int> stage = 0;
+        std::atomic<bool> order_ok = true;
+
+        auto root = graph.emplace([&]{ stage = 1; });
+        std::vector<ien::task_future<void>> mids;
+        for(int i = 0; i < 10; ++i)
+        {
+            mids.push_back(graph.emplace([&]
+            {
+                if(stage.load() < 1) { order_ok = false; }
+            }, root));
+        }
+        auto sink = graph.emplace([&, mids]
+        {
+            for(auto& m : mids)
+            {
+                if(!m.is_ready()) { order_ok = false; }
+            }
+            stage = 2;
+        }, mids[0], mids[1], mids[2], mids[3], mids[4], mids[5], mids[6], mids[7], mids[8], mids[9]);
+
+        sink.wait();
+        REQUIRE(order_ok);
+        REQUIRE(stage == 2);
+    }
+
+    SECTION("exceptions propagate to dependents")
+    {
+        ien::task_graph graph(tq);
+
+        auto failing = graph.emplace([]() -> int { throw std::runtime_error("decode failed"); });
+        auto dependent = graph.emplace([failing]{ return failing.get() + 1; }, failing);
+
+        graph.wait();
+        REQUIRE_THROWS_AS(failing.get(), std::runtime_error);
+        REQUIRE_THROWS_AS(dependent.get(), std::runtime_error);
+    }
+
+    SECTION("dependency on an already finished task")
+    {
+        ien::task_graph graph(tq);
+
+        auto first = graph.emplace([]{ return 10; });
+        first.wait();
+        auto second = graph.emplace([first]{ return first.get() + 1; }, first);
+        REQUIRE(second.get() == 11);
+    }
+
+    SECTION("default-constructed dependency is rejected")
+    {
+        ien::task_graph graph(tq);
+        ien::task_future<int> empty;
+
+        REQUIRE_THROWS_AS(graph.emplace([]{ return 1; }, empty), std::invalid_argument);
+        REQUIRE(graph.pending() == 0);
+    }
+
+    tq.join();
+};
+
+TEST_CASE("task_graph fan-out larger than the queue capacity")
+{
+    static const int ROOTS = 2;
+    static const int DEPENDENTS = 100;
+
+    ien::task_queue tq(2, 16);
+    tq.run(true);
+
+    {
+        ien::task_graph graph(tq);
+        std::atomic<bool> release = false;
+        std::atomic<int> dependents_run = 0;
+
+        // Roots hold both workers until every edge exists, then each releases more dependents than fit
+        for(int r = 0; r < ROOTS; ++r)
+        {
+            auto root = graph.emplace([&]
+            {
+                while(!release) { std::this_thread::yield(); }
+            });
+            for(int d = 0; d < DEPENDENTS; ++d)
+            {
+                graph.emplace([&]{ ++dependents_run; }, root);
+            }
+        }
+
+        release = true;
+        graph.wait();
+        REQUIRE(dependents_run == ROOTS * DEPENDENTS);
+    }
+
+    tq.join();
+};
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include <catch2/catch.hpp>
+#include <ien/mpmc_queue.hpp>
+#include <ien/task_queue.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_CASE("mpmc_queue")
+{
+    SECTION("capacity and ordering")
+    {
+        ien::mpmc_queue<int> queue(5);
+        REQUIRE(queue.capacity() == 8);
+
+        for(int i = 0; i < 8; ++i)
+        {
+            REQUIRE(queue.try_push(i));
+        }
+        REQUIRE_FALSE(queue.try_push(8));
+
+        int value = -1;
+        for(int i = 0; i < 8; ++i)
+        {
+            REQUIRE(queue.try_pop(value));
+            REQUIRE(value == i);
+        }
+        REQUIRE_FALSE(queue.try_pop(value));
+    }
+
+    SECTION("concurrent producers and consumers")
+    {
+        static const int PER_PRODUCER = 20000;
+        static const int PRODUCERS = 3;
+        static const int CONSUMERS = 3;
+
+        ien::mpmc_queue<int> queue(64);
+        std::atomic<long long> sum = 0;
+        std::atomic<int> consumed = 0;
+
+        std::vector<std::thread> threads;
+        for(int p = 0; p < PRODUCERS; ++p)
+        {
+            threads.emplace_back([&queue]
+            {
+                for(int i = 1; i <= PER_PRODUCER; ++i)
+                {
+                    while(!queue.try_push(i)) { std::this_thread::yield(); }
+                }
+            });
+        }
+        for(int c = 0; c < CONSUMERS; ++c)
+        {
+            threads.emplace_back([&]
+            {
+                int value;
+                while(consumed < PER_PRODUCER * PRODUCERS)
+                {
+                    if(queue.try_pop(value))
+                    {
+                        sum += value;
+                        ++consumed;
+                    }
+                    else { std::this_thread::yield(); }
+                }
+            });
+        }
+        for(auto& th : threads) { th.join(); }
+
+        const long long expected = PRODUCERS * (static_cast<long long>(PER_PRODUCER) * (PER_PRODUCER + 1) / 2);
+        REQUIRE(sum == expected);
+    }
+};
+
+TEST_CASE("task_queue")
+{
+    SECTION("tasks queued before run")
+    {
+        std::atomic<int> counter = 0;
+        ien::task_queue tq(4);
+        for(int i = 0; i < 100; ++i)
+        {
+            tq.emplace_back([&counter]{ ++counter; });
+        }
+        tq.run();
+        REQUIRE(counter == 100);
+    }
+
+    SECTION("capacity exceeded before run")
+    {
+        ien::task_queue tq(2, 4);
+        for(size_t i = 0; i < tq.capacity(); ++i)
+        {
+            tq.emplace_back([]{ });
+        }
+        REQUIRE_THROWS_AS(tq.emplace_back([]{ }), std::length_error);
+        REQUIRE_FALSE(tq.try_emplace_back([]{ }));
+        tq.run();
+    }
+
+    SECTION("submission after join")
+    {
+        ien::task_queue tq(2, 4);
+        tq.run();
+        REQUIRE_THROWS_AS(tq.emplace_back([]{ }), std::logic_error);
+        REQUIRE_THROWS_AS(tq.try_emplace_back([]{ }), std::logic_error);
+        tq.join();
+    }
+
+    SECTION("join before run with queued tasks")
+    {
+        ien::task_queue tq(2, 4);
+        tq.emplace_back([]{ });
+        REQUIRE_THROWS_AS(tq.join(), std::logic_error);
+        tq.run();
+    }
+
+    for(auto policy : { ien::task_queue_wait_policy::BLOCKING, ien::task_queue_wait_policy::SPINNING })
+    {
+        DYNAMIC_SECTION("dynamic submission, policy " << static_cast<int>(policy))
+        {
+            std::atomic<int> counter = 0;
+            ien::task_queue tq(3, 16, policy);
+            tq.run(true);
+
+            for(int round = 0; round < 5; ++round)
+            {
+                for(int i = 0; i < 200; ++i)
+                {
+                    tq.emplace_back([&counter, &tq]
+                    {
+                        ++counter;
+                        tq.emplace_back([&counter]{ ++counter; });
+                    });
+                }
+                tq.wait_idle();
+                REQUIRE(counter == (round + 1) * 400);
+            }
+            tq.join();
+        }
+    }
+};
\ No newline at end of file
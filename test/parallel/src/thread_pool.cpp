@@ -0,0 +1,78 @@
+#include <catch2/catch.hpp>
+#include <ien/parallel.hpp>
+#include <ien/thread_pool.hpp>
+
+#include <atomic>
+#include <vector>
+
+TEST_CASE("thread_pool")
+{
+    SECTION("submitted tasks run")
+    {
+        static const int TASK_COUNT = 1000;
+        std::atomic<int> counter = 0;
+        {
+            ien::thread_pool pool(4);
+            for(int i = 0; i < TASK_COUNT; ++i)
+            {
+                pool.submit([&counter]{ ++counter; });
+            }
+        }
+        REQUIRE(counter == TASK_COUNT);
+    }
+
+    SECTION("parallel_for on explicit pool")
+    {
+        ien::thread_pool pool(3);
+        std::vector<int> vec(4096, 0);
+
+        ien::parallel_for_params pfprms(static_cast<long>(vec.size()));
+        for(int iteration = 0; iteration < 10; ++iteration)
+        {
+            ien::parallel_for(pool, pfprms, [&vec](long i)
+            {
+                vec[i] += 1;
+            });
+        }
+
+        for(size_t i = 0; i < vec.size(); ++i)
+        {
+            INFO("Index: " + std::to_string(i));
+            REQUIRE(vec[i] == 10);
+        }
+    }
+
+    SECTION("nested parallel_for")
+    {
+        ien::thread_pool pool(2);
+        std::vector<std::atomic<int>> vec(64);
+
+        ien::parallel_for_params outer(8);
+        ien::parallel_for(pool, outer, [&](long i)
+        {
+            ien::parallel_for_params inner(8);
+            ien::parallel_for(pool, inner, [&](long j)
+            {
+                ++vec[(i * 8) + j];
+            });
+        });
+
+        for(size_t i = 0; i < vec.size(); ++i)
+        {
+            INFO("Index: " + std::to_string(i));
+            REQUIRE(vec[i] == 1);
+        }
+    }
+
+    SECTION("exceptions are propagated")
+    {
+        ien::parallel_for_params pfprms(100);
+        REQUIRE_THROWS_AS(
+            ien::parallel_for(pfprms, [](long i)
+            {
+                if(i == 50) { throw std::runtime_error("fail"); }
+            }),
+            std::runtime_error
+        );
+    }
+};
\ No newline at end of file